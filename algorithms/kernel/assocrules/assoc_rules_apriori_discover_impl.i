@@ -26,6 +26,8 @@
 #define __ASSOC_RULES_APRIORI_DISCOVER_IMPL_I__
 
 #include "service_memory.h"
+#include "service_error_handling.h"
+#include "threading.h"
 #include "assoc_rules_apriori_types.i"
 
 namespace daal
@@ -37,28 +39,11 @@ namespace association_rules
 namespace internal
 {
 
-/**
- *  Find item set in the list of item sets
- *
- *  \param items_size[in]   item set size
- *  \param items[in]        item set (array of items)
- *  \param L_cur[in]        list of the item sets to search for item set
- *
- *  \return Pointer to the found item set. NULL if no item set was found
- */
-template<typename algorithmFPType, CpuType cpu>
-const assocrules_itemset<cpu> *AssociationRulesKernel<apriori, algorithmFPType, cpu>::findItemSet(
-    size_t items_size, const size_t *items, const ItemSetList<cpu> &L_cur)
-{
-    for (auto current = L_cur.start; current; current = current->next())
-    {
-        if (!assocrules_memcmp<cpu>(items, current->itemSet()->items, items_size))
-        {
-            return current->itemSet();
-        }
-    }
-    return NULL;
-}
+/* Number of "large" itemsets processed by one thread at once during the rules discovery */
+const size_t rulesItemsetsBlockSize = 64;
+
+/* Number of rules written into the resulting tables by one thread at once */
+const size_t rulesBlockSize = 1024;
 
 /**
  *  Find intersection between two item sets
@@ -99,73 +84,66 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::setIntersection(cons
  *  Generate those rules from the items of an input item set
  *
  *  \param minConfidence[in]    minimum confidence
- *  \param L[in]                structure containing "large" item sets
+ *  \param index[in]            hash indices of "large" item sets, one per item set size
  *  \param itemSetSize[in]      number of items in the input item set
  *  \param items[in]            array of items of the input item set
  *  \param itemsSupport[in]     input item set support
  *  \param leftItems[in]        buffer to store left part of the rule
- *  \param R[in,out]            structure that contains association rules
- *  \param numRulesPtr[in,out]  number of rules
- *  \param numLeftPtr[in,out]   number of items in the left parts of the rules
- *  \param numRightPtr[in,out]  number of items in the right parts of the rules
+ *  \param R[in,out]            buffer that contains association rules
  *  \param numRulesFound[out]   number of found rules
  *
-  */
+ *  \return false if the memory allocation failed
+ */
 template<typename algorithmFPType, CpuType cpu>
-void AssociationRulesKernel<apriori, algorithmFPType, cpu>::firstPass(
-    double minConfidence, ItemSetList<cpu> *L, size_t itemSetSize,
+bool AssociationRulesKernel<apriori, algorithmFPType, cpu>::firstPass(
+    double minConfidence, const ItemSetIndex<cpu> *index, size_t itemSetSize,
     const size_t *items, size_t itemsSupport,
-    size_t *leftItems, AssocRule<cpu> *R, size_t& numRules,
-    size_t& numLeft, size_t& numRight, size_t& numRulesFound)
+    size_t *leftItems, AssocRuleBuffer<cpu> &R, size_t& numRulesFound)
 {
-    ItemSetList<cpu> &L_0 = L[0];
-    ItemSetList<cpu> &L_prev = L[itemSetSize - 1];
-    size_t oldNumRules = numRules;
+    const size_t oldNumRules = R.rules.size();
 
     for (size_t i = 0; i <= itemSetSize; ++i)
     {
         for (size_t j = 0;     j < i;            ++j) { leftItems[j]   = items[j]; }
         for (size_t j = i + 1; j <= itemSetSize; ++j) { leftItems[j - 1] = items[j]; }
 
-        const assocrules_itemset<cpu> *left_iset  = findItemSet(itemSetSize, leftItems,  L_prev);
-        const assocrules_itemset<cpu> *right_iset = findItemSet(1, &items[i], L_0);
+        const assocrules_itemset<cpu> *left_iset  = index[itemSetSize - 1].find(leftItems);
+        const assocrules_itemset<cpu> *right_iset = index[0].find(&items[i]);
         double confidence = (double)itemsSupport / (double)(left_iset->support.get());
         if (confidence >= minConfidence)
         {
-            R[numRules++].update(left_iset, right_iset, confidence);
-            numLeft += itemSetSize;
-            numRight++;
+            if (!R.add(left_iset, right_iset, confidence)) { return false; }
         }
     }
-    numRulesFound = numRules - oldNumRules;
+    numRulesFound = R.rules.size() - oldNumRules;
+    return true;
 }
 
 /**
  *  Generate rules that have k+1 items on the right from the rules that have k items on the right.
  *
  *  \param minConfidence[in]    minimum confidence
- *  \param L[in]                structure containing "large" item sets
+ *  \param index[in]            hash indices of "large" item sets, one per item set size
  *  \param right_size[in]       number of items in the right part of the rules (k)
  *  \param itemsSupport[in]     support of the item set superset that contains items of the left
  *                              and right parts of the generated rules
  *  \param leftItems[in]        buffer to store left part of the rule
- *  \param R[in,out]            structure that contains association rules
- *  \param numRulesPtr[in,out]  number of rules
- *  \param numLeftPtr[in,out]   number of items in the left parts of the rules
- *  \param numRightPtr[in,out]  number of items in the right parts of the rules
- *  \param numRulesFound[out]   number of found rules
- *  \param foundPtr[out]        flag: true, if new rules are discovered
+ *  \param rightItems[in]       buffer to store right part of the rule
+ *  \param R[in,out]            buffer that contains association rules
+ *  \param numRulesFound[in,out] number of rules found on the previous step on input,
+ *                              number of found rules on output
+ *  \param found[out]           flag: true, if new rules are discovered
  *
-  */
+ *  \return false if the memory allocation failed
+ */
 template<typename algorithmFPType, CpuType cpu>
-void AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass(double minConfidence, ItemSetList<cpu> *L,
-                                                                     size_t right_size, size_t itemsSupport, size_t *leftItems, AssocRule<cpu> *R,
-    size_t& numRules, size_t& numLeft, size_t& numRight, size_t& numRulesFound,
-    bool& found)
+bool AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass(double minConfidence, const ItemSetIndex<cpu> *index,
+    size_t right_size, size_t itemsSupport, size_t *leftItems, size_t *rightItems, AssocRuleBuffer<cpu> &R,
+    size_t& numRulesFound, bool& found)
 {
-    size_t oldNumRules = numRules;
+    const size_t oldNumRules = R.rules.size();
     size_t n_rules_prev = numRulesFound;
-    size_t R_prev_begin = numRules - n_rules_prev;
+    size_t R_prev_begin = oldNumRules - n_rules_prev;
     found = false;
 
     /* Check each pair of rules found on previous step */
@@ -173,10 +151,11 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass(double minC
     {
         for (size_t j = i + 1; j < n_rules_prev; ++j)
         {
-            size_t firstIdx  = R_prev_begin + i;
-            size_t secondIdx = R_prev_begin + j;
-            size_t *first_items  = R[firstIdx ].right->items;
-            size_t *second_items = R[secondIdx].right->items;
+            /* Adding a rule can reallocate the buffer, so the references are taken on each iteration */
+            const AssocRule<cpu> &firstRule  = R.rules[R_prev_begin + i];
+            const AssocRule<cpu> &secondRule = R.rules[R_prev_begin + j];
+            const size_t *first_items  = firstRule.right->items;
+            const size_t *second_items = secondRule.right->items;
             /* Check that (right_size-2) items of first rule's right part
                and second rule's right part are equal */
             if (right_size > 2)
@@ -188,110 +167,217 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass(double minC
                 if (first_items[right_size - 2] > second_items[right_size - 2]) { continue; }
             }
 
-            assocrules_itemset<cpu> iset(right_size, first_items, second_items[right_size - 2]);
-            const assocrules_itemset<cpu> *right_iset = findItemSet(right_size, iset.items, L[right_size - 1]);
-            first_items  = R[firstIdx ].left->items;
-            second_items = R[secondIdx].left->items;
+            for (size_t k = 0; k < right_size - 1; ++k) { rightItems[k] = first_items[k]; }
+            rightItems[right_size - 1] = second_items[right_size - 2];
+            const assocrules_itemset<cpu> *right_iset = index[right_size - 1].find(rightItems);
 
             size_t left_size;
-            setIntersection(first_items, R[firstIdx].left->size, second_items, R[secondIdx].left->size,
+            setIntersection(firstRule.left->items, firstRule.left->size, secondRule.left->items, secondRule.left->size,
                             leftItems, left_size);
             if (left_size < 1) { continue; }
 
-            const assocrules_itemset<cpu> *left_iset = findItemSet(left_size, leftItems, L[left_size - 1]);
+            const assocrules_itemset<cpu> *left_iset = index[left_size - 1].find(leftItems);
 
             double confidence = (double)itemsSupport / (double)(left_iset->support.get());
             if (confidence >= minConfidence)
             {
                 found = true;
-                R[numRules++].update(left_iset, right_iset, confidence);
-                numLeft  += left_size;
-                numRight += right_size;
+                if (!R.add(left_iset, right_iset, confidence)) { return false; }
             }
         }
     }
-    numRulesFound = numRules - oldNumRules;
+    numRulesFound = R.rules.size() - oldNumRules;
+    return true;
 }
 
 /**
  *  Generate association rules from "large" item sets
  *
  *  \param minConfidence[in]    minimum confidence
- *  \param L_size[in]           length of the array L
  *  \param minItemsetSize[in]   minimal number of items in the "large" itemsets
+ *  \param L_size[in]           length of the array L
  *  \param L[in]                structure that contains "large" itemsets
- *  \param R[out]               structure that contains association rules
+ *  \param R[out]               array of association rules
  *  \param numRules[out]        number of discovered association rules
  *  \param numLeft[out]         total number of items in the left parts of association rules
  *  \param numRight[out]        total number of items in the right parts of association rules
  *
+ *  \return false if the memory allocation failed
  */
 template<typename algorithmFPType, CpuType cpu>
 bool AssociationRulesKernel<apriori, algorithmFPType, cpu>::generateRules(double minConfidence, size_t minItemsetSize,
     size_t L_size, ItemSetList<cpu> *L,
-    AssocRule<cpu> *R, size_t& numRules, size_t& numLeft, size_t& numRight)
+    TArray<AssocRule<cpu>, cpu> &R, size_t& numRules, size_t& numLeft, size_t& numRight)
 {
     numRules = 0;
     numLeft  = 0;
     numRight = 0;
 
-    TArray<size_t, cpu> leftItemsAr(L_size);
-    size_t *leftItems = leftItemsAr.get();
-    if(!leftItems)
-        return false;
+    /* Hash indices of "large" itemsets used to look up the supports of the parts of the rules */
+    TArray<ItemSetIndex<cpu>, cpu> index(L_size);
+    if (!index.get()) { return false; }
+    for (size_t i = 0; i < L_size; ++i)
+    {
+        if (!index[i].build(L[i], i + 1)) { return false; }
+    }
 
-    /* Generate all association rules */
+    /* Collect the itemsets the rules are generated from */
     size_t startItemsetSize = 1;
     if (minItemsetSize > startItemsetSize) { startItemsetSize = minItemsetSize - 1; }
+    size_t nItemsets = 0;
     for (size_t iset_size = startItemsetSize; iset_size < L_size; ++iset_size)
     {
-        ItemSetList<cpu> &L_cur = L[iset_size];
+        nItemsets += L[iset_size].size;
+    }
+    if (nItemsets == 0) { return true; }
+
+    typedef const assocrules_itemset<cpu>* ItemsetConstPtr;
+    TArray<ItemsetConstPtr, cpu> itemsets(nItemsets);
+    if (!itemsets.get()) { return false; }
+    for (size_t iset_size = startItemsetSize, k = 0; iset_size < L_size; ++iset_size)
+    {
+        for (const auto *current = L[iset_size].start; current != NULL; current = current->next(), ++k)
+        {
+            itemsets[k] = current->itemSet();
+        }
+    }
+
+    /* Rules of each block of itemsets are collected into a separate buffer.
+       The buffers are merged in the order of the blocks, so the order of the rules
+       does not depend on the number of threads */
+    const size_t nBlocks = nItemsets / rulesItemsetsBlockSize + !!(nItemsets % rulesItemsetsBlockSize);
+    TArray<AssocRuleBuffer<cpu>, cpu> buffers(nBlocks);
+    if (!buffers.get()) { return false; }
 
-        for (const auto *current = L_cur.start; current != NULL; current = current->next())
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        TArray<size_t, cpu> leftItemsAr(L_size);
+        TArray<size_t, cpu> rightItemsAr(L_size);
+        DAAL_CHECK_THR(leftItemsAr.get() && rightItemsAr.get(), ErrorMemoryAllocationFailed);
+        size_t *leftItems  = leftItemsAr.get();
+        size_t *rightItems = rightItemsAr.get();
+        AssocRuleBuffer<cpu> &blockRules = buffers[iBlock];
+
+        const size_t iStart = iBlock * rulesItemsetsBlockSize;
+        const size_t iEnd = (iStart + rulesItemsetsBlockSize < nItemsets ? iStart + rulesItemsetsBlockSize : nItemsets);
+        for (size_t i = iStart; i < iEnd; ++i)
         {
-            const size_t *items = current->itemSet()->items;
-            size_t itemsSupport = current->itemSet()->support.get();
+            const size_t iset_size = itemsets[i]->size - 1;
+            const size_t *items = itemsets[i]->items;
+            size_t itemsSupport = itemsets[i]->support.get();
             size_t n_rules_prev = 0;
 
             /* Find rules that have 1 item in the right part */
-            firstPass(minConfidence, L, iset_size, items, itemsSupport,
-                      leftItems, R, numRules, numLeft, numRight, n_rules_prev);
+            DAAL_CHECK_THR(firstPass(minConfidence, index.get(), iset_size, items, itemsSupport,
+                                     leftItems, blockRules, n_rules_prev), ErrorMemoryAllocationFailed);
 
             bool found = (n_rules_prev > 0);
             for (size_t right_size = 2; right_size <= iset_size && found; ++right_size)
             {
                 /* Find rules that have right_size items in the right part */
-                nextPass(minConfidence, L, right_size, itemsSupport,
-                         leftItems, R, numRules, numLeft, numRight, n_rules_prev, found);
+                DAAL_CHECK_THR(nextPass(minConfidence, index.get(), right_size, itemsSupport,
+                                        leftItems, rightItems, blockRules, n_rules_prev, found), ErrorMemoryAllocationFailed);
             }
         }
+    });
+    if (!safeStat.ok()) { return false; }
+
+    /* Offsets of the buffers in the resulting array of rules */
+    TArray<size_t, cpu> offsets(nBlocks);
+    if (!offsets.get()) { return false; }
+    for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+    {
+        offsets[iBlock] = numRules;
+        numRules += buffers[iBlock].rules.size();
+        numLeft  += buffers[iBlock].numLeft;
+        numRight += buffers[iBlock].numRight;
     }
+    if (numRules == 0) { return true; }
+
+    if (!R.reset(numRules)) { return false; }
+    AssocRule<cpu> *rules = R.get();
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const services::Collection<AssocRule<cpu> > &blockRules = buffers[iBlock].rules;
+        AssocRule<cpu> *blockR = rules + offsets[iBlock];
+        for (size_t i = 0; i < blockRules.size(); ++i)
+        {
+            blockR[i] = blockRules[i];
+        }
+    });
     return true;
 }
 
+/**
+ *  Store association rules into the resulting tables.
+ *  Offsets of the blocks of rules in the tables are computed with the prefix sums of the numbers of items,
+ *  then the blocks are written in parallel
+ *
+ *  \param rulesArray[in]       array of pointers to the association rules in the order of output
+ *  \param numRules[in]         number of association rules
+ *  \param rleft[out]           table of the items in the left parts of the rules
+ *  \param rright[out]          table of the items in the right parts of the rules
+ *  \param rconf[out]           table of the rules confidences
+ */
 template<typename algorithmFPType, CpuType cpu>
-void AssociationRulesKernel<apriori, algorithmFPType, cpu>::setRules(AssocRule<cpu> **rulesArray, size_t numRules,
-                                                                     int *rleft, int *rright, algorithmFPType *rconf)
+Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::setRules(AssocRule<cpu> **rulesArray, size_t numRules,
+                                                                       int *rleft, int *rright, algorithmFPType *rconf)
 {
-    size_t i_rule = 0, i_left = 0, i_right = 0;
-    for (i_rule = 0; i_rule < numRules; ++i_rule)
+    const size_t nBlocks = numRules / rulesBlockSize + !!(numRules % rulesBlockSize);
+    TArray<size_t, cpu> leftOffsets(nBlocks + 1);
+    TArray<size_t, cpu> rightOffsets(nBlocks + 1);
+    DAAL_CHECK(leftOffsets.get() && rightOffsets.get(), ErrorMemoryAllocationFailed);
+
+    /* Number of items in the left and right parts of the rules of each block */
+    leftOffsets[0]  = 0;
+    rightOffsets[0] = 0;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
     {
-        size_t *leftItems  = rulesArray[i_rule]->left->items;
-        size_t  left_size   = rulesArray[i_rule]->left->size;
-        size_t *rightItems = rulesArray[i_rule]->right->items;
-        size_t  right_size  = rulesArray[i_rule]->right->size;
-        for (size_t iitem = 0; iitem < left_size; ++iitem, ++i_left)
+        const size_t iStart = iBlock * rulesBlockSize;
+        const size_t iEnd = (iStart + rulesBlockSize < numRules ? iStart + rulesBlockSize : numRules);
+        size_t nLeft = 0, nRight = 0;
+        for (size_t i_rule = iStart; i_rule < iEnd; ++i_rule)
         {
-            rleft[2 * i_left]     = i_rule;
-            rleft[2 * i_left + 1] = leftItems[iitem];
+            nLeft  += rulesArray[i_rule]->left->size;
+            nRight += rulesArray[i_rule]->right->size;
         }
-        for (size_t iitem = 0; iitem < right_size; ++iitem, ++i_right)
+        leftOffsets[iBlock + 1]  = nLeft;
+        rightOffsets[iBlock + 1] = nRight;
+    });
+
+    for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock)
+    {
+        leftOffsets[iBlock + 1]  += leftOffsets[iBlock];
+        rightOffsets[iBlock + 1] += rightOffsets[iBlock];
+    }
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStart = iBlock * rulesBlockSize;
+        const size_t iEnd = (iStart + rulesBlockSize < numRules ? iStart + rulesBlockSize : numRules);
+        size_t i_left  = leftOffsets[iBlock];
+        size_t i_right = rightOffsets[iBlock];
+        for (size_t i_rule = iStart; i_rule < iEnd; ++i_rule)
         {
-            rright[2 * i_right]     = i_rule;
-            rright[2 * i_right + 1] = rightItems[iitem];
+            const size_t *leftItems  = rulesArray[i_rule]->left->items;
+            const size_t  left_size  = rulesArray[i_rule]->left->size;
+            const size_t *rightItems = rulesArray[i_rule]->right->items;
+            const size_t  right_size = rulesArray[i_rule]->right->size;
+            for (size_t iitem = 0; iitem < left_size; ++iitem, ++i_left)
+            {
+                rleft[2 * i_left]     = i_rule;
+                rleft[2 * i_left + 1] = leftItems[iitem];
+            }
+            for (size_t iitem = 0; iitem < right_size; ++iitem, ++i_right)
+            {
+                rright[2 * i_right]     = i_rule;
+                rright[2 * i_right + 1] = rightItems[iitem];
+            }
+            rconf[i_rule] = (algorithmFPType)rulesArray[i_rule]->confidence;
         }
-        rconf[i_rule] = (algorithmFPType)rulesArray[i_rule]->confidence;
-    }
+    });
+    return Status();
 }
 
 } // namespace internal
@@ -84,22 +84,13 @@ Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::compute(const Nume
 
     if (parameter->discoverRules)
     {
-        size_t maxRulesNum = L[0].size * (L[0].size - 1);
-        for (size_t i = 1; i < L_size; i++)
-        {
-            size_t exp2LSize = ((size_t)1 << (i + 1)) - (size_t)2;
-            if (exp2LSize < 2) { exp2LSize = 2; }
-            maxRulesNum += L[i].size * (exp2LSize - 1) * (exp2LSize);
-        }
-
-        TArray<AssocRule<cpu>, cpu> R(maxRulesNum);
-        DAAL_CHECK(R.get(), ErrorMemoryAllocationFailed);
+        TArray<AssocRule<cpu>, cpu> R;
 
         size_t nRules = 0;            /*<! Number of association rules */
         size_t nLeft  = 0;            /*<! Number of items in left parts of the rules */
         size_t nRight = 0;            /*<! Number of items in right parts of the rules */
         double minConfidence = parameter->minConfidence;
-        DAAL_CHECK(generateRules(minConfidence, minItemsetSize, L_size, L.get(), R.get(), nRules, nLeft, nRight) && !!nRules, ErrorMemoryAllocationFailed);
+        DAAL_CHECK(generateRules(minConfidence, minItemsetSize, L_size, L.get(), R, nRules, nLeft, nRight) && !!nRules, ErrorMemoryAllocationFailed);
 
         NumericTable *leftItemsTable    = r[2];
         NumericTable *rightItemsTable   = r[3];
@@ -267,8 +258,7 @@ Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::writeRulesTableDat
     WriteOnlyColumns<algorithmFPType, cpu> mtConfidence(confidenceTable, 0, 0, nRules);
     DAAL_CHECK_BLOCK_STATUS(mtConfidence);
     algorithmFPType *confidence = mtConfidence.get();
-    setRules(rulesArray.get(), nRules, leftItems, rightItems, confidence);
-    return Status();
+    return setRules(rulesArray.get(), nRules, leftItems, rightItems, confidence);
 }
 
 } // namespace internal
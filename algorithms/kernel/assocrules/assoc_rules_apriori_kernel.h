@@ -99,29 +99,24 @@ protected:
      *  Auxiliary methods for association rules discovery
      */
 
-    /** Find item set in the list of item sets */
-    const assocrules_itemset<cpu> *findItemSet(size_t items_size, const size_t *items, const ItemSetList<cpu> &L_cur);
-
     /** Find intersection between two item sets */
     void setIntersection(const size_t *a, size_t aSize, const size_t *b, size_t bSize, size_t *c, size_t& cSize);
 
     /** Find rules containing 1 item on the right */
-    void firstPass(double minConfidence, ItemSetList<cpu> *L, size_t itemSetSize, const size_t *items, size_t itemsSupport,
-                   size_t *leftItems, AssocRule<cpu> *R, size_t& numRules,
-                   size_t& numLeft, size_t& numRight, size_t& numRulesFound);
+    bool firstPass(double minConfidence, const ItemSetIndex<cpu> *index, size_t itemSetSize, const size_t *items, size_t itemsSupport,
+                   size_t *leftItems, AssocRuleBuffer<cpu> &R, size_t& numRulesFound);
 
     /** Generate rules that have k+1 items on the right from the rules that have k items on the right */
-    void nextPass(double minConfidence, ItemSetList<cpu> *L, size_t right_size,
-                  size_t itemsSupport, size_t *leftItems, AssocRule<cpu> *R,
-                  size_t& numRules, size_t& numLeft, size_t& numRight, size_t& numRulesFound,
-                  bool& found);
+    bool nextPass(double minConfidence, const ItemSetIndex<cpu> *index, size_t right_size,
+                  size_t itemsSupport, size_t *leftItems, size_t *rightItems, AssocRuleBuffer<cpu> &R,
+                  size_t& numRulesFound, bool& found);
 
     /** Generate association rules from "large" item sets */
     bool generateRules(double minConfidence, size_t minItemsetSize, size_t L_size, ItemSetList<cpu> *L,
-                       AssocRule<cpu> *R, size_t& numRules, size_t& numLeft, size_t& numRight);
+                       TArray<AssocRule<cpu>, cpu> &R, size_t& numRules, size_t& numLeft, size_t& numRight);
 
     /** Store association rules into continuous memory */
-    void setRules(AssocRule<cpu> **R, size_t numRules, int *rleft, int *rright, algorithmFPType *rconf);
+    Status setRules(AssocRule<cpu> **R, size_t numRules, int *rleft, int *rright, algorithmFPType *rconf);
 };
 
 } // namespace internal
@@ -288,7 +288,7 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::prune(size_t imin_s,
     assocrules_transaction<cpu> **large_tran = data.large_tran;
     size_t numOfLargeTransactions = data.numOfLargeTransactions;
 
-    daal::threader_for(numOfLargeTransactions, numOfLargeTransactions, [ =, &tls](size_t i_tran)
+    daal::threader_for_size(numOfLargeTransactions, numOfLargeTransactions, [ =, &tls](size_t i_tran)
     {
         assocrules_transaction<cpu> *tran = large_tran[i_tran];
 
@@ -28,6 +28,7 @@
 #include "service_memory.h"
 #include "service_numeric_table.h"
 #include "service_sort.h"
+#include "services/collection.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -160,6 +161,107 @@ struct AssocRule
     double confidence;                   /*<! Rule's confidence */
 };
 
+/**
+ *  \brief Growable array of association rules that also counts the items in the left and right parts of the rules
+ */
+template<CpuType cpu>
+struct AssocRuleBuffer
+{
+    DAAL_NEW_DELETE();
+    AssocRuleBuffer() : numLeft(0), numRight(0) {}
+
+    /** \brief Add rule to the end of the buffer. Returns false if the memory allocation failed */
+    bool add(const assocrules_itemset<cpu> *left, const assocrules_itemset<cpu> *right, double confidence)
+    {
+        if (rules.size() == rules.capacity())
+        {
+            const size_t newCapacity = (rules.capacity() ? 2 * rules.capacity() : 64);
+            if (!rules.resize(newCapacity)) { return false; }
+        }
+        rules.push_back(AssocRule<cpu>(left, right, confidence));
+        numLeft  += left->size;
+        numRight += right->size;
+        return true;
+    }
+
+    services::Collection<AssocRule<cpu> > rules;  /*<! Association rules */
+    size_t numLeft;                               /*<! Number of items in the left parts of the rules */
+    size_t numRight;                              /*<! Number of items in the right parts of the rules */
+};
+
+/**
+ *  \brief Hash index over the "large" itemsets of the same size.
+ *         Used to look up the support of the subsets of an itemset during the rules discovery
+ */
+template<CpuType cpu>
+struct ItemSetIndex
+{
+    DAAL_NEW_DELETE();
+    ItemSetIndex() : _table(nullptr), _mask(0), _itemsetSize(0) {}
+
+    ~ItemSetIndex()
+    {
+        daal::services::internal::service_free<ItemsetConstPtr, cpu>(_table);
+    }
+
+    /** \brief Build the index over the list of itemsets that contain itemsetSize items each */
+    bool build(const ItemSetList<cpu> &list, size_t itemsetSize)
+    {
+        daal::services::internal::service_free<ItemsetConstPtr, cpu>(_table);
+        _itemsetSize = itemsetSize;
+
+        /* Open addressing table that is at most half full */
+        size_t capacity = 2;
+        while (capacity < 2 * list.size) { capacity <<= 1; }
+        _table = daal::services::internal::service_calloc<ItemsetConstPtr, cpu>(capacity);
+        if (!_table) { return false; }
+        _mask = capacity - 1;
+
+        for (const auto *node = list.start; node != NULL; node = node->next())
+        {
+            const assocrules_itemset<cpu> *itemSet = node->itemSet();
+            size_t pos = hash(itemSet->items) & _mask;
+            while (_table[pos]) { pos = (pos + 1) & _mask; }
+            _table[pos] = itemSet;
+        }
+        return true;
+    }
+
+    /** \brief Find the itemset with the given items. Returns NULL if there is no such itemset in the index */
+    const assocrules_itemset<cpu> *find(const size_t *items) const
+    {
+        for (size_t pos = hash(items) & _mask; _table[pos]; pos = (pos + 1) & _mask)
+        {
+            if (!assocrules_memcmp<cpu>(items, _table[pos]->items, _itemsetSize))
+            {
+                return _table[pos];
+            }
+        }
+        return NULL;
+    }
+
+protected:
+    typedef const assocrules_itemset<cpu> *ItemsetConstPtr;
+
+    size_t hash(const size_t *items) const
+    {
+        size_t h = _itemsetSize;
+        for (size_t i = 0; i < _itemsetSize; i++)
+        {
+            h ^= items[i] + 0x9e3779b9 + (h << 6) + (h >> 2);
+        }
+        return h;
+    }
+
+    ItemsetConstPtr *_table;    /*<! Table of pointers to the itemsets */
+    size_t _mask;               /*<! Table size minus one, the table size is a power of 2 */
+    size_t _itemsetSize;        /*<! Number of items in each itemset */
+
+private:
+    ItemSetIndex(const ItemSetIndex &);
+    ItemSetIndex &operator=(const ItemSetIndex &);
+};
+
 template <CpuType cpu>
 int compareItemsetsBySupport(const void *a, const void *b)
 {
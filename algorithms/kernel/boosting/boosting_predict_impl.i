@@ -26,6 +26,7 @@
 
 #include "service_memory.h"
 #include "service_numeric_table.h"
+#include "boosting_predict_stump_ensemble.h"
 
 namespace daal
 {
@@ -45,6 +46,20 @@ services::Status BoostingPredictKernel<algorithmFPType, cpu>::compute(const Nume
     const size_t nVectors  = xTable->getNumberOfRows();
     Model *boostModel = const_cast<Model *>(m);
     Parameter *parameter = const_cast<Parameter *>(par);
+    services::Status s;
+
+    /* Ensemble of decision stumps is applied to the data in one pass */
+    if (xTable->getDataLayout() != NumericTableIface::csrArray)
+    {
+        StumpEnsemble<algorithmFPType, cpu> stumps;
+        bool isFlattened = false;
+        DAAL_CHECK_STATUS(s, stumps.init(boostModel, nWeakLearners, xTable->getNumberOfColumns(), 1, isFlattened));
+        if (isFlattened)
+        {
+            stumps.setWeightedVotes(alpha);
+            return stumps.compute(xTable.get(), r);
+        }
+    }
 
     services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > rWeakTable(
         new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(1, nVectors));
@@ -55,7 +70,6 @@ services::Status BoostingPredictKernel<algorithmFPType, cpu>::compute(const Nume
 
     classifier::prediction::ResultPtr predictionRes(new classifier::prediction::Result());
     predictionRes->set(classifier::prediction::prediction, rWeakTable);
-    services::Status s;
     DAAL_CHECK_STATUS(s, learnerPredict->setResult(predictionRes));
 
     const algorithmFPType zero = (algorithmFPType)0.0;
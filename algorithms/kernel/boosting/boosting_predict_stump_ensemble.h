@@ -0,0 +1,181 @@
+/* file: boosting_predict_stump_ensemble.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/*
+//++
+//  Declaration of the boosting model of decision stumps flattened into arrays
+//  for the prediction in one pass over the input data.
+//--
+*/
+
+#ifndef __BOOSTING_PREDICT_STUMP_ENSEMBLE_H__
+#define __BOOSTING_PREDICT_STUMP_ENSEMBLE_H__
+
+#include "boosting_model.h"
+#include "stump_model.h"
+#include "threading.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace boosting
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::internal;
+
+/* Number of observations processed by all the weak learners at once */
+const size_t stumpEnsembleBlockSize = 256;
+
+/**
+ *  \brief Weak learners of the boosting model flattened into arrays when all of them are decision stumps.
+ *         The i-th stump adds leftValue[i] to the output (i mod nOutputs) of an observation
+ *         if its splitFeature[i]-th feature is less than splitValue[i], and rightValue[i] otherwise.
+ *         The ensemble evaluates the stumps directly, so the prediction algorithm set in
+ *         parameter->weakLearnerPrediction is not called when the ensemble is used
+ */
+template <typename algorithmFPType, CpuType cpu>
+class StumpEnsemble
+{
+public:
+    StumpEnsemble() : _nStumps(0), _nOutputs(1) {}
+
+    /**
+     *  Flattens weak learners of the boosting model
+     *  \param[in]  boostModel      Boosting model
+     *  \param[in]  nWeakLearners   Number of weak learners to flatten
+     *  \param[in]  nFeatures       Number of features in the input data set
+     *  \param[in]  nOutputs        Number of outputs of the ensemble
+     *  \param[out] isFlattened     False if some weak learner is not a decision stump applicable to the input data set
+     */
+    services::Status init(const Model *boostModel, size_t nWeakLearners, size_t nFeatures, size_t nOutputs, bool &isFlattened)
+    {
+        isFlattened = false;
+        _splitFeature.reset(nWeakLearners);
+        _values.reset(3 * nWeakLearners);
+        DAAL_CHECK_MALLOC(_splitFeature.get() && _values.get());
+
+        algorithmFPType *splitValue = _values.get();
+        algorithmFPType *leftValue  = splitValue + nWeakLearners;
+        algorithmFPType *rightValue = leftValue  + nWeakLearners;
+        for (size_t i = 0; i < nWeakLearners; i++)
+        {
+            weak_learner::ModelPtr learnerModel = boostModel->getWeakLearnerModel(i);
+            stump::Model *stumpModel = dynamic_cast<stump::Model *>(learnerModel.get());
+            if (!stumpModel || stumpModel->getSplitFeature() >= nFeatures)
+                return services::Status();
+
+            _splitFeature[i] = stumpModel->getSplitFeature();
+            splitValue[i] = stumpModel->getSplitValue<algorithmFPType>();
+            leftValue[i]  = stumpModel->getLeftSubsetAverage<algorithmFPType>();
+            rightValue[i] = stumpModel->getRightSubsetAverage<algorithmFPType>();
+        }
+        _nStumps  = nWeakLearners;
+        _nOutputs = nOutputs;
+        isFlattened = true;
+        return services::Status();
+    }
+
+    /**
+     *  Replaces the responses of the stumps with their signs multiplied by the weights of the weak learners
+     *  \param[in] alpha    Weights of the weak learners
+     */
+    void setWeightedVotes(const algorithmFPType *alpha)
+    {
+        const algorithmFPType zero = (algorithmFPType)0.0;
+        algorithmFPType *leftValue  = _values.get() + _nStumps;
+        algorithmFPType *rightValue = leftValue + _nStumps;
+        for (size_t i = 0; i < _nStumps; i++)
+        {
+            leftValue[i]  = ((leftValue[i]  > zero) ? alpha[i] : -alpha[i]);
+            rightValue[i] = ((rightValue[i] > zero) ? alpha[i] : -alpha[i]);
+        }
+    }
+
+    /**
+     *  Computes the outputs of the ensemble. Blocks of observations are processed in parallel,
+     *  each block is read once and all the stumps are applied to it
+     *  \param[in]  xTable  Input data set
+     *  \param[out] r       Outputs of the ensemble, nOutputs values per observation
+     */
+    services::Status compute(NumericTable *xTable, algorithmFPType *r) const
+    {
+        const size_t nVectors  = xTable->getNumberOfRows();
+        const size_t nFeatures = xTable->getNumberOfColumns();
+        size_t nBlocks = nVectors / stumpEnsembleBlockSize;
+        if (nBlocks * stumpEnsembleBlockSize < nVectors) { nBlocks++; }
+
+        daal::SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+        {
+            const size_t startRow = iBlock * stumpEnsembleBlockSize;
+            const size_t nRows = ((startRow + stumpEnsembleBlockSize > nVectors) ? nVectors - startRow : stumpEnsembleBlockSize);
+
+            ReadRows<algorithmFPType, cpu> xBlock(xTable, startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBlock);
+            computeBlock(xBlock.get(), nRows, nFeatures, r + startRow * _nOutputs);
+        } );
+        return safeStat.detach();
+    }
+
+private:
+    void computeBlock(const algorithmFPType *x, size_t nRows, size_t nFeatures, algorithmFPType *r) const
+    {
+        daal::services::internal::service_memset<algorithmFPType, cpu>(r, (algorithmFPType)0.0, nRows * _nOutputs);
+
+        const algorithmFPType *splitValue = _values.get();
+        const algorithmFPType *leftValue  = splitValue + _nStumps;
+        const algorithmFPType *rightValue = leftValue  + _nStumps;
+        for (size_t i = 0, iOutput = 0; i < _nStumps; i++)
+        {
+            const algorithmFPType *xi = x + _splitFeature[i];
+            algorithmFPType *ri = r + iOutput;
+            const algorithmFPType split = splitValue[i];
+            const algorithmFPType left  = leftValue[i];
+            const algorithmFPType right = rightValue[i];
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nRows; j++)
+            {
+                ri[j * _nOutputs] += ((xi[j * nFeatures] < split) ? left : right);
+            }
+            if (++iOutput == _nOutputs) { iOutput = 0; }
+        }
+    }
+
+    size_t _nStumps;
+    size_t _nOutputs;
+    TArray<size_t, cpu> _splitFeature;
+    TArray<algorithmFPType, cpu> _values;    /* Split values, "left" and "right" responses of the stumps */
+};
+
+}
+}
+}
+}
+}
+
+#endif
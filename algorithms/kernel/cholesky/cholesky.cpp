@@ -23,6 +23,7 @@
 
 #include "cholesky_types.h"
 #include "serialization_utils.h"
+#include "daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -37,6 +38,8 @@ namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_CHOLESKY_RESULT_ID);
 
+Parameter::Parameter(UpdateType _updateType) : updateType(_updateType) {}
+
 Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
 
 /**
@@ -72,6 +75,27 @@ Status Input::check(const daal::algorithms::Parameter *par, int method) const
     DAAL_CHECK(inTable->getNumberOfRows() , ErrorIncorrectNumberOfObservations);
     DAAL_CHECK(inTable->getNumberOfColumns(), ErrorIncorrectNumberOfFeatures);
 
+    if(method == rankUpdateDense)
+    {
+        DAAL_CHECK(par, ErrorNullParameterNotSupported);
+        const Parameter *parameter = static_cast<const Parameter *>(par);
+        DAAL_CHECK_EX(parameter->updateType == update || parameter->updateType == downdate, ErrorIncorrectParameter, ParameterName, updateTypeStr());
+
+        NumericTablePtr factorTable = get(inputCholeskyFactor);
+        DAAL_CHECK_EX(factorTable.get(), ErrorNullInputNumericTable, ArgumentName, inputCholeskyFactorStr());
+        DAAL_CHECK_EX(factorTable->getNumberOfColumns() == inTable->getNumberOfColumns() &&
+                      factorTable->getNumberOfRows() == inTable->getNumberOfColumns(),
+                      ErrorIncorrectSizeOfInputNumericTable, ArgumentName, inputCholeskyFactorStr());
+
+        const int fLayoutInt = (int)factorTable->getDataLayout();
+        if(fLayoutInt & data_management::packed_mask)
+        {
+            DAAL_CHECK_EX(factorTable->getDataLayout() == NumericTableIface::lowerPackedTriangularMatrix,
+                          ErrorIncorrectTypeOfInputNumericTable, ArgumentName, inputCholeskyFactorStr());
+        }
+        return Status();
+    }
+
     NumericTableIface::StorageLayout iLayout = inTable->getDataLayout();
 
     DAAL_CHECK(inTable->getNumberOfColumns() == inTable->getNumberOfRows(), ErrorIncorrectSizeOfInputNumericTable);
@@ -51,11 +51,11 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Input *input = static_cast<Input *>(_in);
     Result *result = static_cast<Result *>(_res);
 
-    daal::algorithms::Parameter *par = NULL;
+    daal::algorithms::Parameter *par = _par;
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::CholeskyKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, input->get(data).get(),
-                                                                              result->get(choleskyFactor).get(), par);
+                       input->get(inputCholeskyFactor).get(), result->get(choleskyFactor).get(), par);
 }
 
 }
@@ -43,7 +43,8 @@ bool isFull(NumericTableIface::StorageLayout rLayout);
  *  \brief Kernel for Cholesky calculation
  */
 template<typename algorithmFPType, Method method, CpuType cpu>
-Status CholeskyKernel<algorithmFPType, method, cpu>::compute(NumericTable *aTable, NumericTable *r, const daal::algorithms::Parameter *par)
+Status CholeskyKernel<algorithmFPType, method, cpu>::compute(NumericTable *aTable, NumericTable *factor, NumericTable *r,
+                                                            const daal::algorithms::Parameter *par)
 {
     DAAL_INT dim = (DAAL_INT)(aTable->getNumberOfColumns());   /* Dimension of input feature vectors */
 
@@ -47,7 +47,7 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 class CholeskyKernel : public Kernel
 {
 public:
-    services::Status compute(NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par);
+    services::Status compute(NumericTable *a, NumericTable *factor, NumericTable *r, const daal::algorithms::Parameter *par);
 
 private:
     services::Status copyMatrix(NumericTableIface::StorageLayout iLayout, const algorithmFPType *pA,
@@ -59,6 +59,16 @@ private:
                                    DAAL_INT dim) const;
 };
 
+/**
+ *  \brief Kernel for the rank-k update or downdate of the Cholesky factor
+ */
+template<typename algorithmFPType, CpuType cpu>
+class CholeskyKernel<algorithmFPType, rankUpdateDense, cpu> : public Kernel
+{
+public:
+    services::Status compute(NumericTable *x, NumericTable *factor, NumericTable *r, const daal::algorithms::Parameter *par);
+};
+
 } // namespace daal::internal
 }
 }
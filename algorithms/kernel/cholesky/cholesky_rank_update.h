@@ -0,0 +1,125 @@
+/* file: cholesky_rank_update.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration of template function that modifies the Cholesky factor
+//  by the rank-k update or downdate.
+//--
+
+
+#ifndef __CHOLESKY_RANK_UPDATE_H__
+#define __CHOLESKY_RANK_UPDATE_H__
+
+#include "service_math.h"
+#include "service_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace cholesky
+{
+namespace internal
+{
+
+/**
+ *  \brief Computes the Cholesky factor of the matrix A + X'*X or A - X'*X from the factor L of the matrix A = L*L'.
+ *         Each row of X is applied as a sequence of Givens rotations in case of the update
+ *         and as a sequence of hyperbolic rotations in case of the downdate.
+ *         Rotations of all rows of X are applied to one column of L at a time,
+ *         so the column is read from the factor and written back only once.
+ *
+ *  \param dim[in]          Dimension of the matrix A
+ *  \param l[in,out]        Lower triangle matrix L of size dim x dim stored by rows
+ *  \param nVectors[in]     Number of rows in the matrix X
+ *  \param x[in,out]        Matrix X of size nVectors x dim stored by rows. Contents are destroyed on output
+ *  \param downdate[in]     Flag. True if the factor of the matrix A - X'*X is computed
+ *  \param column[out]      Work array of size dim
+ *
+ *  \return Index of the first column, starting from 1, that cannot be computed because
+ *          the modified matrix is not positive definite; 0 on success
+ */
+template <typename algorithmFPType, CpuType cpu>
+size_t modifyCholeskyFactor(size_t dim, algorithmFPType *l, size_t nVectors, algorithmFPType *x, bool downdate,
+                            algorithmFPType *column)
+{
+    for (size_t k = 0; k < dim; k++)
+    {
+        for (size_t i = k; i < dim; i++)
+        {
+            column[i] = l[i * dim + k];
+        }
+
+        for (size_t v = 0; v < nVectors; v++)
+        {
+            algorithmFPType *xv = x + v * dim;
+            const algorithmFPType xk = xv[k];
+            if (xk == (algorithmFPType)0) { continue; }
+
+            const algorithmFPType lkk = column[k];
+            if (!downdate)
+            {
+                const algorithmFPType r = daal::internal::Math<algorithmFPType, cpu>::sSqrt(lkk * lkk + xk * xk);
+                const algorithmFPType c = lkk / r;
+                const algorithmFPType s = xk / r;
+                column[k] = r;
+
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t i = k + 1; i < dim; i++)
+                {
+                    const algorithmFPType li = column[i];
+                    column[i] = c * li + s * xv[i];
+                    xv[i] = c * xv[i] - s * li;
+                }
+            }
+            else
+            {
+                const algorithmFPType r2 = (lkk - xk) * (lkk + xk);
+                if (!(r2 > (algorithmFPType)0)) { return k + 1; }
+
+                const algorithmFPType r = daal::internal::Math<algorithmFPType, cpu>::sSqrt(r2);
+                const algorithmFPType invC = lkk / r;
+                const algorithmFPType s = xk / lkk;
+                const algorithmFPType c = r / lkk;
+                column[k] = r;
+
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t i = k + 1; i < dim; i++)
+                {
+                    const algorithmFPType li = (column[i] - s * xv[i]) * invC;
+                    column[i] = li;
+                    xv[i] = c * xv[i] - s * li;
+                }
+            }
+        }
+
+        for (size_t i = k; i < dim; i++)
+        {
+            l[i * dim + k] = column[i];
+        }
+    }
+    return 0;
+}
+
+} // namespace internal
+} // namespace cholesky
+} // namespace algorithms
+} // namespace daal
+
+#endif
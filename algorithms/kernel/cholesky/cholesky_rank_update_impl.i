@@ -0,0 +1,105 @@
+/* file: cholesky_rank_update_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Implementation of the rank-k update and downdate of the Cholesky factor.
+//--
+
+
+#include "service_numeric_table.h"
+#include "service_memory.h"
+#include "cholesky_rank_update.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace cholesky
+{
+namespace internal
+{
+
+/* Number of rows of the modification matrix processed at once */
+const size_t rankUpdateBlockSize = 512;
+
+/**
+ *  \brief Kernel for the rank-k update or downdate of the Cholesky factor
+ */
+template<typename algorithmFPType, CpuType cpu>
+Status CholeskyKernel<algorithmFPType, rankUpdateDense, cpu>::compute(NumericTable *xTable, NumericTable *factorTable, NumericTable *r,
+                                                                      const daal::algorithms::Parameter *par)
+{
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    const bool isDowndate = (parameter->updateType == downdate);
+    const size_t dim = xTable->getNumberOfColumns();
+    const size_t nVectors = xTable->getNumberOfRows();
+    const size_t nRowsInBlock = (nVectors < rankUpdateBlockSize ? nVectors : rankUpdateBlockSize);
+
+    TArray<algorithmFPType, cpu> lArray(dim * dim);
+    TArray<algorithmFPType, cpu> columnArray(dim);
+    TArray<algorithmFPType, cpu> xArray(nRowsInBlock * dim);
+    DAAL_CHECK(lArray.get() && columnArray.get() && xArray.get(), ErrorMemoryAllocationFailed);
+    algorithmFPType *l = lArray.get();
+
+    /* Copy the lower triangle of the input factor */
+    {
+        ReadRows<algorithmFPType, cpu> factorRows(factorTable, 0, dim);
+        DAAL_CHECK_BLOCK_STATUS(factorRows);
+        const algorithmFPType *f = factorRows.get();
+        for (size_t i = 0; i < dim; i++)
+        {
+            for (size_t j = 0; j <= i; j++)
+            {
+                l[i * dim + j] = f[i * dim + j];
+            }
+            for (size_t j = i + 1; j < dim; j++)
+            {
+                l[i * dim + j] = 0;
+            }
+        }
+    }
+
+    /* Rows of the modification matrix are copied because the rotations overwrite them */
+    for (size_t iRow = 0; iRow < nVectors; iRow += nRowsInBlock)
+    {
+        const size_t nRows = (nVectors - iRow < nRowsInBlock ? nVectors - iRow : nRowsInBlock);
+        ReadRows<algorithmFPType, cpu> xRows(xTable, iRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(xRows);
+        const size_t xSizeInBytes = nRows * dim * sizeof(algorithmFPType);
+        daal::services::daal_memcpy_s(xArray.get(), xSizeInBytes, xRows.get(), xSizeInBytes);
+
+        const size_t minor = modifyCholeskyFactor<algorithmFPType, cpu>(dim, l, nRows, xArray.get(), isDowndate, columnArray.get());
+        if (minor)
+        {
+            return Status(Error::create(services::ErrorInputMatrixHasNonPositiveMinor, services::Minor, (int)minor));
+        }
+    }
+
+    WriteRows<algorithmFPType, cpu> rRows(r, 0, dim);
+    DAAL_CHECK_BLOCK_STATUS(rRows);
+    const size_t lSizeInBytes = dim * dim * sizeof(algorithmFPType);
+    daal::services::daal_memcpy_s(rRows.get(), lSizeInBytes, l, lSizeInBytes);
+    return Status();
+}
+
+} // namespace daal::internal
+} // namespace daal::cholesky
+}
+} // namespace daal
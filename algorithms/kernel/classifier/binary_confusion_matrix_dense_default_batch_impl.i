@@ -26,6 +26,8 @@
 
 #include "service_memory.h"
 #include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "threading.h"
 
 namespace daal
 {
@@ -44,55 +46,151 @@ using namespace daal::internal;
 using namespace daal::services;
 using namespace daal::services::internal;
 
+/* Number of labels processed by one thread at once */
+const size_t blockSizeDefault = 4096;
+
+/* TLS structure with the partial confusion matrix of the thread */
+struct tls_counts_t
+{
+    size_t counts[4];
+
+    tls_counts_t()
+    {
+        counts[0] = counts[1] = counts[2] = counts[3] = 0;
+    }
+};
+
 template<Method method, typename algorithmFPType, CpuType cpu>
 services::Status BinaryConfusionMatrixKernel<method, algorithmFPType, cpu>::compute(const NumericTable *predictedLabelsTable,
                                                                                     const NumericTable *groundTruthLabelsTable,
                                                                                     NumericTable *confusionMatrixTable,
                                                                                     NumericTable *accuracyMeasuresTable,
                                                                                     const binary_confusion_matrix::Parameter *parameter)
+{
+    double counts[4] = { 0.0, 0.0, 0.0, 0.0 };
+    Status s = accumulateCounts(predictedLabelsTable, groundTruthLabelsTable, counts);
+    if(!s) return s;
+
+    return computeAccuracyMeasures(counts, confusionMatrixTable, accuracyMeasuresTable, parameter);
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::Status BinaryConfusionMatrixKernel<method, algorithmFPType, cpu>::computeConfusionMatrix(const NumericTable *predictedLabelsTable,
+                                                                                                   const NumericTable *groundTruthLabelsTable,
+                                                                                                   NumericTable *partialConfusionMatrixTable)
+{
+    const size_t nClasses = 2;
+    WriteRows<double, cpu> mtPartialConfusionMatrix(partialConfusionMatrixTable, 0, nClasses);
+    DAAL_CHECK_BLOCK_STATUS(mtPartialConfusionMatrix);
+
+    return accumulateCounts(predictedLabelsTable, groundTruthLabelsTable, mtPartialConfusionMatrix.get());
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::Status BinaryConfusionMatrixKernel<method, algorithmFPType, cpu>::finalizeCompute(const NumericTable *partialConfusionMatrixTable,
+                                                                                            NumericTable *confusionMatrixTable,
+                                                                                            NumericTable *accuracyMeasuresTable,
+                                                                                            const binary_confusion_matrix::Parameter *parameter)
+{
+    const size_t nClasses = 2;
+    ReadRows<double, cpu> mtPartialConfusionMatrix(*const_cast<NumericTable *>(partialConfusionMatrixTable), 0, nClasses);
+    DAAL_CHECK_BLOCK_STATUS(mtPartialConfusionMatrix);
+
+    return computeAccuracyMeasures(mtPartialConfusionMatrix.get(), confusionMatrixTable, accuracyMeasuresTable, parameter);
+}
+
+/**
+ *  Adds the confusion matrix of the given labels to counts.
+ *  Labels are processed by blocks in parallel, each thread tallies its blocks into its own partial matrix,
+ *  the partial matrices are merged once at the end
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::Status BinaryConfusionMatrixKernel<method, algorithmFPType, cpu>::accumulateCounts(const NumericTable *predictedLabelsTable,
+                                                                                             const NumericTable *groundTruthLabelsTable,
+                                                                                             double *counts)
 {
     const algorithmFPType zero = 0.0;
     const size_t nVectors = predictedLabelsTable->getNumberOfRows();
 
-    /* Get input data */
-    ReadColumns<algorithmFPType, cpu> mtPredictedLabels(*const_cast<NumericTable*>(predictedLabelsTable), 0, 0, nVectors);
-    DAAL_CHECK_BLOCK_STATUS(mtPredictedLabels);
-    ReadColumns<algorithmFPType, cpu> mtGroundTruthLabels(*const_cast<NumericTable*>(groundTruthLabelsTable), 0, 0, nVectors);
-    DAAL_CHECK_BLOCK_STATUS(mtGroundTruthLabels);
+    const size_t blockSize = (nVectors > blockSizeDefault) ? blockSizeDefault : nVectors;
+    const size_t nBlocks = (blockSize ? nVectors / blockSize + !!(nVectors % blockSize) : 0);
+
+    daal::tls<tls_counts_t *> tlsCounts([ = ]()
+    {
+        return new tls_counts_t();
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [ & ](int iBlock)
+    {
+        tls_counts_t *localCounts = tlsCounts.local();
+        DAAL_CHECK_THR(localCounts, ErrorMemoryAllocationFailed);
+
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows = (startRow + blockSize > nVectors) ? nVectors - startRow : blockSize;
+
+        /* Get input data */
+        ReadColumns<algorithmFPType, cpu> mtPredictedLabels(*const_cast<NumericTable *>(predictedLabelsTable), 0, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtPredictedLabels);
+        ReadColumns<algorithmFPType, cpu> mtGroundTruthLabels(*const_cast<NumericTable *>(groundTruthLabelsTable), 0, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtGroundTruthLabels);
+
+        const algorithmFPType *predictedLabelsData = mtPredictedLabels.get();
+        const algorithmFPType *groundTruthLabelsData = mtGroundTruthLabels.get();
+        size_t *localConfusionMatrix = localCounts->counts;
+
+        /* Compute confusion matrix for two-class classifier */
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const int predictedLabel   = ((predictedLabelsData[i]   > zero) ? 0 : 1);
+            const int groundTruthLabel = ((groundTruthLabelsData[i] > zero) ? 0 : 1);
+            localConfusionMatrix[groundTruthLabel * 2 + predictedLabel]++;
+        }
+    } );
+
+    tlsCounts.reduce([ & ](tls_counts_t *localCounts)
+    {
+        if(!localCounts) { return; }
+        for (size_t i = 0; i < 4; i++)
+        {
+            counts[i] += double(localCounts->counts[i]);
+        }
+        delete localCounts;
+    } );
+
+    return safeStat.detach();
+}
 
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::Status BinaryConfusionMatrixKernel<method, algorithmFPType, cpu>::computeAccuracyMeasures(const double *counts,
+                                                                                                    NumericTable *confusionMatrixTable,
+                                                                                                    NumericTable *accuracyMeasuresTable,
+                                                                                                    const binary_confusion_matrix::Parameter *parameter)
+{
     /* Get memory to write the results */
     const size_t nClasses = 2;
-    WriteOnlyRows<int, cpu> mtConfusionMatrix(confusionMatrixTable, 0, nClasses);
+    WriteOnlyRows<algorithmFPType, cpu> mtConfusionMatrix(confusionMatrixTable, 0, nClasses);
     DAAL_CHECK_BLOCK_STATUS(mtConfusionMatrix);
     WriteOnlyRows<algorithmFPType, cpu> mtAccuracyMeasures(accuracyMeasuresTable, 0, 1);
     DAAL_CHECK_BLOCK_STATUS(mtAccuracyMeasures);
 
-    const algorithmFPType *predictedLabelsData = mtPredictedLabels.get();
-    const algorithmFPType *groundTruthLabelsData = mtGroundTruthLabels.get();
-    int *confusionMatrixData = mtConfusionMatrix.get();
+    algorithmFPType *confusionMatrixData = mtConfusionMatrix.get();
     algorithmFPType *accuracyMeasuresData = mtAccuracyMeasures.get();
 
     algorithmFPType beta = parameter->beta;
     algorithmFPType beta2 = beta * beta;
-    service_memset<int, cpu>(confusionMatrixData, 0, nClasses * nClasses);
-
-    /* Compute confusion matrix for two-class classifier */
 
-   PRAGMA_IVDEP
-   PRAGMA_VECTOR_ALWAYS
-    for (size_t i = 0; i < nVectors; i++)
+    for (size_t i = 0; i < nClasses * nClasses; i++)
     {
-        const int predictedLabel   = ((predictedLabelsData[i]   > zero) ? 0 : 1);
-        const int groundTruthLabel = ((groundTruthLabelsData[i] > zero) ? 0 : 1);
-        confusionMatrixData[groundTruthLabel * 2 + predictedLabel]++;
+        confusionMatrixData[i] = algorithmFPType(counts[i]);
     }
 
-    const algorithmFPType tp(confusionMatrixData[0]);
-    const algorithmFPType fn(confusionMatrixData[1]);
-    const algorithmFPType fp(confusionMatrixData[2]);
-    const algorithmFPType tn(confusionMatrixData[3]);
+    const algorithmFPType tp(counts[0]);
+    const algorithmFPType fn(counts[1]);
+    const algorithmFPType fp(counts[2]);
+    const algorithmFPType tn(counts[3]);
 
-    const algorithmFPType invNVectors = 1.0 / algorithmFPType(nVectors);
+    const algorithmFPType invNVectors = 1.0 / algorithmFPType(counts[0] + counts[1] + counts[2] + counts[3]);
     /* Accuracy */
     accuracyMeasuresData[0] = (tp + tn) * invNVectors;
     /* Precision */
@@ -0,0 +1,44 @@
+/* file: binary_confusion_matrix_dense_default_online_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of binary confusion matrix in the online processing mode.
+//--
+*/
+
+#include "binary_confusion_matrix_dense_default_online_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace classifier
+{
+namespace quality_metric
+{
+namespace binary_confusion_matrix
+{
+namespace interface1
+{
+template class OnlineContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+}
+}
+}
+}
+}
+}
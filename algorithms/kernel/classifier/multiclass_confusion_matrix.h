@@ -56,6 +56,47 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     return services::Status();
 }
 
+/**
+ * Allocates memory for storing final results of the quality metric algorithm in the online processing mode
+ * \param[in] partialResult Pointer to the partial result structure
+ * \param[in] parameter     Pointer to the parameter structure
+ * \param[in] method        Computation method of the algorithm
+ */
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+{
+    return allocate<algorithmFPType>((const daal::algorithms::Input *)NULL, parameter, method);
+}
+
+/**
+ * Allocates memory for storing partial results of the quality metric algorithm.
+ * Counts are accumulated in double precision to stay exact for large numbers of observations
+ * \param[in] input     Pointer to the input objects structure
+ * \param[in] parameter Pointer to the parameter structure
+ * \param[in] method    Computation method of the algorithm
+ */
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Parameter *classifierParam = static_cast<const Parameter *>(parameter);
+    size_t nClasses = classifierParam->nClasses;
+    set(partialConfusionMatrix, data_management::NumericTablePtr(new data_management::HomogenNumericTable<double>(nClasses, nClasses,
+                                                                 data_management::NumericTableIface::doAllocate, 0.0)));
+    return services::Status();
+}
+
+/**
+ * Initializes partial results of the quality metric algorithm with zero counts
+ * \param[in] input     Pointer to the input objects structure
+ * \param[in] parameter Pointer to the parameter structure
+ * \param[in] method    Computation method of the algorithm
+ */
+template<typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    return get(partialConfusionMatrix)->assign(0.0);
+}
+
 } // namespace multiclass_confusion_matrix
 } // namespace quality_metric
 } // namespace classifier
@@ -26,6 +26,8 @@
 
 #include "service_memory.h"
 #include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "threading.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -44,6 +46,26 @@ namespace multiclass_confusion_matrix
 namespace internal
 {
 
+/* Number of labels processed by one thread at once */
+const size_t blockSizeDefault = 4096;
+
+/* TLS structure with the partial confusion matrix of the thread */
+template<CpuType cpu>
+struct tls_counts_t
+{
+    size_t *counts;
+
+    tls_counts_t(size_t nClasses)
+    {
+        counts = service_scalable_calloc<size_t, cpu>(nClasses * nClasses);
+    }
+
+    ~tls_counts_t()
+    {
+        if(counts) { service_scalable_free<size_t, cpu>(counts); counts = 0; }
+    }
+};
+
 template<Method method, typename algorithmFPType, CpuType cpu>
 Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::compute(const NumericTable *predictedLabelsTable,
                                                                               const NumericTable *groundTruthLabelsTable,
@@ -51,44 +73,138 @@ Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::compute(co
                                                                               NumericTable *accuracyMeasuresTable,
                                                                               const multiclass_confusion_matrix::Parameter *parameter)
 {
-    const algorithmFPType zero = 0.0;
+    const size_t nClasses = parameter->nClasses;
+
+    TArrayCalloc<double, cpu> aCounts(nClasses * nClasses);
+    DAAL_CHECK_MALLOC(aCounts.get());
+
+    Status s = accumulateCounts(predictedLabelsTable, groundTruthLabelsTable, nClasses, aCounts.get());
+    if(!s) return s;
+
+    return computeAccuracyMeasures(aCounts.get(), confusionMatrixTable, accuracyMeasuresTable, parameter);
+}
 
+template<Method method, typename algorithmFPType, CpuType cpu>
+Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::computeConfusionMatrix(const NumericTable *predictedLabelsTable,
+                                                                                             const NumericTable *groundTruthLabelsTable,
+                                                                                             NumericTable *partialConfusionMatrixTable)
+{
+    const size_t nClasses = partialConfusionMatrixTable->getNumberOfColumns();
+    WriteRows<double, cpu> mtPartialConfusionMatrix(partialConfusionMatrixTable, 0, nClasses);
+    DAAL_CHECK_BLOCK_STATUS(mtPartialConfusionMatrix);
+
+    return accumulateCounts(predictedLabelsTable, groundTruthLabelsTable, nClasses, mtPartialConfusionMatrix.get());
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::finalizeCompute(const NumericTable *partialConfusionMatrixTable,
+                                                                                      NumericTable *confusionMatrixTable,
+                                                                                      NumericTable *accuracyMeasuresTable,
+                                                                                      const multiclass_confusion_matrix::Parameter *parameter)
+{
+    const size_t nClasses = parameter->nClasses;
+    ReadRows<double, cpu> mtPartialConfusionMatrix(*const_cast<NumericTable *>(partialConfusionMatrixTable), 0, nClasses);
+    DAAL_CHECK_BLOCK_STATUS(mtPartialConfusionMatrix);
+
+    return computeAccuracyMeasures(mtPartialConfusionMatrix.get(), confusionMatrixTable, accuracyMeasuresTable, parameter);
+}
+
+/**
+ *  Adds the confusion matrix of the given labels to counts.
+ *  Labels are processed by blocks in parallel, each thread tallies its blocks into its own partial matrix,
+ *  the partial matrices are merged once at the end
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::accumulateCounts(const NumericTable *predictedLabelsTable,
+                                                                                       const NumericTable *groundTruthLabelsTable,
+                                                                                       size_t nClasses, double *counts)
+{
     const size_t nVectors = predictedLabelsTable->getNumberOfRows();
 
-    /* Get input data */
-    ReadColumns<algorithmFPType, cpu> mtPredictedLabels(*const_cast<NumericTable*>(predictedLabelsTable), 0, 0, nVectors);
-    DAAL_CHECK_BLOCK_STATUS(mtPredictedLabels);
-    ReadColumns<algorithmFPType, cpu> mtGroundTruthLabels(*const_cast<NumericTable*>(groundTruthLabelsTable), 0, 0, nVectors);
-    DAAL_CHECK_BLOCK_STATUS(mtGroundTruthLabels);
+    const size_t blockSize = (nVectors > blockSizeDefault) ? blockSizeDefault : nVectors;
+    const size_t nBlocks = (blockSize ? nVectors / blockSize + !!(nVectors % blockSize) : 0);
+
+    daal::tls<tls_counts_t<cpu> *> tlsCounts([ = ]()
+    {
+        return new tls_counts_t<cpu>(nClasses);
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [ & ](int iBlock)
+    {
+        tls_counts_t<cpu> *localCounts = tlsCounts.local();
+        DAAL_CHECK_THR(localCounts && localCounts->counts, ErrorMemoryAllocationFailed);
+
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows = (startRow + blockSize > nVectors) ? nVectors - startRow : blockSize;
+
+        /* Get input data */
+        ReadColumns<algorithmFPType, cpu> mtPredictedLabels(*const_cast<NumericTable *>(predictedLabelsTable), 0, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtPredictedLabels);
+        ReadColumns<algorithmFPType, cpu> mtGroundTruthLabels(*const_cast<NumericTable *>(groundTruthLabelsTable), 0, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtGroundTruthLabels);
+
+        const algorithmFPType *predictedLabelsData = mtPredictedLabels.get();
+        const algorithmFPType *groundTruthLabelsData = mtGroundTruthLabels.get();
+        size_t *localConfusionMatrix = localCounts->counts;
+
+        /* Compute confusion matrix for multi-class classifier */
+        for (size_t i = 0; i < nRows; i++)
+        {
+            size_t predictedLabel   = (size_t)predictedLabelsData[i];
+            size_t groundTruthLabel = (size_t)groundTruthLabelsData[i];
+
+            localConfusionMatrix[groundTruthLabel * nClasses + predictedLabel]++;
+        }
+    } );
+
+    tlsCounts.reduce([ & ](tls_counts_t<cpu> *localCounts)
+    {
+        if(!localCounts) { return; }
+        if(localCounts->counts)
+        {
+            for (size_t i = 0; i < nClasses * nClasses; i++)
+            {
+                counts[i] += double(localCounts->counts[i]);
+            }
+        }
+        delete localCounts;
+    } );
+
+    return safeStat.detach();
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::computeAccuracyMeasures(const double *counts,
+                                                                                              NumericTable *confusionMatrixTable,
+                                                                                              NumericTable *accuracyMeasuresTable,
+                                                                                              const multiclass_confusion_matrix::Parameter *parameter)
+{
+    const algorithmFPType zero = 0.0;
 
     /* Get memory to write the results */
     const size_t nClasses = parameter->nClasses;
-    WriteOnlyRows<int, cpu> mtConfusionMatrix(confusionMatrixTable, 0, nClasses);
+    WriteOnlyRows<algorithmFPType, cpu> mtConfusionMatrix(confusionMatrixTable, 0, nClasses);
     DAAL_CHECK_BLOCK_STATUS(mtConfusionMatrix);
     WriteOnlyRows<algorithmFPType, cpu> mtAccuracyMeasures(accuracyMeasuresTable, 0, 1);
     DAAL_CHECK_BLOCK_STATUS(mtAccuracyMeasures);
 
-    const algorithmFPType *predictedLabelsData = mtPredictedLabels.get();
-    const algorithmFPType *groundTruthLabelsData = mtGroundTruthLabels.get();
-    int *confusionMatrixData = mtConfusionMatrix.get();
+    algorithmFPType *confusionMatrixData = mtConfusionMatrix.get();
     algorithmFPType *accuracyMeasuresData = mtAccuracyMeasures.get();
 
-    const algorithmFPType invNVectors = 1.0 / algorithmFPType(nVectors);
+    double nVectors = 0.0;
+    for (size_t i = 0; i < nClasses * nClasses; i++)
+    {
+        confusionMatrixData[i] = algorithmFPType(counts[i]);
+        nVectors += counts[i];
+    }
+
+    const algorithmFPType fpNVectors(nVectors);
+    const algorithmFPType invNVectors = 1.0 / fpNVectors;
     const algorithmFPType invNClasses = 1.0 / algorithmFPType(nClasses);
     algorithmFPType beta = parameter->beta;
     algorithmFPType beta2 = beta * beta;
 
-    service_memset<int, cpu>(confusionMatrixData, 0, nClasses * nClasses);
-
-    /* Compute confusion matrix for multi-class classifier */
-    for (size_t i = 0; i < nVectors; i++)
-    {
-        size_t predictedLabel   = (size_t)predictedLabelsData[i];
-        size_t groundTruthLabel = (size_t)groundTruthLabelsData[i];
-
-        confusionMatrixData[groundTruthLabel * nClasses + predictedLabel]++;
-    }
-
     TArray<algorithmFPType, cpu> aTp(nClasses);
     TArray<algorithmFPType, cpu> aFp(nClasses);
     TArray<algorithmFPType, cpu> aTn(nClasses);
@@ -100,16 +216,15 @@ Status MultiClassConfusionMatrixKernel<method, algorithmFPType, cpu>::compute(co
     algorithmFPType* fn = aFn.get();
     DAAL_CHECK(tp && fp && tn && fn, ErrorMemoryAllocationFailed);
 
-    algorithmFPType fpNVectors(nVectors);
     for (size_t i = 0; i < nClasses; i++)
     {
-        tp[i] = confusionMatrixData[i*nClasses + i];
+        tp[i] = counts[i*nClasses + i];
         fp[i] = -tp[i];
         fn[i] = -tp[i];
         for (size_t j = 0; j < nClasses; j++)
         {
-            fn[i] += confusionMatrixData[i*nClasses + j];
-            fp[i] += confusionMatrixData[j*nClasses + i];
+            fn[i] += counts[i*nClasses + j];
+            fp[i] += counts[j*nClasses + i];
         }
         tn[i] = fpNVectors - tp[i] - fp[i] - fn[i];
     }
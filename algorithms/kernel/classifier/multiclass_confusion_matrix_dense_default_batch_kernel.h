@@ -52,6 +52,21 @@ public:
     services::Status compute(const NumericTable *predictedLabels, const NumericTable *groundTruthLabels,
                              NumericTable *confusionMatrix, NumericTable *accuracyMeasures,
                              const multiclass_confusion_matrix::Parameter *parameter);
+
+    /* Adds the counts for the block of labels to the confusion matrix accumulated in the online processing mode */
+    services::Status computeConfusionMatrix(const NumericTable *predictedLabels, const NumericTable *groundTruthLabels,
+                                            NumericTable *partialConfusionMatrix);
+
+    services::Status finalizeCompute(const NumericTable *partialConfusionMatrix,
+                                     NumericTable *confusionMatrix, NumericTable *accuracyMeasures,
+                                     const multiclass_confusion_matrix::Parameter *parameter);
+
+protected:
+    services::Status accumulateCounts(const NumericTable *predictedLabels, const NumericTable *groundTruthLabels,
+                                      size_t nClasses, double *counts);
+
+    services::Status computeAccuracyMeasures(const double *counts, NumericTable *confusionMatrix, NumericTable *accuracyMeasures,
+                                             const multiclass_confusion_matrix::Parameter *parameter);
 };
 
 }
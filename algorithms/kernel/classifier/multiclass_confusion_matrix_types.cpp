@@ -43,6 +43,7 @@ namespace interface1
 {
 
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_CLASSIFIER_MULTICLASS_CONFUSION_MATRIX_RESULT_ID);
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_CLASSIFIER_MULTICLASS_CONFUSION_MATRIX_PARTIAL_RESULT_ID);
 Parameter::Parameter(size_t nClasses, double beta) : nClasses(nClasses), beta(beta) {}
 
 Status Parameter::check() const
@@ -95,6 +96,53 @@ Status Input::check(const daal::algorithms::Parameter *parameter, int method) co
 }
 
 
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Returns the partial result of the multi-class confusion matrix algorithm
+ * \param[in] id    Identifier of the partial result, \ref PartialResultId
+ * \return          Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the partial result of the multi-class confusion matrix algorithm
+ * \param[in] id    Identifier of the partial result, \ref PartialResultId
+ * \param[in] value Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of the PartialResult object
+ * \param[in] input     Pointer to the structure of the input objects
+ * \param[in] parameter Pointer to the algorithm parameters
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    return check(parameter, method);
+}
+
+/**
+ * Checks the correctness of the PartialResult object
+ * \param[in] parameter Pointer to the algorithm parameters
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+    const size_t nClasses = algParameter->nClasses;
+    const int unexpectedLayouts = (int)packed_mask;
+    return checkNumericTable(get(partialConfusionMatrix).get(), confusionMatrixStr(), unexpectedLayouts, 0, nClasses, nClasses);
+}
+
+
 Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
 
 /**
@@ -137,6 +185,17 @@ Status Result::check(const daal::algorithms::Input *input, const daal::algorithm
     return checkNumericTable(multiClassMetricsTable.get(), multiClassMetricsStr(), unexpectedLayouts, 0, 8, 1);
 }
 
+/**
+ * Checks the correctness of the Result object
+ * \param[in] partialResult Pointer to the partial results
+ * \param[in] parameter     Pointer to the structure of the algorithm parameters
+ * \param[in] method        Computation method
+ */
+Status Result::check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, int method) const
+{
+    return check((const daal::algorithms::Input *)NULL, parameter, method);
+}
+
 } // namespace interface1
 } // multiclass_confusion_matrix
 } // namespace quality_metric
@@ -267,7 +267,7 @@ services::Status corDistanceUpperPacked(const NumericTable *xTable, NumericTable
 
     /* set the diagonal of the distance matrix to zeros */
     algorithmFPType zero = (algorithmFPType)0.0;
-    daal::threader_for(n, n, [ = ](size_t i)
+    daal::threader_for_size(n, n, [ = ](size_t i)
     {
         r[n * i - i * (i - 1) / 2 ] = zero;
     } );
@@ -139,6 +139,11 @@ services::Status CovarianceCSROnlineKernel<algorithmFPType, method, cpu>::finali
             NumericTable *sumTable, NumericTable *covTable,
             NumericTable *meanTable, const Parameter *parameter)
 {
+    if (isUpperPacked(crossProductTable) || isUpperPacked(covTable))
+    {
+        return finalizePackedCovariance<algorithmFPType, cpu>(crossProductTable, sumTable, nObservationsTable,
+            covTable, meanTable, parameter);
+    }
     finalizeCovariance<algorithmFPType, cpu>(crossProductTable, sumTable, nObservationsTable,
         covTable, meanTable, parameter, this->_errors.get());
     DAAL_RETURN_STATUS()
@@ -47,6 +47,14 @@ services::Status CovarianceDenseBatchKernel<algorithmFPType, method, cpu>::compu
     NumericTablePtr nObservationsTable(
         new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(&nObservationsValue, 1, 1));
     bool isOnline = false;
+    if (isUpperPacked(covTable))
+    {
+        /* The packed resulting matrix stores the cross-product until it is finalized */
+        services::Status s = updateDensePackedPartialResults<algorithmFPType, method, cpu>(dataTable,
+            covTable, meanTable, nObservationsTable.get(), isOnline);
+        if (!s) { return s; }
+        return finalizePackedCovariance<algorithmFPType, cpu>(covTable, meanTable, nObservationsTable.get(), covTable, meanTable, parameter);
+    }
     updateDensePartialResults<algorithmFPType, method, cpu>(dataTable,
         covTable, meanTable, nObservationsTable.get(), isOnline, this->_errors.get());
     finalizeCovariance<algorithmFPType, cpu>(covTable, meanTable, nObservationsTable.get(), parameter, this->_errors.get());
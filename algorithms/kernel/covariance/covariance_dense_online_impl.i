@@ -43,6 +43,11 @@ services::Status CovarianceDenseOnlineKernel<algorithmFPType, method, cpu>::comp
                     const Parameter *parameter)
 {
     bool isOnline = true;
+    if (isUpperPacked(crossProductTable))
+    {
+        return updateDensePackedPartialResults<algorithmFPType, method, cpu>(dataTable,
+            crossProductTable, sumTable, nObservationsTable, isOnline);
+    }
     if (method == singlePassDense)
     {
         updateDensePartialResults<algorithmFPType, method, cpu>(dataTable,
@@ -113,6 +118,11 @@ services::Status CovarianceDenseOnlineKernel<algorithmFPType, method, cpu>::fina
             NumericTable *sumTable, NumericTable *covTable,
             NumericTable *meanTable, const Parameter *parameter)
 {
+    if (isUpperPacked(crossProductTable) || isUpperPacked(covTable))
+    {
+        return finalizePackedCovariance<algorithmFPType, cpu>(crossProductTable, sumTable, nObservationsTable,
+            covTable, meanTable, parameter);
+    }
     finalizeCovariance<algorithmFPType, cpu>(crossProductTable, sumTable, nObservationsTable,
         covTable, meanTable, parameter, this->_errors.get());
     DAAL_RETURN_STATUS()
@@ -42,6 +42,12 @@ services::Status CovarianceDistributedKernel<algorithmFPType, method, cpu>::comp
                 NumericTable *nObservationsTable, NumericTable *crossProductTable,
                 NumericTable *sumTable, const Parameter *parameter)
 {
+    if (isUpperPacked(crossProductTable))
+    {
+        return mergePackedPartialResults<algorithmFPType, cpu>(partialResultsCollection,
+            nObservationsTable, crossProductTable, sumTable);
+    }
+
     size_t collectionSize = partialResultsCollection->size();
 
     size_t nFeatures = crossProductTable->getNumberOfColumns();
@@ -88,6 +94,11 @@ services::Status CovarianceDistributedKernel<algorithmFPType, method, cpu>::fina
                     NumericTable *sumTable, NumericTable *covTable,
                     NumericTable *meanTable, const Parameter *parameter)
 {
+    if (isUpperPacked(crossProductTable) || isUpperPacked(covTable))
+    {
+        return finalizePackedCovariance<algorithmFPType, cpu>(crossProductTable, sumTable, nObservationsTable,
+            covTable, meanTable, parameter);
+    }
     finalizeCovariance<algorithmFPType, cpu>(crossProductTable, sumTable, nObservationsTable,
         covTable, meanTable, parameter, this->_errors.get());
     DAAL_RETURN_STATUS()
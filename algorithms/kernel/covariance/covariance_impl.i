@@ -31,6 +31,8 @@
 #include "service_blas.h"
 #include "service_spblas.h"
 #include "service_stat.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
 #include "threading.h"
 
 
@@ -185,6 +187,174 @@ template<typename algorithmFPType, CpuType cpu> struct tls_data_t
 template<CpuType cpu> static inline size_t getBlockSize(size_t nrows){ return 140; }
 template<>                   inline size_t getBlockSize<avx512>(size_t nrows){ return ( nrows > 5000 && nrows <= 50000 )? 1024 : 140; }
 
+/* Number of features starting from which the full cross-product is accumulated by tiles */
+const size_t tiledCrossProductMinFeatures = 4096;
+
+/* Size of the square tile of the cross-product computed by one thread at once */
+const size_t crossProductTileSize = 256;
+
+/* Returns true if the table stores the upper packed symmetric matrix */
+inline bool isUpperPacked(const NumericTable *table)
+{
+    return table->getDataLayout() == NumericTableIface::upperPackedSymmetricMatrix;
+}
+
+/* Index of the element (i, j), i <= j, of the upper packed symmetric matrix of size nFeatures */
+inline size_t upperPackedIndex(size_t nFeatures, size_t i, size_t j)
+{
+    return i * nFeatures - ((i * (i - 1)) >> 1) + j - i;
+}
+
+/********************* tls_tile_t class ***********************************************************/
+template<typename algorithmFPType, CpuType cpu> struct tls_tile_t
+{
+    algorithmFPType *tile;
+
+    tls_tile_t()
+    {
+        tile = service_scalable_malloc<algorithmFPType, cpu>(crossProductTileSize * crossProductTileSize);
+    }
+
+    ~tls_tile_t()
+    {
+        if(tile) { service_scalable_free<algorithmFPType,cpu>( tile ); tile = 0; }
+    }
+};
+
+/****************************** updateSums ********************************************************/
+/* Adds the sums of the columns of the data block to sums */
+template<typename algorithmFPType, CpuType cpu>
+services::Status updateSums(size_t nFeatures, size_t nVectors, const algorithmFPType *dataBlock, algorithmFPType *sums)
+{
+    size_t numRowsInBlock = getBlockSize<cpu>(nVectors);
+    size_t numBlocks = nVectors / numRowsInBlock;
+    if (numBlocks * numRowsInBlock < nVectors) { numBlocks++; }
+
+    daal::tls<algorithmFPType *> tls_sums([ = ]()
+    {
+        return service_scalable_calloc<algorithmFPType, cpu>(nFeatures);
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for( numBlocks, numBlocks, [ & ](int iBlock)
+    {
+        algorithmFPType *sums_local = tls_sums.local();
+        DAAL_CHECK_THR(sums_local, services::ErrorMemoryAllocationFailed);
+
+        size_t startRow = iBlock * numRowsInBlock;
+        size_t endRow = startRow + numRowsInBlock;
+        if (endRow > nVectors) { endRow = nVectors; }
+
+        for (size_t i = startRow; i < endRow; i++)
+        {
+           PRAGMA_IVDEP
+           PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                sums_local[j] += dataBlock[i * nFeatures + j];
+            }
+        }
+    } );
+
+    tls_sums.reduce( [ = ]( algorithmFPType *sums_local )
+    {
+        if(!sums_local) { return; }
+       PRAGMA_IVDEP
+       PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            sums[j] += sums_local[j];
+        }
+        service_scalable_free<algorithmFPType,cpu>( sums_local );
+    } );
+
+    return safeStat.detach();
+}
+
+/****************************** updateCrossProductByTiles *****************************************/
+/**
+ *  Merges the cross-product of the data block into the cross-product accumulated so far:
+ *      crossProduct(i, j) += X(i)'X(j) + sums(i) * sums(j) / nObservations - t(i) * t(j) / (nObservations + nVectors),
+ *  where t = sums + blockSums. Missing sums or blockSums are treated as zero vectors.
+ *  The upper triangle is split into square tiles, each tile is computed by one thread with GEMM,
+ *  so the size of the per-thread memory does not depend on the number of features.
+ *  The cross-product is stored either as the upper packed symmetric matrix or as the full matrix
+ */
+template<typename algorithmFPType, CpuType cpu>
+services::Status updateCrossProductByTiles(size_t nFeatures, size_t nVectors, const algorithmFPType *dataBlock,
+                                           const algorithmFPType *blockSums, const algorithmFPType *sums,
+                                           algorithmFPType nObservations, algorithmFPType *crossProduct, bool isPacked)
+{
+    const size_t nTiles = nFeatures / crossProductTileSize + !!(nFeatures % crossProductTileSize);
+    const algorithmFPType invNObservations = (nObservations > 0 ? 1.0 / nObservations : 0.0);
+    const algorithmFPType invNewNObservations = 1.0 / (nObservations + (algorithmFPType)nVectors);
+
+    daal::tls<tls_tile_t<algorithmFPType, cpu> *> tls_tile([ = ]()
+    {
+        return new tls_tile_t<algorithmFPType, cpu>();
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for( nTiles * nTiles, nTiles * nTiles, [ & ](int iTilePair)
+    {
+        const size_t iTile = iTilePair / nTiles;
+        const size_t jTile = iTilePair % nTiles;
+        if (jTile < iTile) { return; }
+
+        tls_tile_t<algorithmFPType, cpu> *tls_tile_local = tls_tile.local();
+        DAAL_CHECK_THR(tls_tile_local && tls_tile_local->tile, services::ErrorMemoryAllocationFailed);
+        algorithmFPType *tile = tls_tile_local->tile;
+
+        const size_t iStart = iTile * crossProductTileSize;
+        const size_t jStart = jTile * crossProductTileSize;
+        DAAL_INT iSize = ((iStart + crossProductTileSize > nFeatures) ? nFeatures - iStart : crossProductTileSize);
+        DAAL_INT jSize = ((jStart + crossProductTileSize > nFeatures) ? nFeatures - jStart : crossProductTileSize);
+        DAAL_INT nVectors_local  = nVectors;
+        DAAL_INT nFeatures_local = nFeatures;
+
+        char transa = 'N';
+        char transb = 'T';
+        algorithmFPType alpha = 1.0;
+        algorithmFPType beta  = 0.0;
+
+        /* tile(i, j) = X(iStart + i)'X(jStart + j), tile is stored by columns */
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &iSize, &jSize, &nVectors_local, &alpha,
+                                           dataBlock + iStart, &nFeatures_local, dataBlock + jStart, &nFeatures_local,
+                                           &beta, tile, &iSize);
+
+        for (size_t i = 0; i < (size_t)iSize; i++)
+        {
+            const size_t ii = iStart + i;
+            const algorithmFPType s_i = (sums ? sums[ii] : 0.0);
+            const algorithmFPType t_i = s_i + (blockSums ? blockSums[ii] : 0.0);
+            const size_t jFirst = (iTile == jTile ? i : 0);
+            for (size_t j = jFirst; j < (size_t)jSize; j++)
+            {
+                const size_t jj = jStart + j;
+                const algorithmFPType s_j = (sums ? sums[jj] : 0.0);
+                const algorithmFPType t_j = s_j + (blockSums ? blockSums[jj] : 0.0);
+                const algorithmFPType value = tile[j * iSize + i] + s_i * s_j * invNObservations - t_i * t_j * invNewNObservations;
+                if (isPacked)
+                {
+                    crossProduct[upperPackedIndex(nFeatures, ii, jj)] += value;
+                }
+                else
+                {
+                    crossProduct[jj * nFeatures + ii] += value;
+                    if (ii != jj) { crossProduct[ii * nFeatures + jj] += value; }
+                }
+            }
+        }
+    } );
+
+    tls_tile.reduce( [ = ]( tls_tile_t<algorithmFPType, cpu> *tls_tile_local )
+    {
+        delete tls_tile_local;
+    } );
+
+    return safeStat.detach();
+}
+
 /********************* updateDenseCrossProductAndSums ********************************************/
 template<typename algorithmFPType, Method method, CpuType cpu>
 void updateDenseCrossProductAndSums(bool            isNormalized,
@@ -200,6 +370,25 @@ void updateDenseCrossProductAndSums(bool            isNormalized,
 
     if(((isNormalized) || ((!isNormalized) && ( (method == defaultDense) || (method == sumDense)))))
     {
+        if (nFeatures >= tiledCrossProductMinFeatures)
+        {
+            /* Wide data: per-thread copies of the full cross-product do not fit into memory, accumulate it by tiles */
+            services::Status s;
+            if (!isNormalized && method == defaultDense)
+            {
+                s = updateSums<algorithmFPType, cpu>(nFeatures, nVectors, dataBlock, sums);
+            }
+            if (s)
+            {
+                s = updateCrossProductByTiles<algorithmFPType, cpu>(nFeatures, nVectors, dataBlock,
+                        (isNormalized ? NULL : sums), NULL, 0.0, crossProduct, false);
+            }
+            if (!s) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+            *nObservations += (algorithmFPType)nVectors;
+            return;
+        }
+
         /* Inverse number of rows (for normalization) */
         algorithmFPType nVectorsInv = 1.0 / (double)(nVectors);
 
@@ -675,6 +864,286 @@ void finalizeCovariance( NumericTable *crossProductTable,
     meanTable->releaseBlockOfRows(meanBD);
 }
 
+/************************ updateDensePackedPartialResults *****************************************/
+/**
+ *  Updates the partial results with the cross-product stored as the upper packed symmetric matrix.
+ *  All dense methods share the tiled computation that merges the data block into the partial results directly
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status updateDensePackedPartialResults( NumericTable *dataTable,
+                                                  NumericTable *crossProductTable,
+                                                  NumericTable *sumTable,
+                                                  NumericTable *nObservationsTable,
+                                                  bool         isOnline)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+    const bool isNormalized = dataTable->isNormalized(NumericTableIface::standardScoreNormalized);
+
+    WritePacked<algorithmFPType, cpu> crossProductBlock(crossProductTable);
+    DAAL_CHECK_BLOCK_STATUS(crossProductBlock);
+    WriteRows<algorithmFPType, cpu> sumBlock(sumTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumBlock);
+    WriteRows<algorithmFPType, cpu> nObservationsBlock(nObservationsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock);
+
+    algorithmFPType *crossProduct  = crossProductBlock.get();
+    algorithmFPType *sums          = sumBlock.get();
+    algorithmFPType *nObservations = nObservationsBlock.get();
+
+    if (!isOnline)
+    {
+        algorithmFPType zero = 0.0;
+        service_memset<algorithmFPType, cpu>(crossProduct, zero, (nFeatures * (nFeatures + 1)) / 2);
+        service_memset<algorithmFPType, cpu>(sums, zero, nFeatures);
+        *nObservations = zero;
+    }
+
+    ReadRows<algorithmFPType, cpu> dataBlock(dataTable, 0, nVectors);
+    DAAL_CHECK_BLOCK_STATUS(dataBlock);
+
+    TArrayCalloc<algorithmFPType, cpu> blockSumsArray(nFeatures);
+    algorithmFPType *blockSums = blockSumsArray.get();
+    DAAL_CHECK_MALLOC(blockSums);
+
+    services::Status s;
+    if (method == sumDense)
+    {
+        NumericTable *userSumsTable = dataTable->basicStatistics.get(NumericTable::sum).get();
+        DAAL_CHECK(userSumsTable, services::ErrorPrecomputedSumNotAvailable);
+
+        ReadRows<algorithmFPType, cpu> userSumsBlock(userSumsTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(userSumsBlock);
+        daal_memcpy_s(blockSums, nFeatures * sizeof(algorithmFPType), userSumsBlock.get(), nFeatures * sizeof(algorithmFPType));
+    }
+    else if (!isNormalized)
+    {
+        s = updateSums<algorithmFPType, cpu>(nFeatures, nVectors, dataBlock.get(), blockSums);
+        if (!s) { return s; }
+    }
+
+    s = updateCrossProductByTiles<algorithmFPType, cpu>(nFeatures, nVectors, dataBlock.get(),
+            (isNormalized ? NULL : blockSums), (isNormalized ? NULL : sums), *nObservations, crossProduct, true);
+    if (!s) { return s; }
+
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        sums[i] += blockSums[i];
+    }
+    *nObservations += (algorithmFPType)nVectors;
+
+    return s;
+}
+
+/*********************** mergePackedCrossProductAndSums ******************************************/
+/**
+ *  Merges the partial results into the partial results with the cross-product stored
+ *  as the upper packed symmetric matrix. The cross-product of the partial results to merge
+ *  is stored either as the upper packed symmetric matrix or as the full matrix
+ */
+template<typename algorithmFPType, CpuType cpu>
+void mergePackedCrossProductAndSums( size_t nFeatures,
+                                     const algorithmFPType *partialCrossProduct,
+                                     bool isPartialPacked,
+                                     const algorithmFPType *partialSums,
+                                     algorithmFPType partialNObservations,
+                                     algorithmFPType *crossProduct,
+                                     algorithmFPType *sums,
+                                     algorithmFPType *nObservations)
+{
+    if (partialNObservations == 0) { return; }
+
+    const algorithmFPType nObsValue = *nObservations;
+    const algorithmFPType invPartialNObs = 1.0 / partialNObservations;
+    const algorithmFPType invNObs = (nObsValue == 0 ? 0.0 : 1.0 / nObsValue);
+    const algorithmFPType invNewNObs = 1.0 / (nObsValue + partialNObservations);
+
+    daal::threader_for( nFeatures, nFeatures, [ = ](size_t i)
+    {
+        const size_t rowOffset = upperPackedIndex(nFeatures, i, i);
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = i; j < nFeatures; j++)
+        {
+            const algorithmFPType partialValue = (isPartialPacked ? partialCrossProduct[rowOffset + j - i] :
+                                                                    partialCrossProduct[j * nFeatures + i]);
+            crossProduct[rowOffset + j - i] += partialValue
+                + partialSums[i] * partialSums[j] * invPartialNObs
+                + sums[i] * sums[j] * invNObs
+                - (partialSums[i] + sums[i]) * (partialSums[j] + sums[j]) * invNewNObs;
+        }
+    } );
+
+    *nObservations += partialNObservations;
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        sums[i] += partialSums[i];
+    }
+}
+
+/*********************** mergePackedPartialResults ***********************************************/
+template<typename algorithmFPType, CpuType cpu>
+services::Status mergePackedPartialResults( DataCollection *partialResultsCollection,
+                                            NumericTable *nObservationsTable,
+                                            NumericTable *crossProductTable,
+                                            NumericTable *sumTable)
+{
+    const size_t nFeatures = crossProductTable->getNumberOfColumns();
+
+    WriteOnlyPacked<algorithmFPType, cpu> crossProductBlock(crossProductTable);
+    DAAL_CHECK_BLOCK_STATUS(crossProductBlock);
+    WriteOnlyRows<algorithmFPType, cpu> sumBlock(sumTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumBlock);
+    WriteOnlyRows<algorithmFPType, cpu> nObservationsBlock(nObservationsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock);
+
+    algorithmFPType *crossProduct  = crossProductBlock.get();
+    algorithmFPType *sums          = sumBlock.get();
+    algorithmFPType *nObservations = nObservationsBlock.get();
+
+    algorithmFPType zero = 0.0;
+    service_memset<algorithmFPType, cpu>(crossProduct, zero, (nFeatures * (nFeatures + 1)) / 2);
+    service_memset<algorithmFPType, cpu>(sums, zero, nFeatures);
+    *nObservations = zero;
+
+    const size_t collectionSize = partialResultsCollection->size();
+    for (size_t i = 0; i < collectionSize; i++)
+    {
+        PartialResult *partialResult = static_cast<PartialResult *>((*partialResultsCollection)[i].get());
+        NumericTable *partialCrossProductTable  = partialResult->get(covariance::crossProduct).get();
+        NumericTable *partialSumsTable          = partialResult->get(covariance::sum).get();
+        NumericTable *partialNObservationsTable = partialResult->get(covariance::nObservations).get();
+
+        ReadRows<algorithmFPType, cpu> partialSumsBlock(partialSumsTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(partialSumsBlock);
+        ReadRows<algorithmFPType, cpu> partialNObservationsBlock(partialNObservationsTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(partialNObservationsBlock);
+
+        const bool isPartialPacked = isUpperPacked(partialCrossProductTable);
+        ReadPacked<algorithmFPType, cpu> partialPackedBlock;
+        ReadRows<algorithmFPType, cpu> partialRowsBlock;
+        const algorithmFPType *partialCrossProduct = (isPartialPacked ? partialPackedBlock.set(partialCrossProductTable) :
+                                                                        partialRowsBlock.set(partialCrossProductTable, 0, nFeatures));
+        DAAL_CHECK_BLOCK_STATUS(partialPackedBlock);
+        DAAL_CHECK_BLOCK_STATUS(partialRowsBlock);
+
+        mergePackedCrossProductAndSums<algorithmFPType, cpu>(nFeatures, partialCrossProduct, isPartialPacked,
+            partialSumsBlock.get(), *partialNObservationsBlock.get(), crossProduct, sums, nObservations);
+    }
+    return services::Status();
+}
+
+/*********************** finalizePackedCovariance ************************************************/
+/**
+ *  Computes the correlation or variance-covariance matrix and the means when either the cross-product
+ *  or the resulting matrix is stored as the upper packed symmetric matrix.
+ *  The cross-product and the sums may share the tables with the resulting matrix and the means
+ */
+template<typename algorithmFPType, CpuType cpu>
+services::Status finalizePackedCovariance( NumericTable *crossProductTable,
+                                           NumericTable *sumTable,
+                                           NumericTable *nObservationsTable,
+                                           NumericTable *covTable,
+                                           NumericTable *meanTable,
+                                           const Parameter *parameter)
+{
+    const size_t nFeatures = covTable->getNumberOfColumns();
+    const bool isCrossProductPacked = isUpperPacked(crossProductTable);
+    const bool isCovPacked = isUpperPacked(covTable);
+
+    ReadRows<algorithmFPType, cpu> nObservationsBlock(nObservationsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBlock);
+    const algorithmFPType nObservations = *nObservationsBlock.get();
+
+    /* Get the resulting matrix and the means */
+    WritePacked<algorithmFPType, cpu> covPackedBlock;
+    WriteRows<algorithmFPType, cpu> covRowsBlock;
+    algorithmFPType *cov = (isCovPacked ? covPackedBlock.set(covTable) : covRowsBlock.set(covTable, 0, nFeatures));
+    DAAL_CHECK_BLOCK_STATUS(covPackedBlock);
+    DAAL_CHECK_BLOCK_STATUS(covRowsBlock);
+
+    WriteRows<algorithmFPType, cpu> meanBlock(meanTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(meanBlock);
+    algorithmFPType *mean = meanBlock.get();
+
+    /* Get the cross-product and the sums unless they share the tables with the results */
+    ReadPacked<algorithmFPType, cpu> crossProductPackedBlock;
+    ReadRows<algorithmFPType, cpu> crossProductRowsBlock;
+    const algorithmFPType *crossProduct = cov;
+    if (crossProductTable != covTable)
+    {
+        crossProduct = (isCrossProductPacked ? crossProductPackedBlock.set(crossProductTable) :
+                                               crossProductRowsBlock.set(crossProductTable, 0, nFeatures));
+        DAAL_CHECK_BLOCK_STATUS(crossProductPackedBlock);
+        DAAL_CHECK_BLOCK_STATUS(crossProductRowsBlock);
+    }
+
+    ReadRows<algorithmFPType, cpu> sumBlock;
+    const algorithmFPType *sums = mean;
+    if (sumTable != meanTable)
+    {
+        sums = sumBlock.set(sumTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(sumBlock);
+    }
+
+    const algorithmFPType invNObservations = 1.0 / nObservations;
+    algorithmFPType invNObservationsM1 = 1.0;
+    if (nObservations > 1.0)
+    {
+        invNObservationsM1 = 1.0 / (nObservations - 1.0);
+    }
+
+    /* Calculate resulting mean vector */
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        mean[i] = sums[i] * invNObservations;
+    }
+
+    const bool isCorrelation = (parameter->outputMatrixType == correlationMatrix);
+    TArray<algorithmFPType, cpu> diagInvSqrtsArray(isCorrelation ? nFeatures : 0);
+    algorithmFPType *diagInvSqrts = diagInvSqrtsArray.get();
+    if (isCorrelation)
+    {
+        DAAL_CHECK_MALLOC(diagInvSqrts);
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            const algorithmFPType diag = (isCrossProductPacked ? crossProduct[upperPackedIndex(nFeatures, i, i)] :
+                                                                 crossProduct[i * nFeatures + i]);
+            diagInvSqrts[i] = 1.0 / daal::internal::Math<algorithmFPType,cpu>::sSqrt(diag);
+        }
+    }
+
+    daal::threader_for( nFeatures, nFeatures, [ = ](size_t i)
+    {
+        for (size_t j = i; j < nFeatures; j++)
+        {
+            const algorithmFPType crossProductValue = (isCrossProductPacked ? crossProduct[upperPackedIndex(nFeatures, i, j)] :
+                                                                              crossProduct[j * nFeatures + i]);
+            algorithmFPType value;
+            if (isCorrelation)
+            {
+                value = (i == j ? 1.0 : crossProductValue * diagInvSqrts[i] * diagInvSqrts[j]);
+            }
+            else
+            {
+                value = crossProductValue * invNObservationsM1;
+            }
+
+            if (isCovPacked)
+            {
+                cov[upperPackedIndex(nFeatures, i, j)] = value;
+            }
+            else
+            {
+                cov[i * nFeatures + j] = value;
+                cov[j * nFeatures + i] = value;
+            }
+        }
+    } );
+
+    return services::Status();
+}
+
 } // namespace internal
 } // namespace covariance
 } // namespace algorithms
@@ -36,7 +36,7 @@ namespace interface1
 {
 
 /** Default constructor */
-Parameter::Parameter() : daal::algorithms::Parameter(), outputMatrixType(covarianceMatrix) {}
+Parameter::Parameter() : daal::algorithms::Parameter(), outputMatrixType(covarianceMatrix), outputMatrixStorage(fullStorage) {}
 
 }//namespace interface1
 }//namespace covariance
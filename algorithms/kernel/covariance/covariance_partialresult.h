@@ -25,6 +25,7 @@
 #define __COVARIANCE_PARTIALRESULT_
 
 #include "covariance_types.h"
+#include "data_management/data/symmetric_matrix.h"
 
 using namespace daal::data_management;
 namespace daal
@@ -47,7 +48,16 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
     size_t nColumns = algInput->getNumberOfFeatures();
 
     set(nObservations, NumericTablePtr(new HomogenNumericTable<size_t>(1, 1, NumericTable::doAllocate)));
-    set(crossProduct, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(nColumns, nColumns, NumericTable::doAllocate)));
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+    if (algParameter && algParameter->outputMatrixStorage == packedStorage)
+    {
+        set(crossProduct, NumericTablePtr(
+                new PackedSymmetricMatrix<NumericTableIface::upperPackedSymmetricMatrix, algorithmFPType>(nColumns, NumericTable::doAllocate)));
+    }
+    else
+    {
+        set(crossProduct, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(nColumns, nColumns, NumericTable::doAllocate)));
+    }
     set(sum, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(nColumns, 1, NumericTable::doAllocate)));
     return services::Status();
 }
@@ -25,6 +25,7 @@
 #define __COVARIANCE_RESULT_
 
 #include "covariance_types.h"
+#include "data_management/data/symmetric_matrix.h"
 
 namespace daal
 {
@@ -33,6 +34,25 @@ namespace algorithms
 namespace covariance
 {
 
+/**
+ * Allocates the correlation or variance-covariance matrix in the storage format specified in the parameter
+ * \param[in] nColumns  Number of features
+ * \param[in] parameter Parameters of the algorithm
+ */
+template <typename algorithmFPType>
+data_management::SerializationIfacePtr allocateMatrix(size_t nColumns, const daal::algorithms::Parameter *parameter)
+{
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+    if (algParameter && algParameter->outputMatrixStorage == packedStorage)
+    {
+        return data_management::SerializationIfacePtr(
+                   new data_management::PackedSymmetricMatrix<data_management::NumericTableIface::upperPackedSymmetricMatrix, algorithmFPType>(
+                       nColumns, data_management::NumericTable::doAllocate));
+    }
+    return data_management::SerializationIfacePtr(
+               new data_management::HomogenNumericTable<algorithmFPType>(nColumns, nColumns, data_management::NumericTable::doAllocate));
+}
+
 /**
  * Allocates memory to store final results of the correlation or variance-covariance matrix algorithm
  * \param[in] input     %Input objects of the algorithm
@@ -45,8 +65,7 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     const Input *algInput = static_cast<const Input *>(input);
     size_t nColumns = algInput->getNumberOfFeatures();
 
-    Argument::set(covariance, data_management::SerializationIfacePtr(
-                      new data_management::HomogenNumericTable<algorithmFPType>(nColumns, nColumns, data_management::NumericTable::doAllocate)));
+    Argument::set(covariance, allocateMatrix<algorithmFPType>(nColumns, parameter));
     Argument::set(mean, data_management::SerializationIfacePtr(
                       new data_management::HomogenNumericTable<algorithmFPType>(nColumns, 1, data_management::NumericTable::doAllocate)));
     return services::Status();
@@ -64,8 +83,7 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialRes
     const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
     size_t nColumns = pres->getNumberOfFeatures();
 
-    Argument::set(covariance, data_management::SerializationIfacePtr(
-                      new data_management::HomogenNumericTable<algorithmFPType>(nColumns, nColumns, data_management::NumericTable::doAllocate)));
+    Argument::set(covariance, allocateMatrix<algorithmFPType>(nColumns, parameter));
     Argument::set(mean, data_management::SerializationIfacePtr(
                       new data_management::HomogenNumericTable<algorithmFPType>(nColumns, 1, data_management::NumericTable::doAllocate)));
     return services::Status();
@@ -48,7 +48,7 @@ namespace internal
 
 size_t ModelImpl::numberOfTrees() const
 {
-    return ImplType::size();
+    return isCompact() ? compactForest().nTrees() : ImplType::size();
 }
 
 static bool traverseNodeDF(size_t level, const ModelImpl::TreeType::NodeType::Base& n, decision_forest::classification::NodeVisitor& visitor)
@@ -67,8 +67,15 @@ static bool traverseNodeDF(size_t level, const ModelImpl::TreeType::NodeType::Ba
     return visitor.onLeafNode(level, l->response.value);
 }
 
+static size_t compactLeafResponse(size_t kid) { return kid; }
+
 void ModelImpl::traverseDF(size_t iTree, decision_forest::classification::NodeVisitor& visitor) const
 {
+    if(isCompact())
+    {
+        compactForest().traverseDF(iTree, visitor, compactLeafResponse);
+        return;
+    }
     if(iTree >= size())
         return;
     const TreeType* t = static_cast<const TreeType*>(this->at(iTree));
@@ -109,6 +116,11 @@ static bool traverseNodesBF(size_t level, NodePtrArray& aCur,
 
 void ModelImpl::traverseBF(size_t iTree, NodeVisitor& visitor) const
 {
+    if(isCompact())
+    {
+        compactForest().traverseBF(iTree, visitor, compactLeafResponse);
+        return;
+    }
     if(iTree >= size())
         return;
     const TreeType* t = static_cast<const TreeType*>(this->at(iTree));
@@ -121,6 +133,19 @@ void ModelImpl::traverseBF(size_t iTree, NodeVisitor& visitor) const
     }
 }
 
+static double leafClass(const ModelImpl::TreeType::NodeType::Leaf* l) { return double(l->response.value); }
+
+services::Status ModelImpl::compact()
+{
+    if(isCompact())
+        return services::Status();
+    //class index is stored in the compact leaf
+    services::Status s = _compactForest.build<TreeType>(_aTree, size(), false, leafClass);
+    if(s)
+        destroy();
+    return s;
+}
+
 } // namespace interface1
 } // namespace regression
 } // namespace decision_forest
@@ -50,6 +50,7 @@ public:
     virtual size_t numberOfTrees() const DAAL_C11_OVERRIDE;
     virtual void traverseDF(size_t iTree, decision_forest::classification::NodeVisitor& visitor) const DAAL_C11_OVERRIDE;
     virtual void traverseBF(size_t iTree, NodeVisitor& visitor) const DAAL_C11_OVERRIDE;
+    virtual services::Status compact() DAAL_C11_OVERRIDE;
 };
 
 } // namespace internal
@@ -32,6 +32,8 @@
 #include "df_classification_model_impl.h"
 #include "service_numeric_table.h"
 #include "service_memory.h"
+#include "service_error_handling.h"
+#include "service_tuning.h"
 #include "df_predict_dense_default_impl.i"
 
 using namespace daal::internal;
@@ -50,8 +52,6 @@ namespace prediction
 namespace internal
 {
 
-static const size_t nRowsInBlock = 500;
-
 //////////////////////////////////////////////////////////////////////////////////////////
 // PredictClassificationTask
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -67,6 +67,10 @@ public:
 
     Status run(size_t nClasses);
 
+protected:
+    template <typename BinType>
+    Status runCompact(size_t nClasses);
+
 protected:
     static void predict(const decision_forest::internal::Tree& t, const algorithmFPType* x,
         ClassIndexType* val, size_t nClasses)
@@ -99,8 +103,12 @@ services::Status PredictKernel<algorithmFPType, method, cpu>::compute(const Nume
 template <typename algorithmFPType, CpuType cpu>
 Status PredictClassificationTask<algorithmFPType, cpu>::run(size_t nClasses)
 {
+    if(_model->isCompact())
+        return (_model->compactForest().maxBins() <= 256 ? runCompact<unsigned char>(nClasses) : runCompact<unsigned short>(nClasses));
+
     const auto nRows = _data->getNumberOfRows();
     const auto nCols = _data->getNumberOfColumns();
+    const size_t nRowsInBlock = services::internal::getTuningParameter<cpu>(services::Environment::dfPredictionBlockSize);
     size_t nBlocks = nRows / nRowsInBlock;
     nBlocks += (nBlocks * nRowsInBlock != nRows);
 
@@ -158,6 +166,69 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(size_t nClasses)
     return Status();
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Prediction with the compact forest: rows of a block are binned once, then each tree
+// votes for all rows of the block
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+template <typename BinType>
+Status PredictClassificationTask<algorithmFPType, cpu>::runCompact(size_t nClasses)
+{
+    const decision_forest::internal::CompactForest& forest = _model->compactForest();
+    const auto nRows = _data->getNumberOfRows();
+    const auto nCols = _data->getNumberOfColumns();
+    const size_t nFeatures = forest.nFeatures();
+    const size_t nTrees = forest.nTrees();
+    DAAL_CHECK(nFeatures <= nCols, ErrorIncorrectNumberOfFeatures);
+    const size_t nRowsInBlock = services::internal::getTuningParameter<cpu>(services::Environment::dfPredictionBlockSize);
+    size_t nBlocks = nRows / nRowsInBlock;
+    nBlocks += (nBlocks * nRowsInBlock != nRows);
+
+    WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(resBD);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStartRow = iBlock*nRowsInBlock;
+        const size_t nRowsToProcess = (iBlock == nBlocks - 1) ? nRows - iBlock * nRowsInBlock : nRowsInBlock;
+        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_data), iStartRow, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        TArray<BinType, cpu> aBin(nFeatures ? nRowsToProcess*nFeatures : 1);
+        TArray<ClassIndexType, cpu> aVotes(nRowsToProcess*nClasses);
+        DAAL_CHECK_THR(aBin.get() && aVotes.get(), ErrorMemoryAllocationFailed);
+        BinType* bins = aBin.get();
+        ClassIndexType* votes = aVotes.get();
+        decision_forest::prediction::internal::quantizeRows<algorithmFPType, BinType, cpu>(forest, xBD.get(), nRowsToProcess, nCols, bins);
+        for(size_t i = 0; i < nRowsToProcess*nClasses; ++i)
+            votes[i] = 0;
+
+        for(size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            for(size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+            {
+                const size_t cls = forest.findLeaf<BinType>(iTree, bins + iRow*nFeatures)->kid;
+                DAAL_ASSERT(cls < nClasses);
+                votes[iRow*nClasses + cls]++;
+            }
+        }
+
+        algorithmFPType* res = resBD.get() + iStartRow;
+        for(size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+        {
+            const ClassIndexType* val = votes + iRow*nClasses;
+            size_t maxIdx = 0;
+            for(size_t i = 1; i < nClasses; ++i)
+            {
+                if(val[maxIdx] < val[i])
+                    maxIdx = i;
+            }
+            res[iRow] = algorithmFPType(maxIdx);
+        }
+    });
+    return safeStat.detach();
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace classification */
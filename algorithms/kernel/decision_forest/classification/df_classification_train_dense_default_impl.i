@@ -68,6 +68,7 @@ public:
 
         ImpurityData(){}
         ImpurityData(const ImpurityData& o): var(o.var), hist(o.hist){}
+        ImpurityData& operator=(const ImpurityData& o) { var = o.var; hist = o.hist; return *this; }
 
         void init(size_t nClasses) { var = 0; hist.resize(nClasses, 0); }
     };
@@ -22,6 +22,7 @@
 */
 
 #include "df_model_impl.h"
+#include "service_sort.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -89,6 +90,65 @@ bool ModelImpl::add(Tree* pTree)
     return true;
 }
 
+services::Status CompactForest::setEdges(const services::Collection<SplitThreshold>& aThreshold, size_t nFeatures)
+{
+    _edgesOffset.resize(nFeatures + 1, 0);
+    _unordered.resize(nFeatures, 0);
+    DAAL_CHECK_MALLOC(_edgesOffset.get() && (!nFeatures || _unordered.get()));
+    const size_t nThresholds = aThreshold.size();
+    for(size_t i = 0; i < nThresholds; ++i)
+    {
+        ++_edgesOffset[aThreshold[i].featureIdx + 1];
+        if(aThreshold[i].featureUnordered)
+            _unordered[aThreshold[i].featureIdx] = 1;
+    }
+    for(size_t i = 0; i < nFeatures; ++i)
+        _edgesOffset[i + 1] += _edgesOffset[i];
+
+    //split values are grouped by features, sorted and made unique within each feature
+    TVector<double, sse2> aValue(nThresholds, 0);
+    TVector<size_t, sse2> aPos(nFeatures + 1, 0);
+    DAAL_CHECK_MALLOC((!nThresholds || aValue.get()) && aPos.get());
+    for(size_t i = 0; i < nFeatures; ++i)
+        aPos[i] = _edgesOffset[i];
+    for(size_t i = 0; i < nThresholds; ++i)
+        aValue[aPos[aThreshold[i].featureIdx]++] = aThreshold[i].featureValue;
+
+    _edges.resize(nThresholds, 0);
+    DAAL_CHECK_MALLOC(!nThresholds || _edges.get());
+    size_t nEdges = 0;
+    _maxBins = 1;
+    for(size_t iFeature = 0; iFeature < nFeatures; ++iFeature)
+    {
+        double* val = aValue.get() + _edgesOffset[iFeature];
+        const size_t n = _edgesOffset[iFeature + 1] - _edgesOffset[iFeature];
+        if(n)
+            daal::algorithms::internal::qSort<double, sse2>(n, val);
+        const size_t iStart = nEdges;
+        for(size_t i = 0; i < n; ++i)
+        {
+            const bool bSame = (nEdges > iStart) && (_unordered[iFeature] ? (int(_edges[nEdges - 1]) == int(val[i])) :
+                (_edges[nEdges - 1] == val[i]));
+            if(!bSame)
+                _edges[nEdges++] = val[i];
+        }
+        //bin index of the feature and the index of values not equal to any category must fit in the node
+        DAAL_CHECK(nEdges - iStart < size_t(CompactTreeNode::leafMark), services::ErrorIncorrectSizeOfModel);
+        _edgesOffset[iFeature] = iStart;
+        if(_maxBins < nEdges - iStart + 1)
+            _maxBins = nEdges - iStart + 1;
+    }
+    _edgesOffset[nFeatures] = nEdges;
+    _nFeatures = nFeatures;
+    return services::Status();
+}
+
+size_t CompactForest::findEdge(size_t iFeature, double featureValue) const
+{
+    return isUnordered(iFeature) ? categoryBin(edges(iFeature), nEdges(iFeature), featureValue) :
+        valueBin(edges(iFeature), nEdges(iFeature), featureValue);
+}
+
 } // namespace internal
 } // namespace decision_forest
 } // namespace algorithms
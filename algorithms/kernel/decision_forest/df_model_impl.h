@@ -27,6 +27,8 @@
 #include "env_detect.h"
 #include "daal_shared_ptr.h"
 #include "service_defines.h"
+#include "services/collection.h"
+#include "services/error_handling.h"
 
 typedef size_t ClassIndexType;
 typedef double ClassificationFPType; //type of features stored in classification model
@@ -266,6 +268,129 @@ using TreeImpRegression = TreeImpl<TreeNodeRegression<RegressionFPType>, Allocat
 template<typename Allocator = HeapMemoryAllocator<TreeNodeClassification<ClassificationFPType> > >
 using TreeImpClassification = TreeImpl<TreeNodeClassification<ClassificationFPType>, Allocator>;
 
+//Node of the compact tree used for prediction only
+struct CompactTreeNode
+{
+    enum
+    {
+        unorderedMask = 0x8000, //set in featureIdx if the feature is unordered
+        leafMark = 0xFFFF       //featureIdx of a leaf
+    };
+    unsigned int kid;           //split: index of the left kid in the tree, the right kid follows it; leaf: response index
+    unsigned short featureIdx;  //split: index of the feature; leaf: leafMark
+    unsigned short bin;         //split: index of the bin edge of the feature used as a threshold
+
+    bool isSplit() const { return featureIdx != leafMark; }
+    size_t feature() const { return featureIdx & ~size_t(unorderedMask); }
+    bool isUnordered() const { return (featureIdx & unorderedMask) != 0; }
+};
+
+//Split value of the feature collected from the trees
+struct SplitThreshold
+{
+    size_t featureIdx;
+    double featureValue;
+    bool featureUnordered;
+};
+
+//Inference-only representation of the decision forest.
+//Split values are replaced with indices of the bin edges of the features, the bin edges of a feature are
+//the sorted unique values of its splits. Trees are stored breadth-first, the kids of a split are adjacent.
+//A value goes to the right kid of an ordered split if its bin is greater than the split bin, and
+//if its bin differs from the split bin in case of unordered (categorical) feature.
+class CompactForest
+{
+public:
+    CompactForest() : _nTrees(0), _nFeatures(0), _maxBins(0){}
+
+    size_t nTrees() const { return _nTrees; }
+    size_t nFeatures() const { return _nFeatures; }
+    //Maximal number of bins of a feature, including the bin of values not equal to any category
+    size_t maxBins() const { return _maxBins; }
+    bool empty() const { return !_nTrees; }
+
+    const double* edges(size_t iFeature) const { return _edges.get() + _edgesOffset[iFeature]; }
+    size_t nEdges(size_t iFeature) const { return _edgesOffset[iFeature + 1] - _edgesOffset[iFeature]; }
+    bool isUnordered(size_t iFeature) const { return _unordered[iFeature] != 0; }
+    double leafValue(size_t i) const { return _leafValue[i]; }
+
+    //Number of bin edges less than the value
+    static size_t valueBin(const double* edges, size_t nEdges, double val)
+    {
+        size_t lo = 0;
+        for(size_t hi = nEdges; lo < hi;)
+        {
+            const size_t mid = (lo + hi) / 2;
+            if(edges[mid] < val)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    //Index of the bin edge equal to the category, nEdges if there is no such edge
+    static size_t categoryBin(const double* edges, size_t nEdges, double val)
+    {
+        const int v = int(val);
+        size_t lo = 0;
+        for(size_t hi = nEdges; lo < hi;)
+        {
+            const size_t mid = (lo + hi) / 2;
+            if(int(edges[mid]) < v)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return (lo < nEdges && int(edges[lo]) == v) ? lo : nEdges;
+    }
+
+    template <typename BinType>
+    const CompactTreeNode* findLeaf(size_t iTree, const BinType* bins) const
+    {
+        const CompactTreeNode* aNode = _nodes.get() + _treeOffset[iTree];
+        const CompactTreeNode* pNode = aNode;
+        for(; pNode->isSplit();)
+        {
+            const size_t bin = bins[pNode->feature()];
+            const size_t sn = (pNode->isUnordered() ? (bin != pNode->bin) : (bin > pNode->bin));
+            pNode = aNode + pNode->kid + sn;
+        }
+        return pNode;
+    }
+
+    template <typename TreeType, typename GetLeafValue>
+    services::Status build(const Tree* const* aTree, size_t nTrees, bool bStoreLeafValues, const GetLeafValue& getLeafValue);
+
+    template <typename Visitor, typename GetResponse>
+    void traverseDF(size_t iTree, Visitor& visitor, const GetResponse& getResponse) const;
+
+    template <typename Visitor, typename GetResponse>
+    void traverseBF(size_t iTree, Visitor& visitor, const GetResponse& getResponse) const;
+
+protected:
+    services::Status setEdges(const services::Collection<SplitThreshold>& aThreshold, size_t nFeatures);
+    size_t findEdge(size_t iFeature, double featureValue) const;
+
+    template <typename NodeType>
+    static bool collectSplits(const typename NodeType::Base* n, size_t& nNodes, size_t& nLeaves,
+        services::Collection<SplitThreshold>& aThreshold);
+
+    template <typename Visitor, typename GetResponse>
+    bool traverseNodeDF(const CompactTreeNode* aNode, size_t i, size_t level, Visitor& visitor, const GetResponse& getResponse) const;
+
+protected:
+    size_t _nTrees;
+    size_t _nFeatures;
+    size_t _maxBins;
+    TVector<double, sse2> _edges;               //bin edges of all features
+    TVector<size_t, sse2> _edgesOffset;         //offsets of the bin edges of the features in _edges, size is nFeatures + 1
+    TVector<unsigned char, sse2> _unordered;    //flags of unordered features
+    TVector<CompactTreeNode, sse2> _nodes;      //nodes of all trees
+    TVector<size_t, sse2> _treeOffset;          //offsets of the trees in _nodes, size is nTrees + 1
+    TVector<double, sse2> _leafValue;           //responses of the leaves, when they are not stored in the nodes
+};
+
 class ModelImpl
 {
 public:
@@ -277,6 +402,9 @@ public:
     bool add(Tree* pTree);
     bool reserve(size_t nTrees);
 
+    bool isCompact() const { return !_compactForest.empty(); }
+    const CompactForest& compactForest() const { return _compactForest; }
+
 protected:
     void destroy();
 
@@ -284,6 +412,7 @@ protected:
     Tree** _aTree;
     daal::services::Atomic<size_t> _nTree;
     size_t _nCapacity;
+    CompactForest _compactForest;
 };
 
 template <typename NodeType>
@@ -302,6 +431,160 @@ TreeImpl<NodeType, Allocator>::~TreeImpl()
         deleteNode<NodeType, Allocator>(_top);
 }
 
+template <typename NodeType>
+bool CompactForest::collectSplits(const typename NodeType::Base* n, size_t& nNodes, size_t& nLeaves,
+    services::Collection<SplitThreshold>& aThreshold)
+{
+    ++nNodes;
+    if(!n->isSplit())
+    {
+        ++nLeaves;
+        return true;
+    }
+    const typename NodeType::Split* s = NodeType::castSplit(n);
+    if(!s->left() || !s->right() || s->featureIdx < 0)
+        return false;
+    SplitThreshold t;
+    t.featureIdx = s->featureIdx;
+    t.featureValue = s->featureValue;
+    t.featureUnordered = s->featureUnordered;
+    aThreshold.push_back(t);
+    return collectSplits<NodeType>(s->left(), nNodes, nLeaves, aThreshold) &&
+        collectSplits<NodeType>(s->right(), nNodes, nLeaves, aThreshold);
+}
+
+template <typename TreeType, typename GetLeafValue>
+services::Status CompactForest::build(const Tree* const* aTree, size_t nTrees, bool bStoreLeafValues, const GetLeafValue& getLeafValue)
+{
+    typedef typename TreeType::NodeType NodeType;
+
+    //collect the split values and the sizes of the trees
+    TVector<size_t, sse2> treeOffset(nTrees + 1, 0);
+    DAAL_CHECK_MALLOC(treeOffset.get());
+    services::Collection<SplitThreshold> aThreshold;
+    size_t nLeaves = 0;
+    size_t nFeatures = 0;
+    size_t maxTreeSize = 0;
+    for(size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        const TreeType* pTree = static_cast<const TreeType*>(aTree[iTree]);
+        DAAL_CHECK(pTree && pTree->top(), services::ErrorModelNotFullInitialized);
+        size_t nNodes = 0;
+        DAAL_CHECK(collectSplits<NodeType>(pTree->top(), nNodes, nLeaves, aThreshold), services::ErrorModelNotFullInitialized);
+        DAAL_CHECK(nNodes < size_t(unsigned(-1)), services::ErrorIncorrectSizeOfModel);
+        treeOffset[iTree + 1] = treeOffset[iTree] + nNodes;
+        if(maxTreeSize < nNodes)
+            maxTreeSize = nNodes;
+    }
+    for(size_t i = 0; i < aThreshold.size(); ++i)
+    {
+        if(nFeatures <= aThreshold[i].featureIdx)
+            nFeatures = aThreshold[i].featureIdx + 1;
+    }
+    DAAL_CHECK(nFeatures < size_t(CompactTreeNode::unorderedMask), services::ErrorIncorrectSizeOfModel);
+    DAAL_CHECK(!bStoreLeafValues || nLeaves < size_t(unsigned(-1)), services::ErrorIncorrectSizeOfModel);
+
+    services::Status s = setEdges(aThreshold, nFeatures);
+    if(!s)
+        return s;
+
+    _nodes.resize(treeOffset[nTrees], CompactTreeNode());
+    if(bStoreLeafValues)
+        _leafValue.resize(nLeaves, 0);
+    TVector<const typename NodeType::Base*, sse2> aQueue(maxTreeSize, nullptr);
+    DAAL_CHECK_MALLOC((!treeOffset[nTrees] || _nodes.get()) && (!bStoreLeafValues || !nLeaves || _leafValue.get()) &&
+        (!maxTreeSize || aQueue.get()));
+
+    //nodes of each tree are stored in the breadth-first order
+    size_t iLeaf = 0;
+    for(size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        CompactTreeNode* aNode = _nodes.get() + treeOffset[iTree];
+        aQueue[0] = static_cast<const TreeType*>(aTree[iTree])->top();
+        size_t nQueued = 1;
+        for(size_t i = 0; i < nQueued; ++i)
+        {
+            CompactTreeNode& cn = aNode[i];
+            if(aQueue[i]->isSplit())
+            {
+                const typename NodeType::Split* pSplit = NodeType::castSplit(aQueue[i]);
+                const size_t iFeature = pSplit->featureIdx;
+                cn.featureIdx = (unsigned short)(iFeature | (isUnordered(iFeature) ? size_t(CompactTreeNode::unorderedMask) : 0));
+                cn.bin = (unsigned short)findEdge(iFeature, pSplit->featureValue);
+                cn.kid = (unsigned int)nQueued;
+                aQueue[nQueued++] = pSplit->left();
+                aQueue[nQueued++] = pSplit->right();
+            }
+            else
+            {
+                const double val = getLeafValue(NodeType::castLeaf(aQueue[i]));
+                cn.featureIdx = (unsigned short)CompactTreeNode::leafMark;
+                cn.bin = 0;
+                if(bStoreLeafValues)
+                {
+                    _leafValue[iLeaf] = val;
+                    cn.kid = (unsigned int)iLeaf++;
+                }
+                else
+                {
+                    cn.kid = (unsigned int)val;
+                }
+            }
+        }
+    }
+    _treeOffset.resize(nTrees + 1, 0);
+    DAAL_CHECK_MALLOC(_treeOffset.get());
+    for(size_t i = 0; i <= nTrees; ++i)
+        _treeOffset[i] = treeOffset[i];
+    _nTrees = nTrees;
+    return s;
+}
+
+template <typename Visitor, typename GetResponse>
+bool CompactForest::traverseNodeDF(const CompactTreeNode* aNode, size_t i, size_t level, Visitor& visitor,
+    const GetResponse& getResponse) const
+{
+    const CompactTreeNode& n = aNode[i];
+    if(!n.isSplit())
+        return visitor.onLeafNode(level, getResponse(n.kid));
+    if(!visitor.onSplitNode(level, n.feature(), edges(n.feature())[n.bin]))
+        return false; //do not continue traversing
+    return traverseNodeDF(aNode, n.kid, level + 1, visitor, getResponse) &&
+        traverseNodeDF(aNode, n.kid + 1, level + 1, visitor, getResponse);
+}
+
+template <typename Visitor, typename GetResponse>
+void CompactForest::traverseDF(size_t iTree, Visitor& visitor, const GetResponse& getResponse) const
+{
+    if(iTree < _nTrees)
+        traverseNodeDF(_nodes.get() + _treeOffset[iTree], 0, 0, visitor, getResponse);
+}
+
+template <typename Visitor, typename GetResponse>
+void CompactForest::traverseBF(size_t iTree, Visitor& visitor, const GetResponse& getResponse) const
+{
+    if(iTree >= _nTrees)
+        return;
+    const CompactTreeNode* aNode = _nodes.get() + _treeOffset[iTree];
+    const size_t nNodes = _treeOffset[iTree + 1] - _treeOffset[iTree];
+    TVector<size_t, sse2> aLevel(nNodes, 0);
+    if(!aLevel.get())
+        return;
+    //nodes are stored in the breadth-first order
+    for(size_t i = 0; i < nNodes; ++i)
+    {
+        const CompactTreeNode& n = aNode[i];
+        if(n.isSplit())
+        {
+            aLevel[n.kid] = aLevel[n.kid + 1] = aLevel[i] + 1;
+            if(!visitor.onSplitNode(aLevel[i], n.feature(), edges(n.feature())[n.bin]))
+                return; //do not continue traversing
+        }
+        else if(!visitor.onLeafNode(aLevel[i], getResponse(n.kid)))
+            return; //do not continue traversing
+    }
+}
+
 } // namespace internal
 } // namespace decision_forest
 } // namespace algorithms
@@ -72,6 +72,33 @@ const typename TreeType::NodeType::Base* findNode(const decision_forest::interna
     return pNode;
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Replaces the values of the features used by the compact forest with the indices of their bins,
+// each feature is processed for all rows at once to keep its bin edges in cache
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename BinType, CpuType cpu>
+void quantizeRows(const decision_forest::internal::CompactForest& forest, const algorithmFPType* x, size_t nRows, size_t nCols,
+    BinType* bins)
+{
+    typedef decision_forest::internal::CompactForest CompactForest;
+    const size_t nFeatures = forest.nFeatures();
+    for(size_t iFeature = 0; iFeature < nFeatures; ++iFeature)
+    {
+        const double* edges = forest.edges(iFeature);
+        const size_t nEdges = forest.nEdges(iFeature);
+        if(forest.isUnordered(iFeature))
+        {
+            for(size_t iRow = 0; iRow < nRows; ++iRow)
+                bins[iRow*nFeatures + iFeature] = BinType(CompactForest::categoryBin(edges, nEdges, x[iRow*nCols + iFeature]));
+        }
+        else
+        {
+            for(size_t iRow = 0; iRow < nRows; ++iRow)
+                bins[iRow*nFeatures + iFeature] = BinType(CompactForest::valueBin(edges, nEdges, x[iRow*nCols + iFeature]));
+        }
+    }
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace decision_forest */
@@ -520,6 +520,8 @@ protected:
     size_t nFeatures() const { return _data->getNumberOfColumns(); }
     typename DataHelper::NodeType::Base* build(size_t iStart, size_t n, size_t level,
         typename DataHelper::ImpurityData& curImpurity, bool& bUnorderedFeaturesUsed);
+    typename DataHelper::NodeType::Base* buildLevelWise(typename DataHelper::ImpurityData& initialImpurity,
+        bool& bUnorderedFeaturesUsed);
     algorithmFPType* featureBuf(size_t iBuf) const { DAAL_ASSERT(iBuf < _nFeatureBufs); return _aFeatureBuf[iBuf].get(); }
     IndexType* featureIndexBuf(size_t iBuf) const { DAAL_ASSERT(iBuf < _nFeatureBufs); return _aFeatureIndexBuf[iBuf].get(); }
     bool terminateCriteria(size_t nSamples, size_t level, algorithmFPType impurityValue) const
@@ -541,6 +543,8 @@ protected:
         IndexType& iFeatureBest, typename DataHelper::TSplitData& split);
     void addImpurityDecrease(IndexType iFeature, size_t n, const typename DataHelper::ImpurityData& curImpurity,
         const typename DataHelper::TSplitData& split);
+    void moveSplitIndices(IndexType* aIdx, const IndexType* bestSplitIdx, size_t n,
+        const typename DataHelper::TSplitData& bestSplit) const;
 
     void featureValuesToBuf(size_t iFeature, algorithmFPType* featureVal, IndexType* aIdx, size_t n)
     {
@@ -626,7 +630,8 @@ decision_forest::internal::Tree* TrainBatchTaskBase<algorithmFPType, DataHelper,
     typename DataHelper::ImpurityData initialImpurity;
     _helper.calcImpurity(_aSample.get(), _nSamples, initialImpurity);
     bool bUnorderedFeaturesUsed = false;
-    typename DataHelper::NodeType::Base* nd = build(0, _nSamples, 0, initialImpurity, bUnorderedFeaturesUsed);
+    typename DataHelper::NodeType::Base* nd = (_par.levelWiseTreeBuilding ? buildLevelWise(initialImpurity, bUnorderedFeaturesUsed) :
+        build(0, _nSamples, 0, initialImpurity, bUnorderedFeaturesUsed));
     if(!nd)
         return nullptr;
     decision_forest::internal::Tree* pTree = new decision_forest::internal::TreeImpl<typename DataHelper::NodeType>(nd, bUnorderedFeaturesUsed);
@@ -688,6 +693,272 @@ typename DataHelper::NodeType::Base* TrainBatchTaskBase<algorithmFPType, DataHel
     return _helper.makeLeaf(_aSample.get() + iStart, n, curImpurity);
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Service structures of the level-wise tree building
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename DataHelper>
+struct FrontierNode
+{
+    size_t iStart;
+    size_t n;
+    typename DataHelper::ImpurityData impurity;
+    typename DataHelper::NodeType::Base** ppNode; //location of the pointer to the node in the tree
+};
+
+template <typename algorithmFPType, CpuType cpu>
+struct LevelWiseBuffers
+{
+    LevelWiseBuffers(size_t n) : featureVal(n), aIdx(n) {}
+    bool isValid() const { return featureVal.get() && aIdx.get(); }
+    TArray<algorithmFPType, cpu> featureVal;
+    TArray<IndexType, cpu> aIdx;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Builds the tree level by level. Best splits of all nodes of the level are searched in parallel
+// over pairs (node, feature) ordered by decreasing node size, so that the threading layer
+// balances large and small nodes. Random choice of features is done sequentially in the level order.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename DataHelper, CpuType cpu>
+typename DataHelper::NodeType::Base* TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::buildLevelWise(
+    typename DataHelper::ImpurityData& initialImpurity, bool& bUnorderedFeaturesUsed)
+{
+    typedef FrontierNode<DataHelper> TFrontierNode;
+    typedef typename DataHelper::NodeType::Base NodeBase;
+    typedef typename DataHelper::TSplitData TSplitData;
+    typedef LevelWiseBuffers<algorithmFPType, cpu> TBuffers;
+
+    NodeBase* root = nullptr;
+    TArray<TFrontierNode, cpu> frontier(1);
+    if(!frontier.get())
+        return nullptr;
+    frontier[0].iStart = 0;
+    frontier[0].n = _nSamples;
+    frontier[0].impurity = initialImpurity;
+    frontier[0].ppNode = &root;
+    size_t nFrontier = 1;
+
+    daal::tls<TBuffers*> tlsBuffers([=]()->TBuffers*
+    {
+        TBuffers* ptr = new TBuffers(_nSamples);
+        if(ptr && !ptr->isValid())
+        {
+            delete ptr;
+            ptr = nullptr;
+        }
+        return ptr;
+    });
+
+    bool bOk = true;
+    const size_t nF = _nFeaturesPerNode;
+    for(size_t level = 0; nFrontier && bOk; ++level)
+    {
+        TArray<IndexType, cpu> aBestFeature(nFrontier);
+        TArray<bool, cpu> aHasSplit(nFrontier);
+        TArray<bool, cpu> aSearch(nFrontier);
+        TArray<TSplitData, cpu> aBestSplit(nFrontier);
+        TArray<IndexType, cpu> aFeatureIdx(nFrontier*nF);
+        if(!aBestFeature.get() || !aHasSplit.get() || !aSearch.get() || !aBestSplit.get() || !aFeatureIdx.get())
+        {
+            bOk = false;
+            break;
+        }
+
+        //sequential pass: terminal nodes, nodes of two observations and random choice of features
+        size_t nSearch = 0;
+        for(size_t i = 0; i < nFrontier; ++i)
+        {
+            TFrontierNode& nd = frontier[i];
+            aHasSplit[i] = false;
+            aSearch[i] = false;
+            if(terminateCriteria(nd.n, level, nd.impurity.value()))
+                continue;
+            if(nd.n == 2)
+            {
+                aHasSplit[i] = simpleSplit(nd.iStart, nd.impurity, aBestFeature[i], aBestSplit[i]);
+                continue;
+            }
+            chooseFeatures();
+            for(size_t j = 0; j < nF; ++j)
+                aFeatureIdx[i*nF + j] = _aFeatureIdx[j];
+            aSearch[i] = true;
+            ++nSearch;
+        }
+
+        if(nSearch)
+        {
+            //nodes to search the split in are ordered by decreasing size
+            TArray<algorithmFPType, cpu> aOrderKey(nSearch);
+            TArray<IndexType, cpu> aOrder(nSearch);
+            TArray<TSplitData, cpu> aSplit(nSearch*nF);
+            TArray<bool, cpu> aFound(nSearch*nF);
+            if(!aOrderKey.get() || !aOrder.get() || !aSplit.get() || !aFound.get())
+            {
+                bOk = false;
+                break;
+            }
+            for(size_t i = 0, k = 0; i < nFrontier; ++i)
+            {
+                if(!aSearch[i])
+                    continue;
+                aOrderKey[k] = -algorithmFPType(frontier[i].n);
+                aOrder[k++] = i;
+            }
+            daal::algorithms::internal::qSort<algorithmFPType, IndexType, cpu>(nSearch, aOrderKey.get(), aOrder.get());
+
+            bool bMemoryAllocationFailed = false;
+            const size_t nPairs = nSearch*nF;
+            daal::threader_for(nPairs, nPairs, [&](size_t iPair)
+            {
+                const size_t iNode = aOrder[iPair / nF];
+                const IndexType iFeature = aFeatureIdx[iNode*nF + iPair % nF];
+                const TFrontierNode& nd = frontier[iNode];
+                aFound[iPair] = false;
+
+                TBuffers* buf = tlsBuffers.local();
+                if(!buf)
+                {
+                    bMemoryAllocationFailed = true;
+                    return;
+                }
+                algorithmFPType* featBuf = buf->featureVal.get();
+                IndexType* aIdx = buf->aIdx.get();
+                daal::services::daal_memcpy_s(aIdx, sizeof(IndexType)*nd.n, _aSample.get() + nd.iStart, sizeof(IndexType)*nd.n);
+                featureValuesToBuf(iFeature, featBuf, aIdx, nd.n);
+                if(featBuf[nd.n - 1] - featBuf[0] < _accuracy) //all values of the feature are the same
+                    return;
+                TSplitData& split = aSplit[iPair];
+                split.featureUnordered = _featHelper.isUnordered(iFeature);
+                aFound[iPair] = _helper.findBestSplitForFeature(featBuf, aIdx, nd.n, _par.minObservationsInLeafNode,
+                    _accuracy, nd.impurity, split);
+            });
+            if(bMemoryAllocationFailed)
+            {
+                bOk = false;
+                break;
+            }
+
+            //choose the best split of each node in the order of its features, as the serial search does
+            for(size_t k = 0; k < nSearch; ++k)
+            {
+                const size_t iNode = aOrder[k];
+                const size_t n = frontier[iNode].n;
+                int iBest = -1;
+                for(size_t j = 0; j < nF; ++j)
+                {
+                    TSplitData& split = aSplit[k*nF + j];
+                    if(!aFound[k*nF + j])
+                        continue;
+                    if(iBest < 0 || split.totalImpurity(n) < aBestSplit[iNode].totalImpurity(n))
+                    {
+                        iBest = j;
+                        split.copyTo(aBestSplit[iNode]);
+                    }
+                }
+                if(iBest >= 0)
+                {
+                    aHasSplit[iNode] = true;
+                    aBestFeature[iNode] = aFeatureIdx[iNode*nF + iBest];
+                }
+            }
+
+            //reorder the observations of each split node by its best feature, nodes occupy disjoint ranges
+            daal::threader_for(nSearch, nSearch, [&](size_t k)
+            {
+                const size_t iNode = aOrder[k];
+                if(!aHasSplit[iNode])
+                    return;
+                const TFrontierNode& nd = frontier[iNode];
+                IndexType* aIdx = _aSample.get() + nd.iStart;
+                IndexType* bestSplitIdx = featureIndexBuf(0) + nd.iStart;
+                daal::services::daal_memcpy_s(bestSplitIdx, sizeof(IndexType)*nd.n, aIdx, sizeof(IndexType)*nd.n);
+                featureValuesToBuf(aBestFeature[iNode], featureBuf(0) + nd.iStart, bestSplitIdx, nd.n);
+                moveSplitIndices(aIdx, bestSplitIdx, nd.n, aBestSplit[iNode]);
+            });
+        }
+
+        //sequential pass: create the nodes of the level and the frontier of the next level
+        size_t nNextFrontier = 0;
+        for(size_t i = 0; i < nFrontier; ++i)
+            nNextFrontier += (aHasSplit[i] ? 2 : 0);
+        TArray<TFrontierNode, cpu> nextFrontier(nNextFrontier);
+        if(nNextFrontier && !nextFrontier.get())
+        {
+            bOk = false;
+            break;
+        }
+        for(size_t i = 0, k = 0; i < nFrontier; ++i)
+        {
+            TFrontierNode& nd = frontier[i];
+            if(!aHasSplit[i])
+            {
+                NodeBase* leaf = _helper.makeLeaf(_aSample.get() + nd.iStart, nd.n, nd.impurity);
+                if(!leaf)
+                {
+                    bOk = false;
+                    break;
+                }
+                *nd.ppNode = leaf;
+                continue;
+            }
+            const TSplitData& split = aBestSplit[i];
+            typename DataHelper::NodeType::Split* pSplit = makeSplit(aBestFeature[i], split.featureValue, split.featureUnordered,
+                nullptr, nullptr, nd.impurity.var);
+            if(!pSplit)
+            {
+                bOk = false;
+                break;
+            }
+            *nd.ppNode = pSplit;
+            bUnorderedFeaturesUsed |= split.featureUnordered;
+            if(_par.varImportance == training::MDI)
+                addImpurityDecrease(aBestFeature[i], nd.n, nd.impurity, split);
+
+            TFrontierNode& left = nextFrontier[k++];
+            left.iStart = nd.iStart;
+            left.n = split.nLeft;
+            left.impurity = split.left;
+            left.ppNode = &pSplit->kid[0];
+            TFrontierNode& right = nextFrontier[k++];
+            right.iStart = nd.iStart + split.nLeft;
+            right.n = nd.n - split.nLeft;
+            right.impurity = split.right;
+            right.ppNode = &pSplit->kid[1];
+        }
+        if(!bOk)
+            break;
+
+        //the frontier of the next level replaces the current one
+        frontier.reset(nNextFrontier);
+        if(nNextFrontier && !frontier.get())
+        {
+            bOk = false;
+            break;
+        }
+        for(size_t i = 0; i < nNextFrontier; ++i)
+        {
+            frontier[i].iStart = nextFrontier[i].iStart;
+            frontier[i].n = nextFrontier[i].n;
+            frontier[i].impurity = nextFrontier[i].impurity;
+            frontier[i].ppNode = nextFrontier[i].ppNode;
+        }
+        nFrontier = nNextFrontier;
+    }
+
+    tlsBuffers.reduce([](TBuffers* ptr)-> void
+    {
+        delete ptr;
+    });
+
+    if(!bOk)
+    {
+        if(root)
+            decision_forest::internal::deleteNode<typename DataHelper::NodeType, typename DataHelper::TreeType::Allocator>(root);
+        return nullptr;
+    }
+    return root;
+}
+
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
 bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::simpleSplit(size_t iStart,
     const typename DataHelper::ImpurityData& curImpurity, IndexType& iFeatureBest, typename DataHelper::TSplitData& split)
@@ -766,29 +1037,36 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitSerial(s
     if(iBestSplit < 0)
         return false;
 
-    if(bestSplit.featureUnordered)
+    if(bestSplit.featureUnordered || (size_t(iBestSplit + 1) < _nFeaturesPerNode))
+        moveSplitIndices(aIdx, bestSplitIdx, n, bestSplit);
+    iFeatureBest = _aFeatureIdx[iBestSplit];
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Copies the indices sorted by the feature of the best split back to the node,
+// moving the observations of the left part of the categorical feature split to the beginning
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename DataHelper, CpuType cpu>
+void TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::moveSplitIndices(IndexType* aIdx, const IndexType* bestSplitIdx,
+    size_t n, const typename DataHelper::TSplitData& bestSplit) const
+{
+    if(bestSplit.featureUnordered && bestSplit.iStart)
     {
-        if(bestSplit.iStart)
-        {
-            DAAL_ASSERT(bestSplit.iStart + bestSplit.nLeft <= n);
-            daal::services::daal_memcpy_s(aIdx, sizeof(IndexType)*bestSplit.nLeft, bestSplitIdx + bestSplit.iStart, sizeof(IndexType)*bestSplit.nLeft);
-            aIdx += bestSplit.nLeft;
-            daal::services::daal_memcpy_s(aIdx, sizeof(IndexType)*bestSplit.iStart, bestSplitIdx, sizeof(IndexType)*bestSplit.iStart);
-            aIdx += bestSplit.iStart;
-            bestSplitIdx += bestSplit.iStart + bestSplit.nLeft;
-            n -= bestSplit.iStart + bestSplit.nLeft;
-            if(n)
-                daal::services::daal_memcpy_s(aIdx, sizeof(IndexType)*n, bestSplitIdx, sizeof(IndexType)*n);
-        }
-        else
-        {
+        DAAL_ASSERT(bestSplit.iStart + bestSplit.nLeft <= n);
+        daal::services::daal_memcpy_s(aIdx, sizeof(IndexType)*bestSplit.nLeft, bestSplitIdx + bestSplit.iStart, sizeof(IndexType)*bestSplit.nLeft);
+        aIdx += bestSplit.nLeft;
+        daal::services::daal_memcpy_s(aIdx, sizeof(IndexType)*bestSplit.iStart, bestSplitIdx, sizeof(IndexType)*bestSplit.iStart);
+        aIdx += bestSplit.iStart;
+        bestSplitIdx += bestSplit.iStart + bestSplit.nLeft;
+        n -= bestSplit.iStart + bestSplit.nLeft;
+        if(n)
             daal::services::daal_memcpy_s(aIdx, sizeof(IndexType)*n, bestSplitIdx, sizeof(IndexType)*n);
-        }
     }
-    else if(iBestSplit + 1 < _nFeaturesPerNode)
+    else
+    {
         daal::services::daal_memcpy_s(aIdx, sizeof(IndexType)*n, bestSplitIdx, sizeof(IndexType)*n);
-    iFeatureBest = _aFeatureIdx[iBestSplit];
-    return true;
+    }
 }
 
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
@@ -49,7 +49,7 @@ namespace internal
 
 size_t ModelImpl::numberOfTrees() const
 {
-    return ImplType::size();
+    return isCompact() ? compactForest().nTrees() : ImplType::size();
 }
 
 static bool traverseNodeDF(size_t level, const ModelImpl::TreeType::NodeType::Base& n, decision_forest::regression::NodeVisitor& visitor)
@@ -70,6 +70,12 @@ static bool traverseNodeDF(size_t level, const ModelImpl::TreeType::NodeType::Ba
 
 void ModelImpl::traverseDF(size_t iTree, decision_forest::regression::NodeVisitor& visitor) const
 {
+    if(isCompact())
+    {
+        const decision_forest::internal::CompactForest& f = compactForest();
+        f.traverseDF(iTree, visitor, [&f](size_t kid)->double { return f.leafValue(kid); });
+        return;
+    }
     if(iTree >= size())
         return;
     const TreeType* t = static_cast<const TreeType*>(this->at(iTree));
@@ -110,6 +116,12 @@ static bool traverseNodesBF(size_t level, NodePtrArray& aCur,
 
 void ModelImpl::traverseBF(size_t iTree, NodeVisitor& visitor) const
 {
+    if(isCompact())
+    {
+        const decision_forest::internal::CompactForest& f = compactForest();
+        f.traverseBF(iTree, visitor, [&f](size_t kid)->double { return f.leafValue(kid); });
+        return;
+    }
     if(iTree >= size())
         return;
     const TreeType* t = static_cast<const TreeType*>(this->at(iTree));
@@ -122,6 +134,18 @@ void ModelImpl::traverseBF(size_t iTree, NodeVisitor& visitor) const
     }
 }
 
+static double leafResponse(const ModelImpl::TreeType::NodeType::Leaf* l) { return l->response; }
+
+services::Status ModelImpl::compact()
+{
+    if(isCompact())
+        return services::Status();
+    services::Status s = _compactForest.build<TreeType>(_aTree, size(), true, leafResponse);
+    if(s)
+        destroy();
+    return s;
+}
+
 } // namespace interface1
 } // namespace regression
 } // namespace decision_forest
@@ -33,6 +33,7 @@
 #include "service_numeric_table.h"
 #include "service_error_handling.h"
 #include "service_memory.h"
+#include "service_tuning.h"
 #include "df_predict_dense_default_impl.i"
 
 using namespace daal::internal;
@@ -51,8 +52,6 @@ namespace prediction
 namespace internal
 {
 
-static const size_t nRowsInBlock = 500;
-
 //////////////////////////////////////////////////////////////////////////////////////////
 // PredictRegressionTask
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -66,6 +65,10 @@ public:
 
     services::Status run();
 
+protected:
+    template <typename BinType>
+    services::Status runCompact();
+
 protected:
     static algorithmFPType predict(const decision_forest::internal::Tree& t, const algorithmFPType* x)
     {
@@ -96,8 +99,12 @@ services::Status PredictKernel<algorithmFPType, method, cpu>::compute(const Nume
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTask<algorithmFPType, cpu>::run()
 {
+    if(_model->isCompact())
+        return (_model->compactForest().maxBins() <= 256 ? runCompact<unsigned char>() : runCompact<unsigned short>());
+
     const auto nRows = _data->getNumberOfRows();
     const auto nCols = _data->getNumberOfColumns();
+    const size_t nRowsInBlock = services::internal::getTuningParameter<cpu>(services::Environment::dfPredictionBlockSize);
     size_t nBlocks = nRows / nRowsInBlock;
     nBlocks += (nBlocks * nRowsInBlock != nRows);
 
@@ -129,6 +136,57 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run()
     return safeStat.detach();
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Prediction with the compact forest: rows of a block are binned once, then responses
+// of each tree are accumulated for all rows of the block
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+template <typename BinType>
+services::Status PredictRegressionTask<algorithmFPType, cpu>::runCompact()
+{
+    const decision_forest::internal::CompactForest& forest = _model->compactForest();
+    const auto nRows = _data->getNumberOfRows();
+    const auto nCols = _data->getNumberOfColumns();
+    const size_t nFeatures = forest.nFeatures();
+    const size_t nTrees = forest.nTrees();
+    DAAL_CHECK(nFeatures <= nCols, services::ErrorIncorrectNumberOfFeatures);
+    const size_t nRowsInBlock = services::internal::getTuningParameter<cpu>(services::Environment::dfPredictionBlockSize);
+    size_t nBlocks = nRows / nRowsInBlock;
+    nBlocks += (nBlocks * nRowsInBlock != nRows);
+
+    WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(resBD);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStartRow = iBlock*nRowsInBlock;
+        const size_t nRowsToProcess = (iBlock == nBlocks - 1) ? nRows - iBlock * nRowsInBlock : nRowsInBlock;
+        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable*>(_data), iStartRow, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        TArray<BinType, cpu> aBin(nFeatures ? nRowsToProcess*nFeatures : 1);
+        DAAL_CHECK_THR(aBin.get(), services::ErrorMemoryAllocationFailed);
+        BinType* bins = aBin.get();
+        decision_forest::prediction::internal::quantizeRows<algorithmFPType, BinType, cpu>(forest, xBD.get(), nRowsToProcess, nCols, bins);
+
+        algorithmFPType* res = resBD.get() + iStartRow;
+        for(size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+            res[iRow] = 0;
+        for(size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            for(size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+                res[iRow] += algorithmFPType(forest.leafValue(forest.findLeaf<BinType>(iTree, bins + iRow*nFeatures)->kid));
+        }
+        if(nTrees)
+        {
+            const algorithmFPType invNTrees = algorithmFPType(1) / algorithmFPType(nTrees);
+            for(size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+                res[iRow] *= invNTrees;
+        }
+    });
+    return safeStat.detach();
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace regression */
@@ -268,7 +268,7 @@ Status ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
 
     NumericTablePtr pDstFactors = dstPartialModel->getFactors();
     SafeStatus safeStat;
-    daal::threader_for(nRows, nRows, [ & ](size_t i)
+    daal::threader_for_size(nRows, nRows, [ & ](size_t i)
     {
         AlsTls<algorithmFPType, cpu> *alsTlsLocal = alsTls.local();
         DAAL_CHECK_THR(alsTlsLocal, ErrorMemoryAllocationFailed);
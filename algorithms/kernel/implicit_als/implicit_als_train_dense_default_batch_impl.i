@@ -98,7 +98,7 @@ Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(
     algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *xtx, daal::tls<algorithmFPType *>& lhs)
 {
     SafeStatus safeStat;
-    daal::threader_for(nRows, nRows, [ & ](size_t i)
+    daal::threader_for_size(nRows, nRows, [ & ](size_t i)
     {
         algorithmFPType *lhs_local = lhs.local();
         algorithmFPType *rhs = rowFactors + i * nFactors;
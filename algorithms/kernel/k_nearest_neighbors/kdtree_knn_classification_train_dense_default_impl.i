@@ -39,7 +39,7 @@
 #include "kdtree_knn_classification_train_kernel.h"
 #include "kdtree_knn_impl.i"
 
-#if defined(__INTEL_COMPILER_BUILD_DATE)
+#if defined(__DAAL_INTRINSICS_AVX__)
     #include <immintrin.h>
 #endif
 
@@ -592,7 +592,7 @@ size_t KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense
     computeBucketID(algorithmFpType * samples, size_t sampleCount, algorithmFpType * subSamples, size_t subSampleCount,
                     size_t subSampleCount16, algorithmFpType value)
 {
-#if (__CPUID__(DAAL_CPU) >= __avx__) && (__FPTYPE__(DAAL_FPTYPE) == __float__) && defined(__INTEL_COMPILER_BUILD_DATE)
+#if (__CPUID__(DAAL_CPU) >= __avx__) && (__FPTYPE__(DAAL_FPTYPE) == __float__) && defined(__DAAL_INTRINSICS_AVX__)
 
     __m256 vValue = _mm256_set1_ps(value);
     size_t k = 0;
@@ -629,7 +629,7 @@ size_t KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense
 
     return i;
 
-#else // #if (__CPUID__(DAAL_CPU) >= __avx__) && (__FPTYPE__(DAAL_FPTYPE) == __float__) && defined(__INTEL_COMPILER_BUILD_DATE)
+#else // #if (__CPUID__(DAAL_CPU) >= __avx__) && (__FPTYPE__(DAAL_FPTYPE) == __float__) && defined(__DAAL_INTRINSICS_AVX__)
 
     size_t k = 0;
     for (; k < subSampleCount; ++k)
@@ -646,7 +646,7 @@ size_t KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense
     }
     return i;
 
-#endif // #if (__CPUID__(DAAL_CPU) >= __avx__) && (__FPTYPE__(DAAL_FPTYPE) == __float__) && defined(__INTEL_COMPILER_BUILD_DATE)
+#endif // #if (__CPUID__(DAAL_CPU) >= __avx__) && (__FPTYPE__(DAAL_FPTYPE) == __float__) && defined(__DAAL_INTRINSICS_AVX__)
 }
 
 template <CpuType cpu, typename ForwardIterator1, typename ForwardIterator2>
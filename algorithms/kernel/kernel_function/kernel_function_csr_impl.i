@@ -24,7 +24,7 @@
 #ifndef __KERNEL_FUNCTION_CSR_IMPL_I__
 #define __KERNEL_FUNCTION_CSR_IMPL_I__
 
-#if defined (__INTEL_COMPILER)
+#if defined(__DAAL_INTRINSICS_AVX512__)
   #include <immintrin.h>
 #endif
 
@@ -76,7 +76,7 @@ algorithmFPType KernelCSRImplBase<algorithmFPType, cpu>::computeDotProduct(
                                                            startIndexB, endIndexB, valuesB, indicesB);
 }
 
-#if defined (__INTEL_COMPILER)
+#if defined(__DAAL_INTRINSICS_AVX512__)
 
   #undef __DAAL_IA32e
 
@@ -117,7 +117,7 @@ algorithmFPType KernelCSRImplBase<algorithmFPType, cpu>::computeDotProduct(
                 __m512i concatenated = _mm512_inserti64x4(_mm512_castsi256_si512(iA), iB, 1); // put b above a
                 __m512i matches      = _mm512_castsi256_si512(_mm512_extracti64x4_epi64(_mm512_conflict_epi32(concatenated), 1)); // take top half of result
                 __m512i perm_idx     = _mm512_sub_epi32(all_31, _mm512_lzcnt_epi32(matches));
-                __m512i perm_idx64   = _mm512_mask_permutevar_epi32(_mm512_setzero_epi32(), 0x5555, upcon, perm_idx);
+                __m512i perm_idx64   = _mm512_mask_permutexvar_epi32(_mm512_setzero_epi32(), 0x5555, upcon, perm_idx);
                 __mmask8 have_match  = (__mmask8)_mm512_test_epi32_mask(matches, all_f);
                 __m512d matched_vals = _mm512_maskz_permutexvar_pd(have_match, perm_idx64, valA);
                 vSum                 = _mm512_fmadd_pd(matched_vals, valB, vSum);
@@ -211,7 +211,7 @@ algorithmFPType KernelCSRImplBase<algorithmFPType, cpu>::computeDotProduct(
                 __m512i concatenated = _mm512_inserti64x4(_mm512_castsi256_si512(iA), iB, 1); // put b above a
                 __m512i matches      = _mm512_castsi256_si512(_mm512_extracti64x4_epi64(_mm512_conflict_epi32(concatenated), 1)); // take top half of result
                 __m512i perm_idx     = _mm512_sub_epi32(all_31, _mm512_lzcnt_epi32(matches));
-                __m512i perm_idx64   = _mm512_mask_permutevar_epi32(_mm512_setzero_epi32(), 0x5555, upcon, perm_idx);
+                __m512i perm_idx64   = _mm512_mask_permutexvar_epi32(_mm512_setzero_epi32(), 0x5555, upcon, perm_idx);
                 __mmask8 have_match  = (__mmask8)_mm512_test_epi32_mask(matches, all_f);
                 __m512d matched_vals = _mm512_maskz_permutexvar_pd(have_match, perm_idx64, valA);
                 vSum                 = _mm512_fmadd_pd(matched_vals, valB, vSum);
@@ -320,7 +320,7 @@ algorithmFPType KernelCSRImplBase<algorithmFPType, cpu>::computeDotProduct(
                 __m512i concatenated = _mm512_inserti64x4(_mm512_castsi256_si512(iA), iB, 1); // put b above a
                 __m512i matches      = _mm512_castsi256_si512(_mm512_extracti64x4_epi64(_mm512_conflict_epi32(concatenated), 1)); // take top half of result
                 __m512i perm_idx     = _mm512_sub_epi32(all_31, _mm512_lzcnt_epi32(matches));
-                __m512i perm_idx64   = _mm512_mask_permutevar_epi32(_mm512_setzero_epi32(), 0x5555, upcon, perm_idx);
+                __m512i perm_idx64   = _mm512_mask_permutexvar_epi32(_mm512_setzero_epi32(), 0x5555, upcon, perm_idx);
                 __mmask8 have_match  = (__mmask8)_mm512_test_epi32_mask(matches, all_f);
                 __m512d matched_vals = _mm512_maskz_permutexvar_pd(have_match, perm_idx64, valA);
                 vSum                 = _mm512_fmadd_pd(matched_vals, valB, vSum);
@@ -430,7 +430,7 @@ algorithmFPType KernelCSRImplBase<algorithmFPType, cpu>::computeDotProduct(
                 __m512i concatenated = _mm512_inserti64x4(_mm512_castsi256_si512(iA), iB, 1); // put b above a
                 __m512i matches      = _mm512_castsi256_si512(_mm512_extracti64x4_epi64(_mm512_conflict_epi32(concatenated), 1)); // take top half of result
                 __m512i perm_idx     = _mm512_sub_epi32(all_31, _mm512_lzcnt_epi32(matches));
-                __m512i perm_idx64   = _mm512_mask_permutevar_epi32(_mm512_setzero_epi32(), 0x5555, upcon, perm_idx);
+                __m512i perm_idx64   = _mm512_mask_permutexvar_epi32(_mm512_setzero_epi32(), 0x5555, upcon, perm_idx);
                 __mmask8 have_match  = (__mmask8)_mm512_test_epi32_mask(matches, all_f);
                 __m512d matched_vals = _mm512_maskz_permutexvar_pd(have_match, perm_idx64, valA);
                 vSum                 = _mm512_fmadd_pd(matched_vals, valB, vSum);
@@ -510,7 +510,7 @@ algorithmFPType KernelCSRImplBase<algorithmFPType, cpu>::computeDotProduct(
   #endif    // __CPUID__(DAAL_CPU) == __avx512__
 
   #endif    // __DAAL_IA32e
-#endif      // __INTEL_COMPILER
+#endif      // __DAAL_INTRINSICS_AVX512__
 }
 }
 }
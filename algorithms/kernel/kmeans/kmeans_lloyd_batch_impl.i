@@ -103,7 +103,7 @@ services::Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const
         DAAL_CHECK_STATUS(s, s1);
         DAAL_ASSERT(task);
 
-        s = addNTToTaskThreaded<method, algorithmFPType, cpu, 0>(task, ntData, catCoef.get());
+        s = addNTToTaskThreaded<method, algorithmFPType, cpu, 0>(task, ntData, catCoef.get(), nullptr, par->mixedPrecisionAssignment);
         if(!s)
         {
             kmeansClearClusters<algorithmFPType, cpu>(task, &oldTargetFunc);
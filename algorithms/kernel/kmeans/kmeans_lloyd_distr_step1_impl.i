@@ -106,11 +106,12 @@ services::Status KMeansDistributedStep1Kernel<method, algorithmFPType, cpu>::com
 
         if( par->assignFlag )
         {
-            s = addNTToTaskThreaded<method, algorithmFPType, cpu, 1>(task, ntData, catCoef.get(), ntAssignments);
+            s = addNTToTaskThreaded<method, algorithmFPType, cpu, 1>(task, ntData, catCoef.get(), ntAssignments,
+                                                                   par->mixedPrecisionAssignment);
         }
         else
         {
-            s = addNTToTaskThreaded<method, algorithmFPType, cpu, 0>(task, ntData, catCoef.get());
+            s = addNTToTaskThreaded<method, algorithmFPType, cpu, 0>(task, ntData, catCoef.get(), nullptr, par->mixedPrecisionAssignment);
         }
         if(!s)
         {
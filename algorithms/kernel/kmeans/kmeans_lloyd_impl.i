@@ -26,13 +26,15 @@
 #include "service_numeric_table.h"
 #include "service_defines.h"
 #include "service_error_handling.h"
+#include "service_math.h"
+#include "service_tuning.h"
 
 #include "threading.h"
 #include "service_blas.h"
 #include "service_spblas.h"
 
-// CPU intrinsics for Intel Compiler only
-#if defined (__INTEL_COMPILER) && defined(__linux__) && defined(__x86_64__)
+// CPU intrinsics for the compilers that support them for the instruction set of DAAL_CPU
+#if defined(__DAAL_INTRINSICS_AVX512__) && defined(__linux__) && defined(__x86_64__)
     #include <immintrin.h>
 #endif
 
@@ -83,7 +85,7 @@ services::Status kmeansInitTask(int dim, int clNum, algorithmFPType *centroids,
     t->dim       = dim;
     t->clNum     = clNum;
     t->cCenters  = centroids;
-    t->max_block_size = 512;
+    t->max_block_size = (int)getTuningParameter<cpu>(Environment::kmeansBlockSize);
 
     /* Allocate memory for all arrays inside TLS */
     t->tls_task = new daal::tls<tls_task_t<algorithmFPType, cpu>*>([=]()-> tls_task_t<algorithmFPType, cpu> *
@@ -270,6 +272,206 @@ services::Status addNTToTaskThreadedDense(void *task_id, const NumericTable *ntD
     return safeStat.detach();
 }
 
+/* Thread-local buffers for the computation of distances in single precision */
+template<CpuType cpu>
+struct LowPrecisionTls
+{
+    LowPrecisionTls(size_t blockSize, size_t dim, size_t nClusters) : data(blockSize * dim), distances(blockSize * nClusters) {}
+
+    bool isValid() const { return data.get() && distances.get(); }
+
+    TArray<float, cpu> data;
+    TArray<float, cpu> distances;
+};
+
+/*
+ *  Assigns observations to clusters using distances computed by single precision GEMM.
+ *  Candidates whose single precision distance is within the rounding error bound of the minimal one
+ *  are re-checked in algorithmFPType, so the nearest centroid is the same as in the algorithmFPType computation
+ *  except when several centroids are equally distant in algorithmFPType.
+ *  Partial sums and the goal function are accumulated in algorithmFPType.
+ */
+template<typename algorithmFPType, CpuType cpu, int assignFlag>
+services::Status addNTToTaskThreadedDenseMixed(void *task_id, const NumericTable *ntData, NumericTable *ntAssign = 0)
+{
+    struct task_t<algorithmFPType, cpu> *t  = static_cast<task_t<algorithmFPType, cpu> *>(task_id);
+
+    const size_t n = ntData->getNumberOfRows();
+    const size_t p = t->dim;
+    const size_t nClusters = t->clNum;
+    const algorithmFPType *inClusters = t->cCenters;
+    const algorithmFPType *clustersSq = t->clSq;
+
+    const size_t blockSizeDeafult = t->max_block_size;
+
+    size_t nBlocks = n / blockSizeDeafult;
+    nBlocks += (nBlocks*blockSizeDeafult != n);
+
+    TArray<float, cpu> lowClusters(nClusters * p);
+    TArray<float, cpu> lowClustersSq(nClusters);
+    DAAL_CHECK(lowClusters.get() && lowClustersSq.get(), services::ErrorMemoryAllocationFailed);
+
+    algorithmFPType maxClusterSq = (algorithmFPType)0;
+    for (size_t j = 0; j < nClusters; j++)
+    {
+        for (size_t i = 0; i < p; i++)
+        {
+            lowClusters[j * p + i] = (float)inClusters[j * p + i];
+        }
+        lowClustersSq[j] = (float)clustersSq[j];
+        if (clustersSq[j] > maxClusterSq) { maxClusterSq = clustersSq[j]; }
+    }
+    const algorithmFPType maxClusterNorm = daal::internal::Math<algorithmFPType, cpu>::sSqrt(maxClusterSq * 2.0);
+
+    /* Bound of the relative error of the single precision dot product, including the conversion of operands */
+    const algorithmFPType errorFactor = (algorithmFPType)(p + 2) * FLT_EPSILON;
+
+    daal::tls<LowPrecisionTls<cpu> *> lowTls([=]()-> LowPrecisionTls<cpu> *
+    {
+        LowPrecisionTls<cpu> *lt = new LowPrecisionTls<cpu>(blockSizeDeafult, p, nClusters);
+        if (lt && !lt->isValid())
+        {
+            delete lt;
+            lt = nullptr;
+        }
+        return lt;
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](int k)
+    {
+        struct tls_task_t<algorithmFPType, cpu> *tt = t->tls_task->local();
+        LowPrecisionTls<cpu> *lt = lowTls.local();
+        DAAL_CHECK_THR(tt && lt, services::ErrorMemoryAllocationFailed);
+
+        size_t blockSize = blockSizeDeafult;
+        if( k == nBlocks-1 )
+        {
+            blockSize = n - k*blockSizeDeafult;
+        }
+
+        ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), k*blockSizeDeafult, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+        const algorithmFPType *data = mtData.get();
+
+        WriteOnlyRows<int, cpu> assignBlock(assignFlag ? ntAssign : nullptr, k*blockSizeDeafult, blockSize);
+        int* assignments = nullptr;
+        if(assignFlag)
+        {
+            DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
+            assignments = assignBlock.get();
+        }
+
+        int    *cS0        = tt->cS0;
+        algorithmFPType *cS1        = tt->cS1;
+        float *lowData = lt->data.get();
+        float *x_clusters = lt->distances.get();
+
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < blockSize * p; i++)
+        {
+            lowData[i] = (float)data[i];
+        }
+
+        for (size_t j = 0; j < nClusters; j++)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < blockSize; i++)
+            {
+                x_clusters[i + j*blockSize] = lowClustersSq[j];
+            }
+        }
+
+        char transa = 't';
+        char transb = 'n';
+        DAAL_INT _m = blockSize;
+        DAAL_INT _n = nClusters;
+        DAAL_INT _k = p;
+        float alpha = -1.0f;
+        DAAL_INT lda = p;
+        DAAL_INT ldy = p;
+        float beta = 1.0f;
+        DAAL_INT ldaty = blockSize;
+
+        Blas<float, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, lowData,
+                                 &lda, lowClusters.get(), &ldy, &beta, x_clusters, &ldaty);
+
+        algorithmFPType goal = (algorithmFPType)0;
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const algorithmFPType *row = data + i * p;
+
+            float lowMinGoalVal = x_clusters[i];
+            for (size_t j = 1; j < nClusters; j++)
+            {
+                if (lowMinGoalVal > x_clusters[i + j*blockSize]) { lowMinGoalVal = x_clusters[i + j*blockSize]; }
+            }
+
+            algorithmFPType rowSq = (algorithmFPType)0;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                rowSq += row[j] * row[j];
+            }
+
+            /* Difference of two single precision distances may be wrong by at most the doubled error bound */
+            const algorithmFPType rowNorm = daal::internal::Math<algorithmFPType, cpu>::sSqrt(rowSq);
+            const algorithmFPType threshold = (algorithmFPType)lowMinGoalVal +
+                                              2.0 * errorFactor * (rowNorm * maxClusterNorm + maxClusterSq);
+
+            size_t minIdx = 0;
+            algorithmFPType minGoalVal = (algorithmFPType)0;
+            bool found = false;
+            for (size_t j = 0; j < nClusters; j++)
+            {
+                if ((algorithmFPType)x_clusters[i + j*blockSize] > threshold) { continue; }
+
+                const algorithmFPType *centroid = inClusters + j * p;
+                algorithmFPType dot = (algorithmFPType)0;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t l = 0; l < p; l++)
+                {
+                    dot += row[l] * centroid[l];
+                }
+                const algorithmFPType goalVal = clustersSq[j] - dot;
+                if (!found || minGoalVal > goalVal)
+                {
+                    minGoalVal = goalVal;
+                    minIdx = j;
+                    found = true;
+                }
+            }
+
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                cS1[minIdx * p + j] += row[j];
+            }
+            cS0[minIdx]++;
+
+            goal += minGoalVal * 2.0 + rowSq;
+
+            if(assignFlag)
+            {
+                assignments[i] = (int)minIdx;
+            }
+        }
+
+        tt->goalFunc += goal;
+    } );
+
+    lowTls.reduce([](LowPrecisionTls<cpu> *lt)-> void
+    {
+        delete lt;
+    });
+    return safeStat.detach();
+}
+
 template<typename algorithmFPType, CpuType cpu, int assignFlag>
 services::Status addNTToTaskThreadedCSR(void *task_id, const NumericTable *ntDataGen, algorithmFPType *catCoef, NumericTable *ntAssign = 0)
 {
@@ -371,10 +573,16 @@ services::Status addNTToTaskThreadedCSR(void *task_id, const NumericTable *ntDat
 }
 
 template<Method method, typename algorithmFPType, CpuType cpu, int assignFlag>
-services::Status addNTToTaskThreaded(void *task_id, const NumericTable *ntData, algorithmFPType *catCoef, NumericTable *ntAssign = 0 )
+services::Status addNTToTaskThreaded(void *task_id, const NumericTable *ntData, algorithmFPType *catCoef, NumericTable *ntAssign = 0,
+                                     bool mixedPrecision = false)
 {
     if(method == lloydDense)
     {
+        /* Single precision distances pay off only when the computations are in double precision */
+        if(mixedPrecision && sizeof(algorithmFPType) > sizeof(float))
+        {
+            return addNTToTaskThreadedDenseMixed<algorithmFPType, cpu, assignFlag>( task_id, ntData, ntAssign );
+        }
         return addNTToTaskThreadedDense<algorithmFPType, cpu, assignFlag>( task_id, ntData, catCoef, ntAssign );
     }
     else if(method == lloydCSR)
@@ -522,7 +730,7 @@ void kmeansClearClusters(void *task_id, algorithmFPType *goalFunc)
 }
 
 // Intel(R) Xeon Phi(TM) optimization via template specialization (Intel compiler only)
-#if defined (__INTEL_COMPILER) && defined(__linux__) && defined(__x86_64__) && ( __CPUID__(DAAL_CPU) == __avx512_mic__ )
+#if defined(__DAAL_INTRINSICS_AVX512__) && defined(__linux__) && defined(__x86_64__) && ( __CPUID__(DAAL_CPU) == __avx512_mic__ )
     #include "kmeans_lloyd_impl_avx512_mic.i"
 #endif
 
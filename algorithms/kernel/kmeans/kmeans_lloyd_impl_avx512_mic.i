@@ -32,7 +32,7 @@ template<> services::Status kmeansInitTask<DAAL_FPTYPE, avx512_mic>(int dim, int
     t->dim       = dim;
     t->clNum     = clNum;
     t->cCenters  = centroids;
-    t->max_block_size = 448;
+    t->max_block_size = (int)getTuningParameter<avx512_mic>(Environment::kmeansBlockSize);
 
     /* Allocate memory for all arrays inside TLS */
     t->tls_task = new daal::tls<tls_task_t<DAAL_FPTYPE, avx512_mic>*>( [=]()-> tls_task_t<DAAL_FPTYPE, avx512_mic>*
@@ -175,7 +175,7 @@ template<> services::Status addNTToTaskThreadedDense<DAAL_FPTYPE, avx512_mic, 0>
                   mMin       = _mm512_min_ps (mMin, mCurMin);
                   maskMin    = _mm512_cmp_ps_mask(mMin, mSub, _CMP_EQ_UQ);
                   iCurIdx    = ((unsigned int)maskMin) | 0xffff0000;
-                  iCurIdx    = _mm_tzcnt_32(iCurIdx);
+                  iCurIdx    = _tzcnt_u32(iCurIdx);
                   minIdx     = (iCurIdx<16)?(j+iCurIdx):minIdx;
             }
 #elif( __FPTYPE__(DAAL_FPTYPE) == __double__ )
@@ -200,7 +200,7 @@ template<> services::Status addNTToTaskThreadedDense<DAAL_FPTYPE, avx512_mic, 0>
                   mMin       = _mm512_min_pd (mMin, mCurMin);
                   maskMin    = _mm512_cmp_pd_mask(mMin, mSub, _CMP_EQ_UQ);
                   iCurIdx    = ((unsigned int)maskMin) | 0xffffff00;
-                  iCurIdx    = _mm_tzcnt_32(iCurIdx);
+                  iCurIdx    = _tzcnt_u32(iCurIdx);
                   minIdx     = (iCurIdx<8)?(j+iCurIdx):minIdx;
             }
 #else
@@ -317,7 +317,7 @@ template<> services::Status getNTAssignmentsThreaded <lloydDense, DAAL_FPTYPE, a
                   mMin       = _mm512_min_ps (mMin, mCurMin);
                   maskMin    = _mm512_cmp_ps_mask(mMin, mSub, _CMP_EQ_UQ);
                   iCurIdx    = ((unsigned int)maskMin) | 0xffff0000;
-                  iCurIdx    = _mm_tzcnt_32(iCurIdx);
+                  iCurIdx    = _tzcnt_u32(iCurIdx);
                   minIdx     = (iCurIdx<16)?(j+iCurIdx):minIdx;
             }
 #elif( __FPTYPE__(DAAL_FPTYPE) == __double__ )
@@ -342,7 +342,7 @@ template<> services::Status getNTAssignmentsThreaded <lloydDense, DAAL_FPTYPE, a
                   mMin       = _mm512_min_pd (mMin, mCurMin);
                   maskMin    = _mm512_cmp_pd_mask(mMin, mSub, _CMP_EQ_UQ);
                   iCurIdx    = ((unsigned int)maskMin) | 0xffffff00;
-                  iCurIdx    = _mm_tzcnt_32(iCurIdx);
+                  iCurIdx    = _tzcnt_u32(iCurIdx);
                   minIdx     = (iCurIdx<8)?(j+iCurIdx):minIdx;
             }
 #else
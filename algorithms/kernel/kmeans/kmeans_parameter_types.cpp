@@ -45,7 +45,7 @@ namespace interface1
  */
 Parameter::Parameter(size_t _nClusters, size_t _maxIterations) :
     nClusters(_nClusters), maxIterations(_maxIterations), accuracyThreshold(0.0), gamma(1.0),
-    distanceType(euclidean), assignFlag(true) {}
+    distanceType(euclidean), assignFlag(true), mixedPrecisionAssignment(false) {}
 
 /**
  *  Constructs parameters of the K-Means algorithm by copying another parameters of the K-Means algorithm
@@ -54,7 +54,8 @@ Parameter::Parameter(size_t _nClusters, size_t _maxIterations) :
 Parameter::Parameter(const Parameter &other) :
     nClusters(other.nClusters), maxIterations(other.maxIterations),
     accuracyThreshold(other.accuracyThreshold), gamma(other.gamma),
-    distanceType(other.distanceType), assignFlag(other.assignFlag)
+    distanceType(other.distanceType), assignFlag(other.assignFlag),
+    mixedPrecisionAssignment(other.mixedPrecisionAssignment)
 {}
 
 services::Status Parameter::check() const
@@ -0,0 +1,366 @@
+/* file: kmeans_sweep_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the Lloyd method of the K-Means algorithm
+//  for several numbers of clusters that share the passes over the data.
+//--
+*/
+
+#include "algorithm.h"
+#include "numeric_table.h"
+#include "threading.h"
+#include "daal_defines.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "service_blas.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace sweep
+{
+namespace internal
+{
+
+/* Maximal number of rows in the block of observations */
+const size_t sweepMaxBlockSize = 512;
+
+/* Minimal number of rows in the block of observations */
+const size_t sweepMinBlockSize = 32;
+
+/* Maximal number of elements in the buffer of distances of the block of observations to all centroids */
+const size_t sweepMaxDistanceBufferSize = sweepMaxBlockSize * sweepMaxBlockSize;
+
+/* Thread-local buffers and partial sums of the clusters of all the numbers of clusters */
+template<typename algorithmFPType, CpuType cpu>
+struct SweepTls
+{
+    SweepTls(size_t blockSize, size_t nTotalClusters, size_t nFeatures, size_t nCandidates) :
+        distances(blockSize * nTotalClusters), minDistances(blockSize), minIndices(blockSize), dataSq(blockSize),
+        cS1(nTotalClusters * nFeatures), cS0(nTotalClusters), goal(nCandidates)
+    {
+        /* Partial sums are accumulated from the first iteration on */
+        if (cS1.get()) { daal::services::internal::service_memset<algorithmFPType, cpu>(cS1.get(), (algorithmFPType)0.0, nTotalClusters * nFeatures); }
+        if (cS0.get()) { daal::services::internal::service_memset<size_t, cpu>(cS0.get(), 0, nTotalClusters); }
+        if (goal.get()) { daal::services::internal::service_memset<algorithmFPType, cpu>(goal.get(), (algorithmFPType)0.0, nCandidates); }
+    }
+
+    bool isValid() const
+    {
+        return distances.get() && minDistances.get() && minIndices.get() && dataSq.get() &&
+               cS1.get() && cS0.get() && goal.get();
+    }
+
+    TArray<algorithmFPType, cpu> distances;
+    TArray<algorithmFPType, cpu> minDistances;
+    TArray<size_t, cpu> minIndices;
+    TArray<algorithmFPType, cpu> dataSq;
+    TArray<algorithmFPType, cpu> cS1;
+    TArray<size_t, cpu> cS0;
+    TArray<algorithmFPType, cpu> goal;
+};
+
+#define __DAAL_FABS(a) (((a)>(algorithmFPType)0.0)?(a):(-(a)))
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status KMeansSweepBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTable *ntData,
+    const DataCollection *inputCentroids, const DataCollection *centroids, NumericTable *ntObjective, NumericTable *ntIterations,
+    const Parameter *par)
+{
+    const size_t n = ntData->getNumberOfRows();
+    const size_t p = ntData->getNumberOfColumns();
+    const size_t nCandidates = inputCentroids->size();
+    const size_t nIter = par->maxIterations;
+    const algorithmFPType accuracyThreshold = (algorithmFPType)par->accuracyThreshold;
+
+    /* Centroids of all the numbers of clusters are stored one after another */
+    TArray<size_t, cpu> offsets(nCandidates + 1);
+    DAAL_CHECK(offsets.get(), services::ErrorMemoryAllocationFailed);
+    offsets[0] = 0;
+    for (size_t c = 0; c < nCandidates; c++)
+    {
+        offsets[c + 1] = offsets[c] + NumericTable::cast((*inputCentroids)[c])->getNumberOfRows();
+    }
+    const size_t nTotalClusters = offsets[nCandidates];
+
+    TArray<algorithmFPType, cpu> clusters(nTotalClusters * p);
+    TArray<algorithmFPType, cpu> activeClusters(nTotalClusters * p);
+    TArray<algorithmFPType, cpu> activeClustersSq(nTotalClusters);
+    TArray<size_t, cpu> activeCandidates(nCandidates);
+    TArray<size_t, cpu> activeOffsets(nCandidates + 1);
+    TArray<algorithmFPType, cpu> clusterS1(nTotalClusters * p);
+    TArray<size_t, cpu> clusterS0(nTotalClusters);
+    TArray<algorithmFPType, cpu> goal(nCandidates);
+    TArray<algorithmFPType, cpu> objective(nCandidates);
+    TArray<int, cpu> iterations(nCandidates);
+    TArray<bool, cpu> converged(nCandidates);
+    DAAL_CHECK(clusters.get() && activeClusters.get() && activeClustersSq.get() && activeCandidates.get() && activeOffsets.get() &&
+               clusterS1.get() && clusterS0.get() && goal.get() && objective.get() && iterations.get() && converged.get(),
+               services::ErrorMemoryAllocationFailed);
+
+    for (size_t c = 0; c < nCandidates; c++)
+    {
+        const size_t nClusters = offsets[c + 1] - offsets[c];
+        ReadRows<algorithmFPType, cpu> mtInClusters(NumericTable::cast((*inputCentroids)[c]).get(), 0, nClusters);
+        DAAL_CHECK_BLOCK_STATUS(mtInClusters);
+        const size_t sizeInBytes = nClusters * p * sizeof(algorithmFPType);
+        daal::services::daal_memcpy_s(&clusters[offsets[c] * p], sizeInBytes, mtInClusters.get(), sizeInBytes);
+
+        objective[c] = (algorithmFPType)0.0;
+        iterations[c] = 0;
+        converged[c] = false;
+    }
+
+    /* Block size is reduced for large total numbers of clusters to bound the size of the buffer of distances */
+    size_t blockSize = sweepMaxDistanceBufferSize / (nTotalClusters ? nTotalClusters : 1);
+    blockSize = (blockSize > sweepMaxBlockSize ? sweepMaxBlockSize : (blockSize < sweepMinBlockSize ? sweepMinBlockSize : blockSize));
+    if (blockSize > n) { blockSize = n; }
+    const size_t nBlocks = (blockSize ? n / blockSize + !!(n % blockSize) : 0);
+
+    typedef SweepTls<algorithmFPType, cpu> TlsType;
+    daal::tls<TlsType *> tlsData([=]()-> TlsType *
+    {
+        TlsType *tt = new TlsType(blockSize, nTotalClusters, p, nCandidates);
+        if (tt && !tt->isValid())
+        {
+            delete tt;
+            tt = nullptr;
+        }
+        return tt;
+    });
+
+    services::Status s;
+    for (size_t kIter = 0; kIter < nIter; kIter++)
+    {
+        /* Centroids of the numbers of clusters that did not converge yet are packed into one matrix */
+        size_t nActive = 0;
+        activeOffsets[0] = 0;
+        for (size_t c = 0; c < nCandidates; c++)
+        {
+            if (converged[c]) { continue; }
+            const size_t nClusters = offsets[c + 1] - offsets[c];
+            const size_t sizeInBytes = nClusters * p * sizeof(algorithmFPType);
+            daal::services::daal_memcpy_s(&activeClusters[activeOffsets[nActive] * p], sizeInBytes, &clusters[offsets[c] * p], sizeInBytes);
+            activeCandidates[nActive] = c;
+            activeOffsets[nActive + 1] = activeOffsets[nActive] + nClusters;
+            nActive++;
+        }
+        if (!nActive) { break; }
+        const size_t nActiveClusters = activeOffsets[nActive];
+
+        for (size_t j = 0; j < nActiveClusters; j++)
+        {
+            algorithmFPType sq = (algorithmFPType)0.0;
+            for (size_t i = 0; i < p; i++)
+            {
+                sq += activeClusters[j * p + i] * activeClusters[j * p + i];
+            }
+            activeClustersSq[j] = sq * (algorithmFPType)0.5;
+        }
+
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t k)
+        {
+            TlsType *tt = tlsData.local();
+            DAAL_CHECK_THR(tt, services::ErrorMemoryAllocationFailed);
+
+            const size_t rowOffset = k * blockSize;
+            const size_t nRows = (k == nBlocks - 1 ? n - rowOffset : blockSize);
+
+            ReadRows<algorithmFPType, cpu> mtData(const_cast<NumericTable *>(ntData), rowOffset, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+            const algorithmFPType *x = mtData.get();
+
+            algorithmFPType *distances = tt->distances.get();
+            algorithmFPType *minDistances = tt->minDistances.get();
+            size_t *minIndices = tt->minIndices.get();
+            algorithmFPType *dataSq = tt->dataSq.get();
+            algorithmFPType *cS1 = tt->cS1.get();
+            size_t *cS0 = tt->cS0.get();
+
+            /* One GEMM of the block against the centroids of all the active numbers of clusters:
+               distances[i + j*nRows] = ||c_j||^2 / 2 - <x_i, c_j> */
+            for (size_t j = 0; j < nActiveClusters; j++)
+            {
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    distances[i + j * nRows] = activeClustersSq[j];
+                }
+            }
+
+            char transa = 't';
+            char transb = 'n';
+            DAAL_INT _m = nRows;
+            DAAL_INT _n = nActiveClusters;
+            DAAL_INT _k = p;
+            algorithmFPType alpha = -1.0;
+            DAAL_INT lda = p;
+            DAAL_INT ldy = p;
+            algorithmFPType beta = 1.0;
+            DAAL_INT ldaty = nRows;
+
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, x,
+                                               &lda, activeClusters.get(), &ldy, &beta, distances, &ldaty);
+
+            for (size_t i = 0; i < nRows; i++)
+            {
+                algorithmFPType sq = (algorithmFPType)0.0;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++)
+                {
+                    sq += x[i * p + j] * x[i * p + j];
+                }
+                dataSq[i] = sq;
+            }
+
+            for (size_t a = 0; a < nActive; a++)
+            {
+                const size_t aOffset = activeOffsets[a];
+                const size_t nClusters = activeOffsets[a + 1] - aOffset;
+                const algorithmFPType *aDistances = distances + aOffset * nRows;
+
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    minDistances[i] = aDistances[i];
+                    minIndices[i] = 0;
+                }
+                for (size_t j = 1; j < nClusters; j++)
+                {
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for (size_t i = 0; i < nRows; i++)
+                    {
+                        const algorithmFPType d = aDistances[i + j * nRows];
+                        if (d < minDistances[i])
+                        {
+                            minDistances[i] = d;
+                            minIndices[i] = j;
+                        }
+                    }
+                }
+
+                algorithmFPType aGoal = (algorithmFPType)0.0;
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    const size_t idx = aOffset + minIndices[i];
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        cS1[idx * p + j] += x[i * p + j];
+                    }
+                    cS0[idx]++;
+                    aGoal += minDistances[i] * (algorithmFPType)2.0 + dataSq[i];
+                }
+                tt->goal[a] += aGoal;
+            }
+        });
+
+        /* Partial sums are reduced and thread-local buffers are reset for the next iteration */
+        for (size_t j = 0; j < nActiveClusters * p; j++) { clusterS1[j] = (algorithmFPType)0.0; }
+        for (size_t j = 0; j < nActiveClusters; j++) { clusterS0[j] = 0; }
+        for (size_t a = 0; a < nActive; a++) { goal[a] = (algorithmFPType)0.0; }
+        tlsData.reduce([&](TlsType *tt)-> void
+        {
+            if (!tt) { return; }
+            for (size_t j = 0; j < nActiveClusters * p; j++)
+            {
+                clusterS1[j] += tt->cS1[j];
+                tt->cS1[j] = (algorithmFPType)0.0;
+            }
+            for (size_t j = 0; j < nActiveClusters; j++)
+            {
+                clusterS0[j] += tt->cS0[j];
+                tt->cS0[j] = 0;
+            }
+            for (size_t a = 0; a < nActive; a++)
+            {
+                goal[a] += tt->goal[a];
+                tt->goal[a] = (algorithmFPType)0.0;
+            }
+        });
+        s = safeStat.detach();
+        if (!s) { break; }
+
+        for (size_t a = 0; a < nActive; a++)
+        {
+            const size_t c = activeCandidates[a];
+            for (size_t j = activeOffsets[a]; j < activeOffsets[a + 1]; j++)
+            {
+                /* Centroid of the empty cluster is kept unchanged */
+                if (clusterS0[j] == 0) { continue; }
+                const algorithmFPType coeff = (algorithmFPType)1.0 / clusterS0[j];
+                algorithmFPType *centroid = &clusters[(offsets[c] + j - activeOffsets[a]) * p];
+                for (size_t i = 0; i < p; i++)
+                {
+                    centroid[i] = clusterS1[j * p + i] * coeff;
+                }
+            }
+
+            iterations[c]++;
+            if (accuracyThreshold > (algorithmFPType)0.0 && __DAAL_FABS(objective[c] - goal[a]) < accuracyThreshold)
+            {
+                converged[c] = true;
+            }
+            objective[c] = goal[a];
+        }
+    }
+
+    tlsData.reduce([](TlsType *tt)-> void
+    {
+        delete tt;
+    });
+    if (!s) { return s; }
+
+    for (size_t c = 0; c < nCandidates; c++)
+    {
+        const size_t nClusters = offsets[c + 1] - offsets[c];
+        WriteOnlyRows<algorithmFPType, cpu> mtClusters(NumericTable::cast((*centroids)[c]).get(), 0, nClusters);
+        DAAL_CHECK_BLOCK_STATUS(mtClusters);
+        const size_t sizeInBytes = nClusters * p * sizeof(algorithmFPType);
+        daal::services::daal_memcpy_s(mtClusters.get(), sizeInBytes, &clusters[offsets[c] * p], sizeInBytes);
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> mtObjective(ntObjective, 0, nCandidates);
+    DAAL_CHECK_BLOCK_STATUS(mtObjective);
+    WriteOnlyRows<int, cpu> mtIterations(ntIterations, 0, nCandidates);
+    DAAL_CHECK_BLOCK_STATUS(mtIterations);
+    for (size_t c = 0; c < nCandidates; c++)
+    {
+        mtObjective.get()[c] = objective[c];
+        mtIterations.get()[c] = iterations[c];
+    }
+    return s;
+}
+
+} // namespace daal::algorithms::kmeans::sweep::internal
+} // namespace daal::algorithms::kmeans::sweep
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
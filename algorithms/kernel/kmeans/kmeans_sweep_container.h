@@ -0,0 +1,71 @@
+/* file: kmeans_sweep_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the K-Means sweep container -- a class that contains
+//  the K-Means sweep kernels for supported architectures.
+//--
+*/
+
+#include "kmeans_sweep_types.h"
+#include "kmeans_sweep_batch.h"
+#include "kmeans_sweep_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace sweep
+{
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::KMeansSweepBatchKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input  *input  = static_cast<Input *>(_in );
+    Result *result = static_cast<Result *>(_res);
+
+    NumericTable *ntData = input->get(data).get();
+    DataCollection *inputCentroidsCollection = input->get(inputCentroids).get();
+    DataCollection *centroidsCollection = result->get(centroids).get();
+    NumericTable *ntObjective = result->get(objectiveFunction).get();
+    NumericTable *ntIterations = result->get(nIterations).get();
+
+    Parameter *par = static_cast<Parameter *>(_par);
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::KMeansSweepBatchKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                       ntData, inputCentroidsCollection, centroidsCollection, ntObjective, ntIterations, par);
+}
+
+} // namespace daal::algorithms::kmeans::sweep
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
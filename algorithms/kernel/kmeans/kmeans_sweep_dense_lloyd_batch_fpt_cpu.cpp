@@ -0,0 +1,47 @@
+/* file: kmeans_sweep_dense_lloyd_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the K-Means sweep for dense data.
+//--
+*/
+
+#include "kmeans_sweep_kernel.h"
+#include "kmeans_sweep_batch_impl.i"
+#include "kmeans_sweep_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace sweep
+{
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, lloydDense, DAAL_CPU>;
+}
+namespace internal
+{
+template class KMeansSweepBatchKernel<lloydDense, DAAL_FPTYPE, DAAL_CPU>;
+} // namespace daal::algorithms::kmeans::sweep::internal
+} // namespace daal::algorithms::kmeans::sweep
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
@@ -0,0 +1,59 @@
+/* file: kmeans_sweep_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes the K-Means sweep.
+//--
+*/
+
+#ifndef __KMEANS_SWEEP_KERNEL_H__
+#define __KMEANS_SWEEP_KERNEL_H__
+
+#include "kmeans_sweep_types.h"
+#include "kernel.h"
+#include "numeric_table.h"
+#include "data_collection.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace sweep
+{
+namespace internal
+{
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+class KMeansSweepBatchKernel: public Kernel
+{
+public:
+    services::Status compute(const NumericTable *ntData, const DataCollection *inputCentroids, const DataCollection *centroids,
+                             NumericTable *ntObjective, NumericTable *ntIterations, const Parameter *par);
+};
+
+} // namespace daal::algorithms::kmeans::sweep::internal
+} // namespace daal::algorithms::kmeans::sweep
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,75 @@
+/* file: kmeans_sweep_result.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the K-Means sweep result.
+//--
+*/
+
+#ifndef __KMEANS_SWEEP_RESULT_
+#define __KMEANS_SWEEP_RESULT_
+
+#include "algorithms/kmeans/kmeans_sweep_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace sweep
+{
+
+/**
+ * Allocates memory to store the results of the K-Means sweep
+ * \param[in] input     Pointer to the structure of the input objects
+ * \param[in] parameter Pointer to the structure of the algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Input *algInput = static_cast<const Input *>(input);
+    const size_t nFeatures = algInput->getNumberOfFeatures();
+    const size_t nCandidates = algInput->get(inputCentroids)->size();
+
+    data_management::DataCollectionPtr centroidsCollection(new data_management::DataCollection());
+    DAAL_CHECK_MALLOC(centroidsCollection.get());
+    for (size_t i = 0; i < nCandidates; i++)
+    {
+        const size_t nClusters = algInput->get(inputCentroids, i)->getNumberOfRows();
+        centroidsCollection->push_back(data_management::SerializationIfacePtr(
+                                           new data_management::HomogenNumericTable<algorithmFPType>
+                                           (nFeatures, nClusters, data_management::NumericTable::doAllocate)));
+    }
+    Argument::set(centroids, centroidsCollection);
+    Argument::set(objectiveFunction, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>
+                      (        1, nCandidates, data_management::NumericTable::doAllocate)));
+    Argument::set(nIterations, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<int>
+                      (        1, nCandidates, data_management::NumericTable::doAllocate)));
+    return services::Status();
+}
+
+} // namespace sweep
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,191 @@
+/* file: kmeans_sweep_types.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the K-Means sweep classes.
+//--
+*/
+
+#include "algorithms/kmeans/kmeans_sweep_types.h"
+#include "daal_defines.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace sweep
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_KMEANS_SWEEP_RESULT_ID);
+
+/**
+ *  Constructs parameters of the K-Means sweep
+ *  \param[in] _maxIterations Maximal number of iterations for each number of clusters
+ */
+Parameter::Parameter(size_t _maxIterations) : maxIterations(_maxIterations), accuracyThreshold(0.0) {}
+
+/**
+ *  Constructs parameters of the K-Means sweep by copying another parameters of the K-Means sweep
+ *  \param[in] other    Parameters of the K-Means sweep
+ */
+Parameter::Parameter(const Parameter &other) :
+    maxIterations(other.maxIterations), accuracyThreshold(other.accuracyThreshold) {}
+
+services::Status Parameter::check() const
+{
+    DAAL_CHECK_EX(accuracyThreshold >= 0, ErrorIncorrectParameter, ParameterName, accuracyThresholdStr());
+    return services::Status();
+}
+
+Input::Input() : daal::algorithms::Input(lastInputCollectionId + 1)
+{
+    Argument::set(inputCentroids, DataCollectionPtr(new DataCollection()));
+}
+
+NumericTablePtr Input::get(InputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+DataCollectionPtr Input::get(InputCollectionId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+NumericTablePtr Input::get(InputCollectionId id, size_t idx) const
+{
+    DataCollectionPtr collection = get(id);
+    if (!collection || idx >= collection->size()) { return NumericTablePtr(); }
+    return NumericTable::cast((*collection)[idx]);
+}
+
+void Input::set(InputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+void Input::set(InputCollectionId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+void Input::add(InputCollectionId id, const NumericTablePtr &ptr)
+{
+    DataCollectionPtr collection = get(id);
+    if (!collection) { return; }
+    collection->push_back(ptr);
+}
+
+size_t Input::getNumberOfFeatures() const
+{
+    NumericTablePtr inTable = get(data);
+    return inTable->getNumberOfColumns();
+}
+
+/**
+* Checks input objects for the K-Means sweep
+* \param[in] par     Algorithm parameter
+* \param[in] method  Computation method of the algorithm
+*/
+services::Status Input::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr()));
+    const size_t inputFeatures = get(data)->getNumberOfColumns();
+
+    DataCollectionPtr centroidsCollection = get(inputCentroids);
+    DAAL_CHECK(centroidsCollection, ErrorNullInputDataCollection);
+    const size_t nCandidates = centroidsCollection->size();
+    DAAL_CHECK(nCandidates > 0, ErrorIncorrectNumberOfElementsInInputCollection);
+    for (size_t i = 0; i < nCandidates; i++)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(inputCentroids, i).get(), inputCentroidsStr(), 0, 0, inputFeatures));
+    }
+    return s;
+}
+
+Result::Result() : daal::algorithms::Result(lastResultCollectionId + 1) {}
+
+NumericTablePtr Result::get(ResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+DataCollectionPtr Result::get(ResultCollectionId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+NumericTablePtr Result::get(ResultCollectionId id, size_t idx) const
+{
+    DataCollectionPtr collection = get(id);
+    if (!collection || idx >= collection->size()) { return NumericTablePtr(); }
+    return NumericTable::cast((*collection)[idx]);
+}
+
+void Result::set(ResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+void Result::set(ResultCollectionId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+* Checks the result of the K-Means sweep
+* \param[in] input   %Input objects for the algorithm
+* \param[in] par     Algorithm parameter
+* \param[in] method  Computation method
+*/
+services::Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    const Input *algInput = static_cast<const Input *>(input);
+    const size_t inputFeatures = algInput->getNumberOfFeatures();
+    const size_t nCandidates = algInput->get(inputCentroids)->size();
+
+    const int unexpectedLayouts = (int)packed_mask;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(objectiveFunction).get(), goalFunctionStr(), unexpectedLayouts, 0, 1, nCandidates));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(nIterations).get(), nIterationsStr(), unexpectedLayouts, 0, 1, nCandidates));
+
+    DataCollectionPtr centroidsCollection = get(centroids);
+    DAAL_CHECK(centroidsCollection, ErrorNullOutputDataCollection);
+    DAAL_CHECK(centroidsCollection->size() == nCandidates, ErrorIncorrectNumberOfElementsInResultCollection);
+    for (size_t i = 0; i < nCandidates; i++)
+    {
+        const size_t nClusters = algInput->get(inputCentroids, i)->getNumberOfRows();
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(centroids, i).get(), centroidsStr(), unexpectedLayouts, 0, inputFeatures, nClusters));
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace sweep
+} // namespace kmeans
+} // namespace algorithm
+} // namespace daal
@@ -45,6 +45,7 @@ Status ModelNormEqInternal::initialize()
     DAAL_CHECK_STATUS(s, super::initialize());
     DAAL_CHECK_STATUS(s, this->setToZero(*_xtxTable));
     DAAL_CHECK_STATUS(s, this->setToZero(*_xtyTable));
+    _choleskyFactorTable.reset();
     return s;
 }
 
@@ -60,6 +61,18 @@ NumericTablePtr ModelNormEqInternal::getXTXTable() { return _xtxTable; }
      */
 NumericTablePtr ModelNormEqInternal::getXTYTable() { return _xtyTable; }
 
+/**
+ * Returns a Numeric table that contains the lower triangle Cholesky factor of X'*X
+ * \return Numeric table that contains the Cholesky factor of X'*X, or empty pointer if the factor is not available
+ */
+NumericTablePtr ModelNormEqInternal::getCholeskyFactorTable() { return _choleskyFactorTable; }
+
+/**
+ * Sets a Numeric table that contains the lower triangle Cholesky factor of X'*X
+ * \param[in] table  Numeric table that contains the Cholesky factor of X'*X, or empty pointer
+ */
+void ModelNormEqInternal::setCholeskyFactorTable(const NumericTablePtr &table) { _choleskyFactorTable = table; }
+
 } // namespace internal
 } // namespace linear_regression
 } // namespace algorithms
@@ -77,9 +77,24 @@ public:
      */
     NumericTablePtr getXTYTable();
 
+    /**
+     * Returns a Numeric table that contains the lower triangle Cholesky factor of X'*X
+     * maintained in the online processing mode
+     * \return Numeric table that contains the Cholesky factor of X'*X, or empty pointer if the factor is not available
+     */
+    NumericTablePtr getCholeskyFactorTable();
+
+    /**
+     * Sets a Numeric table that contains the lower triangle Cholesky factor of X'*X
+     * \param[in] table  Numeric table that contains the Cholesky factor of X'*X, or empty pointer
+     */
+    void setCholeskyFactorTable(const NumericTablePtr &table);
+
 protected:
     NumericTablePtr _xtxTable;        /* Table holding a partial sum of X'*X */
     NumericTablePtr _xtyTable;        /* Table holding a partial sum of X'*Y */
+    NumericTablePtr _choleskyFactorTable; /* Table holding the Cholesky factor of X'*X. It is not serialized,
+                                             the factor is recomputed from X'*X when it is not available */
 
     template<typename Archive, bool onDeserialize>
     void serialImpl(Archive *arch)
@@ -69,6 +69,9 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Input *input = static_cast<Input *>(_in);
     Result *result = static_cast<Result *>(_res);
 
+    /* Observations can be removed from the partial model in the online processing mode only */
+    DAAL_CHECK(!input->get(removedData) && !input->get(removedDependentVariables), services::ErrorIncorrectOptionalInput);
+
     NumericTable *x = input->get(data).get();
     NumericTable *y = input->get(dependentVariables).get();
 
@@ -114,6 +117,8 @@ services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
 
     NumericTable *x = input->get(data).get();
     NumericTable *y = input->get(dependentVariables).get();
+    NumericTable *removedX = input->get(removedData).get();
+    NumericTable *removedY = input->get(removedDependentVariables).get();
 
     linear_regression::Model *partialModel = partialResult->get(training::partialModel).get();
 
@@ -121,7 +126,7 @@ services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::LinearRegressionTrainOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),   \
-                       compute, x, y, partialModel, par);
+                       compute, x, y, removedX, removedY, partialModel, par);
 }
 
 /**
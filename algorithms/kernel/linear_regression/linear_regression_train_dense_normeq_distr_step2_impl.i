@@ -84,14 +84,14 @@ template <typename algorithmFPType, CpuType cpu>
 void LinearRegressionTrainDistributedKernel<algorithmFPType, training::normEqDense, cpu>::mergePartialSums(
     DAAL_INT nBetas, DAAL_INT nResponses, algorithmFPType *axtx, algorithmFPType *axty, algorithmFPType *rxtx, algorithmFPType *rxty)
 {
-    size_t xtxSize = nBetas * nBetas;
-    daal::threader_for( xtxSize, xtxSize, [ = ](size_t i)
+    size_t xtxSize = (size_t)nBetas * nBetas;
+    daal::threader_for_size(xtxSize, xtxSize, [ = ](size_t i)
     {
         rxtx[i] += axtx[i];
     } );
 
-    size_t xtySize = nResponses * nBetas;
-    daal::threader_for( xtySize, xtySize, [ = ](size_t i)
+    size_t xtySize = (size_t)nResponses * nBetas;
+    daal::threader_for_size(xtySize, xtySize, [ = ](size_t i)
     {
         rxty[i] += axty[i];
     } );
@@ -29,7 +29,10 @@
 #include "service_blas.h"
 #include "service_lapack.h"
 #include "linear_regression_ne_model.h"
+#include "linear_regression_ne_model_impl.h"
 #include "linear_regression_train_kernel.h"
+#include "cholesky_rank_update.h"
+#include "service_numeric_table.h"
 #include "threading.h"
 #include "daal_defines.h"
 #include "service_memory.h"
@@ -106,7 +109,8 @@ static void updatePartialSums(
                        algorithmFPType  *xtx_out,    /* p*b output matrix */
                        DAAL_INT *v,          /* variables */
                        algorithmFPType  *y_in,       /* v*n input matrix   */
-                       algorithmFPType  *xty_out     /* v*b output matrix */
+                       algorithmFPType  *xty_out,    /* v*b output matrix */
+                       algorithmFPType  alpha        /* 1 to add the observations, -1 to remove them */
                       )
 {
 size_t i, j;
@@ -121,12 +125,12 @@ char trans  = 'N';
 char transa = 'N';
 char transb = 'T';
 
-algorithmFPType alpha = 1.0;
+algorithmFPType one = 1.0;
 algorithmFPType *xtx_ptr;
 algorithmFPType *x_ptr;
 algorithmFPType *y_ptr;
 
-    Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, p, n, &alpha, x_in, p, &alpha, xtx_out, b);
+    Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, p, n, &alpha, x_in, p, &one, xtx_out, b);
 
     if ( p_val < b_val )
     {
@@ -138,15 +142,15 @@ algorithmFPType *y_ptr;
         {
             for ( j = 0; j < p_val; j++)
             {
-                xtx_ptr[j] += x_ptr[j];
+                xtx_ptr[j] += alpha * x_ptr[j];
             }
         }
 
-        xtx_ptr[p_val] += (algorithmFPType)n_val;
+        xtx_ptr[p_val] += alpha * (algorithmFPType)n_val;
 
     } /* if ( p_val < b_val ) */
 
-    Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, p, v, n, &alpha, x_in, p, y_in, v, &alpha, xty_out, b);
+    Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, p, v, n, &alpha, x_in, p, y_in, v, &one, xty_out, b);
 
     if ( p_val < b_val )
     {
@@ -156,7 +160,7 @@ algorithmFPType *y_ptr;
           PRAGMA_VECTOR_ALWAYS
             for (j = 0; j < v_val; j++)
             {
-                xty_out[j * b_val + p_val] += y_ptr[j];
+                xty_out[j * b_val + p_val] += alpha * y_ptr[j];
             }
         }
 
@@ -175,11 +179,13 @@ algorithmFPType *y_ptr;
  *  \param xty[in]      Input matrix X'*Y
  *  \param ldxty[in]    Leading dimension of matrix X'*Y (ldxty >= p)
  *  \param beta[out]    Resulting matrix of coefficients of size ny x ldxty
+ *  \param choleskyFactor[in] Optional. Cholesky factor of X'*X with leading dimension ldxtx.
+ *                           If it is provided, X'*X is not factorized
  */
 template <typename algorithmFPType, CpuType cpu>
 static void computeLinregCoeffs(DAAL_INT *p,  algorithmFPType *xtx, DAAL_INT *ldxtx,
                                 DAAL_INT *ny, algorithmFPType *xty, DAAL_INT *ldxty, algorithmFPType *beta,
-                                services::KernelErrorCollection *_errors)
+                                services::KernelErrorCollection *_errors, const algorithmFPType *choleskyFactor = NULL)
 {
     DAAL_INT n;
     DAAL_INT i_one = 1;
@@ -192,12 +198,19 @@ static void computeLinregCoeffs(DAAL_INT *p,  algorithmFPType *xtx, DAAL_INT *ld
     const size_t xtxSizeInBytes = (*p) * (*ldxtx) * sizeof(algorithmFPType);
     algorithmFPType * const tempXTX = static_cast<algorithmFPType *>(daal::services::daal_malloc(xtxSizeInBytes));
     if (!tempXTX) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
-    daal::services::daal_memcpy_s(tempXTX, xtxSizeInBytes, xtx, xtxSizeInBytes);
+    if (choleskyFactor)
+    {
+        daal::services::daal_memcpy_s(tempXTX, xtxSizeInBytes, choleskyFactor, xtxSizeInBytes);
+    }
+    else
+    {
+        daal::services::daal_memcpy_s(tempXTX, xtxSizeInBytes, xtx, xtxSizeInBytes);
 
-    /* Perform L*L' decomposition of X'*X */
-    Lapack<algorithmFPType, cpu>::xpotrf(&uplo, p, tempXTX, ldxtx, &info);
-    if (info < 0) { daal::services::daal_free(tempXTX); _errors->add(services::ErrorLinearRegressionInternal); return; }
-    if (info > 0) { daal::services::daal_free(tempXTX); _errors->add(services::ErrorNormEqSystemSolutionFailed); return; }
+        /* Perform L*L' decomposition of X'*X */
+        Lapack<algorithmFPType, cpu>::xpotrf(&uplo, p, tempXTX, ldxtx, &info);
+        if (info < 0) { daal::services::daal_free(tempXTX); _errors->add(services::ErrorLinearRegressionInternal); return; }
+        if (info > 0) { daal::services::daal_free(tempXTX); _errors->add(services::ErrorNormEqSystemSolutionFailed); return; }
+    }
 
     /* Solve L*L'*b=Y */
     Lapack<algorithmFPType, cpu>::xpotrs(&uplo, p, ny, tempXTX, ldxtx, beta, ldxty, &info);
@@ -211,7 +224,7 @@ template <typename algorithmFPType, CpuType cpu>
 void updatePartialModelNormEq(NumericTable *x, NumericTable *y,
             linear_regression::Model *r,
             const daal::algorithms::Parameter *par, bool isOnline,
-            services::KernelErrorCollection *_errors)
+            services::KernelErrorCollection *_errors, algorithmFPType alpha = 1.0)
 {
     const linear_regression::Parameter *parameter = static_cast<const linear_regression::Parameter *>(par);
     ModelNormEq *rr = static_cast<ModelNormEq *>(r);
@@ -288,7 +301,7 @@ void updatePartialModelNormEq(NumericTable *x, NumericTable *y,
         DAAL_INT nB = nBetasIntercept;
         DAAL_INT nV = nResponses;
 
-        updatePartialSums<algorithmFPType, cpu>(&nP, &nN, &nB, dx_ptr, xtx_local, &nV, dy_ptr, xty_local);
+        updatePartialSums<algorithmFPType, cpu>(&nP, &nN, &nB, dx_ptr, xtx_local, &nV, dy_ptr, xty_local, alpha);
     } );
 
     /* Sum all xtx and free buffer */
@@ -316,6 +329,132 @@ void updatePartialModelNormEq(NumericTable *x, NumericTable *y,
 
 } /* updatePartialModelNormEq */
 
+/* Number of observations copied at once to modify the Cholesky factor of X'*X */
+const size_t choleskyUpdateBlockSize = 512;
+
+/**
+ *  \brief Applies the observations to the Cholesky factor of X'*X as the rank-k update or downdate
+ *
+ *  \param x[in]                Numeric table with observations
+ *  \param nBetasIntercept[in]  Dimension of X'*X
+ *  \param l[in,out]            Lower triangle Cholesky factor of X'*X
+ *  \param downdate[in]         Flag. True if the observations are removed
+ *
+ *  \return True if the factor was modified, false if the modified matrix is not positive definite or an error occurred
+ */
+template <typename algorithmFPType, CpuType cpu>
+static bool applyObservationsToCholeskyFactor(NumericTable *x, size_t nBetasIntercept, algorithmFPType *l, bool downdate,
+                                              services::KernelErrorCollection *_errors)
+{
+    const size_t nRows     = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    const size_t nRowsInBlock = (nRows < choleskyUpdateBlockSize ? nRows : choleskyUpdateBlockSize);
+
+    TArray<algorithmFPType, cpu> rowsArray(nRowsInBlock * nBetasIntercept);
+    TArray<algorithmFPType, cpu> columnArray(nBetasIntercept);
+    algorithmFPType *rows = rowsArray.get();
+    if (!rows || !columnArray.get()) { _errors->add(services::ErrorMemoryAllocationFailed); return false; }
+
+    for (size_t iRow = 0; iRow < nRows; iRow += nRowsInBlock)
+    {
+        const size_t nRowsInCurrentBlock = (nRows - iRow < nRowsInBlock ? nRows - iRow : nRowsInBlock);
+        ReadRows<algorithmFPType, cpu> xRows(x, iRow, nRowsInCurrentBlock);
+        const algorithmFPType *px = xRows.get();
+        if (!px) { _errors->add(services::ErrorMemoryAllocationFailed); return false; }
+
+        /* Observations are extended with 1 in case of the intercept term */
+        for (size_t i = 0; i < nRowsInCurrentBlock; i++)
+        {
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                rows[i * nBetasIntercept + j] = px[i * nFeatures + j];
+            }
+            if (nBetasIntercept > nFeatures) { rows[i * nBetasIntercept + nFeatures] = 1.0; }
+        }
+
+        if (cholesky::internal::modifyCholeskyFactor<algorithmFPType, cpu>(nBetasIntercept, l, nRowsInCurrentBlock, rows,
+                                                                           downdate, columnArray.get()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ *  \brief Updates the Cholesky factor of X'*X stored in the partial model with the added and removed observations,
+ *         so that the finalization does not need to factorize X'*X.
+ *         The factor is recomputed from X'*X if it is not available or if the downdate fails
+ *
+ *  \param x[in]         Numeric table with added observations
+ *  \param removedX[in]  Numeric table with removed observations, can be NULL
+ *  \param r[in,out]     Partial model that contains X'*X updated with the observations
+ */
+template <typename algorithmFPType, CpuType cpu>
+void updateModelCholeskyFactor(NumericTable *x, NumericTable *removedX, linear_regression::Model *r,
+                               services::KernelErrorCollection *_errors)
+{
+    linear_regression::internal::ModelNormEqInternal *model = dynamic_cast<linear_regression::internal::ModelNormEqInternal *>(r);
+    if (!model) { return; }
+
+    const size_t nBetasIntercept = r->getNumberOfBetas() - (r->getInterceptFlag() ? 0 : 1);
+    NumericTablePtr factorTable = model->getCholeskyFactorTable();
+
+    if (factorTable)
+    {
+        WriteRows<algorithmFPType, cpu> factorRows(factorTable.get(), 0, nBetasIntercept);
+        algorithmFPType *l = factorRows.get();
+        if (!l) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+        const bool isUpdated = applyObservationsToCholeskyFactor<algorithmFPType, cpu>(x, nBetasIntercept, l, false, _errors) &&
+            (!removedX || applyObservationsToCholeskyFactor<algorithmFPType, cpu>(removedX, nBetasIntercept, l, true, _errors));
+        if (isUpdated || !_errors->isEmpty()) { return; }
+    }
+    else
+    {
+        factorTable.reset(new HomogenNumericTable<algorithmFPType>(nBetasIntercept, nBetasIntercept, NumericTable::doAllocate));
+        if (!factorTable.get()) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
+    }
+
+    /* Compute the factor from X'*X. The factor is not available if X'*X is not positive definite */
+    model->setCholeskyFactorTable(NumericTablePtr());
+
+    ReadRows<algorithmFPType, cpu> xtxRows(model->getXTXTable().get(), 0, nBetasIntercept);
+    WriteRows<algorithmFPType, cpu> factorRows(factorTable.get(), 0, nBetasIntercept);
+    const algorithmFPType *xtx = xtxRows.get();
+    algorithmFPType *l = factorRows.get();
+    if (!xtx || !l) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    for (size_t i = 0; i < nBetasIntercept; i++)
+    {
+        for (size_t j = 0; j <= i; j++)
+        {
+            l[i * nBetasIntercept + j] = xtx[i * nBetasIntercept + j];
+        }
+        for (size_t j = i + 1; j < nBetasIntercept; j++)
+        {
+            l[i * nBetasIntercept + j] = 0.0;
+        }
+    }
+
+    char uplo = 'U';
+    DAAL_INT dim = (DAAL_INT)nBetasIntercept;
+    DAAL_INT info;
+    Lapack<algorithmFPType, cpu>::xpotrf(&uplo, &dim, l, &dim, &info);
+    if (info == 0) { model->setCholeskyFactorTable(factorTable); }
+}
+
+/**
+ *  \brief Drops the Cholesky factor stored in the partial model when X'*X is updated without it
+ *
+ *  \param r[in,out]     Partial model
+ */
+inline void resetModelCholeskyFactor(linear_regression::Model *r)
+{
+    linear_regression::internal::ModelNormEqInternal *model = dynamic_cast<linear_regression::internal::ModelNormEqInternal *>(r);
+    if (model) { model->setCholeskyFactorTable(NumericTablePtr()); }
+}
+
 template<typename algorithmFPType, CpuType cpu>
 static void copyModelIntermediateTable(size_t srcSize, const algorithmFPType * src, NumericTable & dest)
 {
@@ -348,13 +487,29 @@ void finalizeModelNormEq(linear_regression::Model *a, linear_regression::Model *
     algorithmFPType *xtx, *xty;
     getModelPartialSums<algorithmFPType, cpu>(aa, nBetas, nResponses, readOnly, &xtxTable, xtxBD, &xtx, &xtyTable, xtyBD, &xty);
 
+    /* Use the Cholesky factor maintained in the online processing mode if it is available and non-singular */
+    linear_regression::internal::ModelNormEqInternal *aInternal = dynamic_cast<linear_regression::internal::ModelNormEqInternal *>(a);
+    NumericTablePtr factorTable = (aInternal ? aInternal->getCholeskyFactorTable() : NumericTablePtr());
+    ReadRows<algorithmFPType, cpu> factorRows;
+    const algorithmFPType *choleskyFactor = NULL;
+    if (factorTable)
+    {
+        factorRows.set(factorTable.get(), 0, nBetasIntercept);
+        choleskyFactor = factorRows.get();
+        for (DAAL_INT i = 0; choleskyFactor && i < nBetasIntercept; i++)
+        {
+            if (!(choleskyFactor[i * nBetasIntercept + i] > 0)) { choleskyFactor = NULL; }
+        }
+    }
+
     if (aa != rr)
     {
         copyModelIntermediateTable<algorithmFPType, cpu>(xtxBD.getNumberOfRows() * xtxBD.getNumberOfColumns(), xtx, *(rr->getXTXTable()));
         copyModelIntermediateTable<algorithmFPType, cpu>(xtyBD.getNumberOfRows() * xtyBD.getNumberOfColumns(), xty, *(rr->getXTYTable()));
     }
 
-    computeLinregCoeffs<algorithmFPType, cpu>(&nBetasIntercept, xtx, &nBetasIntercept, &nResponses, xty, &nBetasIntercept, betaBuffer, _errors);
+    computeLinregCoeffs<algorithmFPType, cpu>(&nBetasIntercept, xtx, &nBetasIntercept, &nResponses, xty, &nBetasIntercept, betaBuffer, _errors,
+                                              choleskyFactor);
 
     releaseModelNormEqPartialSums<algorithmFPType, cpu>(xtxTable, xtxBD, xtyTable, xtyBD);
 
@@ -409,11 +564,26 @@ services::Status LinearRegressionTrainBatchKernel<algorithmFPType, training::nor
 
 template <typename algorithmFPType, CpuType cpu>
 services::Status LinearRegressionTrainOnlineKernel<algorithmFPType, training::normEqDense, cpu>::compute(
-    NumericTable *x, NumericTable *y, linear_regression::Model *r,
-    const daal::algorithms::Parameter *par)
+    NumericTable *x, NumericTable *y, NumericTable *removedX, NumericTable *removedY,
+    linear_regression::Model *r, const daal::algorithms::Parameter *par)
 {
     bool isOnline = true;
     updatePartialModelNormEq<algorithmFPType, cpu>(x, y, r, par, isOnline, this->_errors.get());
+    DAAL_KERNEL_CHECK(this->_errors->isEmpty());
+
+    /* Subtract contributions of the removed observations from X'*X and X'*Y.
+       The Cholesky factor is maintained only while observations are removed,
+       otherwise the finalization factorizes X'*X once */
+    if (removedX)
+    {
+        updatePartialModelNormEq<algorithmFPType, cpu>(removedX, removedY, r, par, isOnline, this->_errors.get(), -1.0);
+        DAAL_KERNEL_CHECK(this->_errors->isEmpty());
+        updateModelCholeskyFactor<algorithmFPType, cpu>(x, removedX, r, this->_errors.get());
+    }
+    else
+    {
+        resetModelCholeskyFactor(r);
+    }
     DAAL_RETURN_STATUS();
 }
 
@@ -764,8 +764,8 @@ services::Status LinearRegressionTrainBatchKernel<algorithmFPType, training::qrD
 
 template <typename algorithmFPType, CpuType cpu>
 services::Status LinearRegressionTrainOnlineKernel<algorithmFPType, training::qrDense, cpu>::compute(
-            NumericTable *x, NumericTable *y, linear_regression::Model *r,
-            const daal::algorithms::Parameter *par)
+            NumericTable *x, NumericTable *y, NumericTable *removedX, NumericTable *removedY,
+            linear_regression::Model *r, const daal::algorithms::Parameter *par)
 {
     bool isOnline = true;
     updatePartialModelQR_threaded<algorithmFPType, cpu>(x, y, r, par, isOnline, this->_errors.get());
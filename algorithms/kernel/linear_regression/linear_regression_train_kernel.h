@@ -73,8 +73,8 @@ template <typename algorithmFPType, CpuType cpu>
 class LinearRegressionTrainOnlineKernel<algorithmFPType, training::normEqDense, cpu> : public daal::algorithms::Kernel
 {
 public:
-    services::Status compute(NumericTable *x, NumericTable *y, linear_regression::Model *r,
-                 const daal::algorithms::Parameter *par);
+    services::Status compute(NumericTable *x, NumericTable *y, NumericTable *removedX, NumericTable *removedY,
+                 linear_regression::Model *r, const daal::algorithms::Parameter *par);
     services::Status finalizeCompute(linear_regression::Model *a, linear_regression::Model *r,
                          const daal::algorithms::Parameter *par);
 };
@@ -83,8 +83,8 @@ template <typename algorithmFPType, CpuType cpu>
 class LinearRegressionTrainOnlineKernel<algorithmFPType, training::qrDense, cpu> : public daal::algorithms::Kernel
 {
 public:
-    services::Status compute(NumericTable *x, NumericTable *y, linear_regression::Model *r,
-                 const daal::algorithms::Parameter *par);
+    services::Status compute(NumericTable *x, NumericTable *y, NumericTable *removedX, NumericTable *removedY,
+                 linear_regression::Model *r, const daal::algorithms::Parameter *par);
     services::Status finalizeCompute(linear_regression::Model *a, linear_regression::Model *r,
                          const daal::algorithms::Parameter *par);
 };
@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/linear_regression/linear_regression_training_types.h"
+#include "daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -83,6 +84,18 @@ services::Status Input::check(const daal::algorithms::Parameter *par, int method
     size_t nColumnsInData = dataTable->getNumberOfColumns();
 
     DAAL_CHECK(nRowsInData >= nColumnsInData, ErrorIncorrectNumberOfObservations);
+
+    NumericTablePtr removedDataTable = get(removedData);
+    NumericTablePtr removedDependentVariablesTable = get(removedDependentVariables);
+    if(removedDataTable || removedDependentVariablesTable)
+    {
+        DAAL_CHECK(method == normEqDense, ErrorMethodNotSupported);
+        DAAL_CHECK_EX(removedDataTable, ErrorNullInputNumericTable, ArgumentName, removedDataStr());
+        DAAL_CHECK_EX(removedDependentVariablesTable, ErrorNullInputNumericTable, ArgumentName, removedDependentVariablesStr());
+        DAAL_CHECK_STATUS(s, checkNumericTable(removedDataTable.get(), removedDataStr(), 0, 0, nColumnsInData));
+        DAAL_CHECK_STATUS(s, checkNumericTable(removedDependentVariablesTable.get(), removedDependentVariablesStr(), 0, 0,
+            getNumberOfDependentVariables(), removedDataTable->getNumberOfRows()));
+    }
     return s;
 }
 
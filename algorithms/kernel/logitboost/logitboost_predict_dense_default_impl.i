@@ -33,6 +33,7 @@
 #include "service_memory.h"
 #include "service_numeric_table.h"
 #include "logitboost_impl.i"
+#include "boosting_predict_stump_ensemble.h"
 
 using namespace daal::algorithms::logitboost::internal;
 
@@ -57,6 +58,17 @@ services::Status LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu>::co
     const size_t nc  = parameter->nClasses;           /* Number of classes */
     const size_t M   = m->getIterations();            /* Number of terms of additive regression in the model */
     Model *boostModel = const_cast<Model *>(m);
+    services::Status s;
+
+    /* Ensemble of decision stumps is applied to the data in one pass */
+    if (a->getDataLayout() != NumericTableIface::csrArray)
+    {
+        boosting::prediction::internal::StumpEnsemble<algorithmFPType, cpu> stumps;
+        bool isFlattened = false;
+        DAAL_CHECK_STATUS(s, stumps.init(boostModel, M * nc, dim, nc, isFlattened));
+        if (isFlattened)
+            return computeStumps(stumps, a.get(), n, nc, r);
+    }
 
     /* Allocate memory */
     TArray<algorithmFPType, cpu> pred(n * nc);
@@ -65,7 +77,6 @@ services::Status LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu>::co
 
     daal::services::internal::service_memset<algorithmFPType, cpu>(F.get(), 0, n * nc);
 
-    services::Status s;
     services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction;
     learnerPredict->inputBase->set(classifier::prediction::data, a);
 
@@ -95,11 +106,11 @@ services::Status LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu>::co
     {
         int idx = 0;
         algorithmFPType fmax = F[i * nc];
-        for ( int j = 1; j < nc; j++ )
+        for ( size_t j = 1; j < nc; j++ )
         {
             if ( F[i * nc + j] > fmax )
             {
-                idx = j;
+                idx = (int)j;
                 fmax = F[i * nc + j];
             }
         }
@@ -108,6 +119,41 @@ services::Status LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu>::co
     return s;
 }
 
+template<typename algorithmFPType, CpuType cpu>
+services::Status LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu>::computeStumps(
+    const boosting::prediction::internal::StumpEnsemble<algorithmFPType, cpu> &stumps, NumericTable *a, size_t n, size_t nc, NumericTable *r)
+{
+    /* Sums of responses of the weak learners of each class */
+    TArray<algorithmFPType, cpu> S(n * nc);
+    DAAL_CHECK(S.get(), services::ErrorMemoryAllocationFailed);
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, stumps.compute(a, S.get()));
+
+    WriteOnlyColumns<int, cpu> rCols(*r, 0, 0, n);
+    DAAL_CHECK_BLOCK_STATUS(rCols);
+    int *cl = rCols.get();
+    DAAL_ASSERT(cl);
+
+    /* Additive function value F_j = (nc - 1) / nc * (S_j - sum(S_k) / nc),
+       so the class with the largest sum S_j has the largest additive function value */
+    for ( size_t i = 0; i < n; i++ )
+    {
+        int idx = 0;
+        algorithmFPType smax = S[i * nc];
+        for ( size_t j = 1; j < nc; j++ )
+        {
+            if ( S[i * nc + j] > smax )
+            {
+                idx = (int)j;
+                smax = S[i * nc + j];
+            }
+        }
+        cl[i] = idx;
+    }
+    return s;
+}
+
 } // namepsace internal
 } // namespace prediction
 } // namespace logitboost
@@ -30,6 +30,7 @@
 #include "daal_defines.h"
 
 #include "logitboost_predict_kernel.h"
+#include "boosting_predict_stump_ensemble.h"
 
 namespace daal
 {
@@ -52,6 +53,10 @@ struct LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu> : public Kern
     typedef typename daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> HomogenNT;
     typedef typename services::SharedPtr<HomogenNT> HomogenNTPtr;
     services::Status compute(const NumericTablePtr& a, const Model *m, NumericTable *r, const Parameter *par);
+
+protected:
+    services::Status computeStumps(const boosting::prediction::internal::StumpEnsemble<algorithmFPType, cpu> &stumps,
+                                   NumericTable *a, size_t n, size_t nc, NumericTable *r);
 };
 
 } // namepsace internal
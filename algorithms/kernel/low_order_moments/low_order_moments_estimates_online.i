@@ -268,8 +268,8 @@ Status compute_estimates( NumericTable *dataTable,
 #endif
 
 /* Rows and features splitting by blocks */
-#define _BLOCK_SIZE_ 256
-    size_t numRowsInBlock = (_cd.nVectors > _BLOCK_SIZE_)?_BLOCK_SIZE_:_cd.nVectors;
+    const size_t _blockSize = services::internal::getTuningParameter<cpu>(services::Environment::momentsBlockSize);
+    size_t numRowsInBlock = (_cd.nVectors > _blockSize)?_blockSize:_cd.nVectors;
     size_t numRowsBlocks   = _cd.nVectors / numRowsInBlock;
     size_t numRowsInLastBlock = numRowsInBlock + ( _cd.nVectors - numRowsBlocks * numRowsInBlock);
 
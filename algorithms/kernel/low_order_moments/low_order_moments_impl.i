@@ -31,6 +31,7 @@
 #include "service_stat.h"
 #include "service_math.h"
 #include "service_memory.h"
+#include "service_tuning.h"
 #include "threading.h"
 
 
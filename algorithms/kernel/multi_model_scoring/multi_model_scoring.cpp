@@ -0,0 +1,164 @@
+/* file: multi_model_scoring.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the multi-model scoring types methods.
+//--
+*/
+
+#include "algorithms/multi_model_scoring/multi_model_scoring_types.h"
+#include "multi_model_scoring_model_type.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_scoring
+{
+namespace interface1
+{
+
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_MULTI_MODEL_SCORING_RESULT_ID);
+
+Input::Input() : daal::algorithms::Input(lastInputCollectionId + 1)
+{
+    Argument::set(models, DataCollectionPtr(new DataCollection()));
+}
+
+Input::Input(const Input& other) : daal::algorithms::Input(other){}
+
+NumericTablePtr Input::get(InputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+DataCollectionPtr Input::get(InputCollectionId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+SerializationIfacePtr Input::get(InputCollectionId id, size_t idx) const
+{
+    DataCollectionPtr collection = get(id);
+    if (!collection || idx >= collection->size()) { return SerializationIfacePtr(); }
+    return (*collection)[idx];
+}
+
+void Input::set(InputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+void Input::set(InputCollectionId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+void Input::add(InputCollectionId id, const SerializationIfacePtr &ptr)
+{
+    DataCollectionPtr collection = get(id);
+    if (!collection) { return; }
+    collection->push_back(ptr);
+}
+
+size_t Input::getNumberOfResultColumns() const
+{
+    DataCollectionPtr collection = get(models);
+    size_t nColumns = 0;
+    for (size_t i = 0; collection && i < collection->size(); i++)
+    {
+        nColumns += internal::getNumberOfResultColumns((*collection)[i].get());
+    }
+    return nColumns;
+}
+
+/**
+* Checks input objects of the multi-model scoring
+* \param[in] par     Algorithm parameter
+* \param[in] method  Computation method of the algorithm
+*/
+services::Status Input::check(const daal::algorithms::Parameter *par, int method) const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr()));
+    const size_t nFeatures = get(data)->getNumberOfColumns();
+
+    DataCollectionPtr modelsCollection = get(models);
+    DAAL_CHECK(modelsCollection, ErrorNullInputDataCollection);
+    const size_t nModels = modelsCollection->size();
+    DAAL_CHECK(nModels > 0, ErrorIncorrectNumberOfElementsInInputCollection);
+    for (size_t i = 0; i < nModels; i++)
+    {
+        SerializationIface *ptr = (*modelsCollection)[i].get();
+        DAAL_CHECK(ptr, ErrorNullModel);
+        switch (internal::getScoredModelType(ptr))
+        {
+        case internal::linearModel:
+            {
+                linear_model::Model *m = static_cast<linear_model::Model *>(ptr);
+                DAAL_CHECK_STATUS(s, checkNumericTable(m->getBeta().get(), betaStr(), 0, 0, nFeatures + 1));
+                break;
+            }
+        case internal::kmeansCentroids:
+            DAAL_CHECK_STATUS(s, checkNumericTable(static_cast<NumericTable *>(ptr), modelStr(), 0, 0, nFeatures));
+            break;
+        case internal::unsupportedModel:
+            return services::Status(ErrorIncorrectTypeOfModel);
+        default:
+            break;
+        }
+    }
+    return s;
+}
+
+Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+
+NumericTablePtr Result::get(ResultId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+void Result::set(ResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+* Checks the result of the multi-model scoring
+* \param[in] input   %Input objects for the algorithm
+* \param[in] par     Algorithm parameter
+* \param[in] method  Computation method
+*/
+services::Status Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
+{
+    const Input *algInput = static_cast<const Input *>(input);
+    const size_t nVectors = algInput->get(data)->getNumberOfRows();
+    const size_t nColumns = algInput->getNumberOfResultColumns();
+    const int unexpectedLayouts = (int)packed_mask;
+    return checkNumericTable(get(prediction).get(), predictionStr(), unexpectedLayouts, 0, nColumns, nVectors);
+}
+
+} // namespace interface1
+} // namespace multi_model_scoring
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,65 @@
+/* file: multi_model_scoring_batch_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the multi-model scoring container -- a class that contains
+//  the multi-model scoring kernels for supported architectures.
+//--
+*/
+
+#include "multi_model_scoring_types.h"
+#include "multi_model_scoring_batch.h"
+#include "multi_model_scoring_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_scoring
+{
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::MultiModelScoringKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input  *input  = static_cast<Input *>(_in );
+    Result *result = static_cast<Result *>(_res);
+
+    NumericTable *ntData = input->get(data).get();
+    DataCollection *modelsCollection = input->get(models).get();
+    NumericTable *ntPrediction = result->get(prediction).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::MultiModelScoringKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                       ntData, modelsCollection, ntPrediction);
+}
+
+} // namespace daal::algorithms::multi_model_scoring
+} // namespace daal::algorithms
+} // namespace daal
@@ -0,0 +1,44 @@
+/* file: multi_model_scoring_dense_default_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the multi-model scoring for dense data.
+//--
+*/
+
+#include "multi_model_scoring_batch_container.h"
+#include "multi_model_scoring_kernel.h"
+#include "multi_model_scoring_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_scoring
+{
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+}
+namespace internal
+{
+template class MultiModelScoringKernel<defaultDense, DAAL_FPTYPE, DAAL_CPU>;
+} // namespace daal::algorithms::multi_model_scoring::internal
+} // namespace daal::algorithms::multi_model_scoring
+} // namespace daal::algorithms
+} // namespace daal
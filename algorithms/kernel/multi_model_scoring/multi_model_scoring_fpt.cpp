@@ -0,0 +1,58 @@
+/* file: multi_model_scoring_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the multi-model scoring result.
+//--
+*/
+
+#include "algorithms/multi_model_scoring/multi_model_scoring_types.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_scoring
+{
+namespace interface1
+{
+/**
+ * Allocates memory to store the results of the multi-model scoring
+ * \param[in] input     Pointer to the structure of the input objects
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const int method)
+{
+    const Input *in = static_cast<const Input *>(input);
+
+    const size_t nColumns = in->getNumberOfResultColumns();
+    const size_t nVectors = in->get(data)->getNumberOfRows();
+
+    Argument::set(prediction, NumericTablePtr(new HomogenNumericTable<algorithmFPType>(nColumns, nVectors, NumericTable::doAllocate)));
+    return services::Status();
+}
+
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const int method);
+
+} // namespace interface1
+} // namespace multi_model_scoring
+} // namespace algorithms
+} // namespace daal
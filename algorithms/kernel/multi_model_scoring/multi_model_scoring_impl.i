@@ -0,0 +1,400 @@
+/* file: multi_model_scoring_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the multi-model scoring: each block of observations is read once
+//  and all the models are applied to it.
+//--
+*/
+
+#include "service_numeric_table.h"
+#include "service_blas.h"
+#include "service_error_handling.h"
+#include "threading.h"
+#include "multi_model_scoring_model_type.h"
+#include "df_classification_model_impl.h"
+#include "df_regression_model_impl.h"
+#include "df_predict_dense_default_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_scoring
+{
+namespace internal
+{
+
+/* Number of observations in a block, the block is kept in cache while all the models are applied to it */
+const size_t scoringBlockSize = 256;
+
+/* Finds the number of classes of the decision forest classification model as the largest class label in its leaves */
+class ClassCountVisitor : public decision_forest::classification::NodeVisitor
+{
+public:
+    ClassCountVisitor() : nClasses(0) {}
+    virtual bool onLeafNode(size_t level, size_t response) DAAL_C11_OVERRIDE
+    {
+        if (nClasses <= response) { nClasses = response + 1; }
+        return true;
+    }
+    virtual bool onSplitNode(size_t level, size_t featureIndex, double featureValue) DAAL_C11_OVERRIDE { return true; }
+    size_t nClasses;
+};
+
+/* Model prepared for the scoring */
+template <typename algorithmFPType, CpuType cpu>
+struct ScoredModel
+{
+    ScoredModelType type;
+    size_t iColumn;                             /* Index of the first result column of the model */
+    size_t nColumns;                            /* Number of result columns of the model */
+    size_t nRows;                               /* Number of responses of the linear model, clusters or classes */
+    bool interceptFlag;
+    const decision_forest::internal::ModelImpl *forest;
+    TArray<algorithmFPType, cpu> coefficients;  /* Betas of the linear model or K-Means centroids */
+    TArray<algorithmFPType, cpu> norms;         /* Halves of the squared norms of K-Means centroids */
+};
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status prepareModel(SerializationIface *ptr, size_t nFeatures, ScoredModel<algorithmFPType, cpu> &m)
+{
+    m.type = getScoredModelType(ptr);
+    m.nColumns = getNumberOfResultColumns(ptr);
+    m.nRows = 0;
+    m.interceptFlag = false;
+    m.forest = nullptr;
+    switch (m.type)
+    {
+    case decisionForestClassification:
+        {
+            decision_forest::classification::Model *model = static_cast<decision_forest::classification::Model *>(ptr);
+            m.forest = static_cast<const decision_forest::classification::internal::ModelImpl *>(model);
+            ClassCountVisitor visitor;
+            for (size_t i = 0; i < model->numberOfTrees(); i++)
+            {
+                model->traverseDF(i, visitor);
+            }
+            m.nRows = (visitor.nClasses ? visitor.nClasses : 1);
+            break;
+        }
+    case decisionForestRegression:
+        m.forest = static_cast<const decision_forest::regression::internal::ModelImpl *>(
+            static_cast<decision_forest::regression::Model *>(ptr));
+        break;
+    case linearModel:
+        {
+            linear_model::Model *model = static_cast<linear_model::Model *>(ptr);
+            NumericTable *betaTable = model->getBeta().get();
+            m.nRows = betaTable->getNumberOfRows();
+            m.interceptFlag = model->getInterceptFlag();
+            ReadRows<algorithmFPType, cpu> betaRows(betaTable, 0, m.nRows);
+            DAAL_CHECK_BLOCK_STATUS(betaRows);
+            const size_t size = m.nRows * (nFeatures + 1);
+            DAAL_CHECK_MALLOC(m.coefficients.reset(size));
+            daal::services::daal_memcpy_s(m.coefficients.get(), size * sizeof(algorithmFPType), betaRows.get(), size * sizeof(algorithmFPType));
+            break;
+        }
+    case kmeansCentroids:
+        {
+            NumericTable *centroidsTable = static_cast<NumericTable *>(ptr);
+            m.nRows = centroidsTable->getNumberOfRows();
+            ReadRows<algorithmFPType, cpu> centroidsRows(centroidsTable, 0, m.nRows);
+            DAAL_CHECK_BLOCK_STATUS(centroidsRows);
+            const size_t size = m.nRows * nFeatures;
+            DAAL_CHECK_MALLOC(m.coefficients.reset(size) && m.norms.reset(m.nRows));
+            daal::services::daal_memcpy_s(m.coefficients.get(), size * sizeof(algorithmFPType), centroidsRows.get(), size * sizeof(algorithmFPType));
+            for (size_t k = 0; k < m.nRows; k++)
+            {
+                const algorithmFPType *c = m.coefficients.get() + k * nFeatures;
+                algorithmFPType norm = 0;
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    norm += c[j] * c[j];
+                }
+                m.norms[k] = norm * (algorithmFPType)0.5;
+            }
+            break;
+        }
+    default:
+        return services::Status(ErrorIncorrectTypeOfModel);
+    }
+    return services::Status();
+}
+
+/* Size of the work buffer the model needs to score a block of observations */
+template <typename algorithmFPType, CpuType cpu>
+size_t workSize(const ScoredModel<algorithmFPType, cpu> &m, size_t nRows)
+{
+    return (m.type == decisionForestRegression ? nRows : nRows * m.nRows);
+}
+
+/* work = x * coefficients', the matrix of size nRows x m.nRows */
+template <typename algorithmFPType, CpuType cpu>
+void multiplyByCoefficients(const ScoredModel<algorithmFPType, cpu> &m, const algorithmFPType *x, size_t nRows, size_t nFeatures,
+                            const algorithmFPType *coefficients, size_t ldCoefficients, algorithmFPType *work)
+{
+    char trans   = 'T';
+    char notrans = 'N';
+    algorithmFPType one  = 1.0;
+    algorithmFPType zero = 0.0;
+    DAAL_INT m_ = (DAAL_INT)m.nRows;
+    DAAL_INT n_ = (DAAL_INT)nRows;
+    DAAL_INT k_ = (DAAL_INT)nFeatures;
+    DAAL_INT lda = (DAAL_INT)ldCoefficients;
+    Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, &m_, &n_, &k_, &one, const_cast<algorithmFPType *>(coefficients), &lda,
+                                       const_cast<algorithmFPType *>(x), &k_, &zero, work, &m_);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void scoreLinearModel(const ScoredModel<algorithmFPType, cpu> &m, const algorithmFPType *x, size_t nRows, size_t nFeatures,
+                      algorithmFPType *work, algorithmFPType *res, size_t nResultColumns)
+{
+    const size_t nBetas = nFeatures + 1;
+    const algorithmFPType *beta = m.coefficients.get();
+    multiplyByCoefficients<algorithmFPType, cpu>(m, x, nRows, nFeatures, beta + 1, nBetas, work);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < m.nRows; j++)
+        {
+            res[i * nResultColumns + m.iColumn + j] = work[i * m.nRows + j] + (m.interceptFlag ? beta[j * nBetas] : 0);
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void scoreCentroids(const ScoredModel<algorithmFPType, cpu> &m, const algorithmFPType *x, size_t nRows, size_t nFeatures,
+                    algorithmFPType *work, algorithmFPType *res, size_t nResultColumns)
+{
+    multiplyByCoefficients<algorithmFPType, cpu>(m, x, nRows, nFeatures, m.coefficients.get(), nFeatures, work);
+    const algorithmFPType *norms = m.norms.get();
+    for (size_t i = 0; i < nRows; i++)
+    {
+        /* The closest centroid minimizes ||c||^2 / 2 - (x, c) */
+        const algorithmFPType *dist = work + i * m.nRows;
+        size_t minIdx = 0;
+        algorithmFPType minDist = norms[0] - dist[0];
+        for (size_t k = 1; k < m.nRows; k++)
+        {
+            if (norms[k] - dist[k] < minDist)
+            {
+                minDist = norms[k] - dist[k];
+                minIdx = k;
+            }
+        }
+        res[i * nResultColumns + m.iColumn] = (algorithmFPType)minIdx;
+    }
+}
+
+/* Adds the vote of the classification tree */
+template <typename algorithmFPType>
+void addLeafResponse(const decision_forest::internal::ClassifierResponse<ClassIndexType, size_t> &response, algorithmFPType *votes,
+                     algorithmFPType *sum)
+{
+    votes[response.value] += 1;
+}
+
+/* Adds the response of the regression tree */
+template <typename algorithmFPType>
+void addLeafResponse(RegressionFPType response, algorithmFPType *votes, algorithmFPType *sum)
+{
+    *sum += (algorithmFPType)response;
+}
+
+/* Sums the responses of the trees of the decision forest regression or counts votes of the classification trees */
+template <typename algorithmFPType, CpuType cpu, typename TreeType>
+void scoreForestTrees(const ScoredModel<algorithmFPType, cpu> &m, const algorithmFPType *x, size_t nRows, size_t nCols,
+                      algorithmFPType *work)
+{
+    const decision_forest::internal::ModelImpl &forest = *m.forest;
+    for (size_t iTree = 0; iTree < forest.size(); iTree++)
+    {
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const typename TreeType::NodeType::Base *pNode =
+                decision_forest::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(*forest.at(iTree), x + i * nCols);
+            DAAL_ASSERT(pNode);
+            addLeafResponse<algorithmFPType>(TreeType::NodeType::castLeaf(pNode)->response, work + i * m.nRows, work + i);
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu, typename BinType, bool classification>
+void scoreCompactForest(const ScoredModel<algorithmFPType, cpu> &m, const algorithmFPType *x, size_t nRows, size_t nCols,
+                        BinType *bins, algorithmFPType *work)
+{
+    const decision_forest::internal::CompactForest &forest = m.forest->compactForest();
+    const size_t nFeatures = forest.nFeatures();
+    decision_forest::prediction::internal::quantizeRows<algorithmFPType, BinType, cpu>(forest, x, nRows, nCols, bins);
+    for (size_t iTree = 0; iTree < forest.nTrees(); iTree++)
+    {
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const size_t kid = forest.findLeaf<BinType>(iTree, bins + i * nFeatures)->kid;
+            if (classification)
+            {
+                work[i * m.nRows + kid] += 1;
+            }
+            else
+            {
+                work[i] += (algorithmFPType)forest.leafValue(kid);
+            }
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void scoreForest(const ScoredModel<algorithmFPType, cpu> &m, const algorithmFPType *x, size_t nRows, size_t nCols,
+                 unsigned short *bins, algorithmFPType *work, algorithmFPType *res, size_t nResultColumns)
+{
+    const bool classification = (m.type == decisionForestClassification);
+    const size_t size = workSize<algorithmFPType, cpu>(m, nRows);
+    for (size_t i = 0; i < size; i++)
+    {
+        work[i] = 0;
+    }
+
+    size_t nTrees = m.forest->size();
+    if (m.forest->isCompact())
+    {
+        const decision_forest::internal::CompactForest &forest = m.forest->compactForest();
+        nTrees = forest.nTrees();
+        if (forest.maxBins() <= 256)
+        {
+            unsigned char *bins8 = reinterpret_cast<unsigned char *>(bins);
+            if (classification) { scoreCompactForest<algorithmFPType, cpu, unsigned char, true >(m, x, nRows, nCols, bins8, work); }
+            else                { scoreCompactForest<algorithmFPType, cpu, unsigned char, false>(m, x, nRows, nCols, bins8, work); }
+        }
+        else
+        {
+            if (classification) { scoreCompactForest<algorithmFPType, cpu, unsigned short, true >(m, x, nRows, nCols, bins, work); }
+            else                { scoreCompactForest<algorithmFPType, cpu, unsigned short, false>(m, x, nRows, nCols, bins, work); }
+        }
+    }
+    else if (classification)
+    {
+        scoreForestTrees<algorithmFPType, cpu, decision_forest::classification::internal::ModelImpl::TreeType>(m, x, nRows, nCols, work);
+    }
+    else
+    {
+        scoreForestTrees<algorithmFPType, cpu, decision_forest::regression::internal::ModelImpl::TreeType>(m, x, nRows, nCols, work);
+    }
+
+    for (size_t i = 0; i < nRows; i++)
+    {
+        algorithmFPType value = 0;
+        if (classification)
+        {
+            /* Majority vote */
+            const algorithmFPType *votes = work + i * m.nRows;
+            size_t maxIdx = 0;
+            for (size_t k = 1; k < m.nRows; k++)
+            {
+                if (votes[maxIdx] < votes[k]) { maxIdx = k; }
+            }
+            value = (algorithmFPType)maxIdx;
+        }
+        else if (nTrees)
+        {
+            value = work[i] / (algorithmFPType)nTrees;
+        }
+        res[i * nResultColumns + m.iColumn] = value;
+    }
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status MultiModelScoringKernel<method, algorithmFPType, cpu>::compute(const NumericTable *ntData, const DataCollection *models,
+                                                                               NumericTable *ntPrediction)
+{
+    typedef ScoredModel<algorithmFPType, cpu> TScoredModel;
+
+    const size_t nVectors = ntData->getNumberOfRows();
+    const size_t nFeatures = ntData->getNumberOfColumns();
+    const size_t nResultColumns = ntPrediction->getNumberOfColumns();
+    const size_t nModels = models->size();
+
+    /* Coefficients of the models are converted to algorithmFPType once */
+    TArray<TScoredModel, cpu> aModels(nModels);
+    DAAL_CHECK_MALLOC(aModels.get());
+    size_t iColumn = 0;
+    size_t maxWorkSize = 1;
+    size_t maxBinsSize = 1;
+    for (size_t i = 0; i < nModels; i++)
+    {
+        TScoredModel &m = aModels[i];
+        services::Status s = prepareModel<algorithmFPType, cpu>((*models)[i].get(), nFeatures, m);
+        if (!s) { return s; }
+        m.iColumn = iColumn;
+        iColumn += m.nColumns;
+        const size_t size = workSize<algorithmFPType, cpu>(m, scoringBlockSize);
+        if (maxWorkSize < size) { maxWorkSize = size; }
+        if (m.forest && m.forest->isCompact())
+        {
+            const size_t nForestFeatures = m.forest->compactForest().nFeatures();
+            DAAL_CHECK(nForestFeatures <= nFeatures, ErrorIncorrectNumberOfFeatures);
+            if (maxBinsSize < scoringBlockSize * nForestFeatures) { maxBinsSize = scoringBlockSize * nForestFeatures; }
+        }
+    }
+    DAAL_CHECK(iColumn == nResultColumns, ErrorIncorrectNumberOfColumnsInOutputNumericTable);
+
+    size_t nBlocks = nVectors / scoringBlockSize;
+    nBlocks += (nBlocks * scoringBlockSize != nVectors);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t iStartRow = iBlock * scoringBlockSize;
+        const size_t nRows = (iBlock == nBlocks - 1) ? nVectors - iStartRow : scoringBlockSize;
+
+        ReadRows<algorithmFPType, cpu> xRows(const_cast<NumericTable *>(ntData), iStartRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+        WriteOnlyRows<algorithmFPType, cpu> resRows(ntPrediction, iStartRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(resRows);
+        TArray<algorithmFPType, cpu> aWork(maxWorkSize);
+        TArray<unsigned short, cpu> aBins(maxBinsSize);
+        DAAL_CHECK_THR(aWork.get() && aBins.get(), ErrorMemoryAllocationFailed);
+
+        const algorithmFPType *x = xRows.get();
+        algorithmFPType *res = resRows.get();
+        for (size_t i = 0; i < nModels; i++)
+        {
+            const TScoredModel &m = aModels[i];
+            switch (m.type)
+            {
+            case linearModel:
+                scoreLinearModel<algorithmFPType, cpu>(m, x, nRows, nFeatures, aWork.get(), res, nResultColumns);
+                break;
+            case kmeansCentroids:
+                scoreCentroids<algorithmFPType, cpu>(m, x, nRows, nFeatures, aWork.get(), res, nResultColumns);
+                break;
+            default:
+                scoreForest<algorithmFPType, cpu>(m, x, nRows, nFeatures, aBins.get(), aWork.get(), res, nResultColumns);
+                break;
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+} // namespace daal::algorithms::multi_model_scoring::internal
+} // namespace daal::algorithms::multi_model_scoring
+} // namespace daal::algorithms
+} // namespace daal
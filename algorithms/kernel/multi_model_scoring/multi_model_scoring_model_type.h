@@ -0,0 +1,77 @@
+/* file: multi_model_scoring_model_type.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Recognition of the types of the models applied by the multi-model scoring.
+//--
+*/
+
+#ifndef __MULTI_MODEL_SCORING_MODEL_TYPE_H__
+#define __MULTI_MODEL_SCORING_MODEL_TYPE_H__
+
+#include "numeric_table.h"
+#include "algorithms/decision_forest/decision_forest_classification_model.h"
+#include "algorithms/decision_forest/decision_forest_regression_model.h"
+#include "algorithms/linear_model/linear_model_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_scoring
+{
+namespace internal
+{
+
+enum ScoredModelType
+{
+    unsupportedModel,
+    decisionForestClassification,
+    decisionForestRegression,
+    linearModel,
+    kmeansCentroids
+};
+
+inline ScoredModelType getScoredModelType(data_management::SerializationIface *ptr)
+{
+    if(dynamic_cast<decision_forest::classification::Model *>(ptr))
+        return decisionForestClassification;
+    if(dynamic_cast<decision_forest::regression::Model *>(ptr))
+        return decisionForestRegression;
+    if(dynamic_cast<linear_model::Model *>(ptr))
+        return linearModel;
+    if(dynamic_cast<data_management::NumericTable *>(ptr))
+        return kmeansCentroids;
+    return unsupportedModel;
+}
+
+/* Number of columns of the model in the table of predictions */
+inline size_t getNumberOfResultColumns(data_management::SerializationIface *ptr)
+{
+    const ScoredModelType type = getScoredModelType(ptr);
+    if(type == linearModel)
+        return static_cast<linear_model::Model *>(ptr)->getNumberOfResponses();
+    return (type == unsupportedModel ? 0 : 1);
+}
+
+} // namespace internal
+} // namespace multi_model_scoring
+} // namespace algorithms
+} // namespace daal
+
+#endif
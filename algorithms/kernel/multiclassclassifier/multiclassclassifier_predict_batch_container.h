@@ -26,6 +26,7 @@
 #include "multi_class_classifier_predict.h"
 #include "multiclassclassifier_predict_kernel.h"
 #include "multiclassclassifier_predict_mccwu_kernel.h"
+#include "multiclassclassifier_predict_oneagainstrest_kernel.h"
 #include "kernel.h"
 
 using namespace daal::data_management;
@@ -0,0 +1,190 @@
+/* file: multiclassclassifier_predict_oneagainstrest_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/*
+//++
+//  Implementation of template function that computes prediction results using
+//  Multi-class classifier model trained with One-Against-Rest method.
+//--
+*/
+
+#ifndef __MULTICLASSCLASSIFIER_PREDICT_ONEAGAINSTREST_IMPL_I__
+#define __MULTICLASSCLASSIFIER_PREDICT_ONEAGAINSTREST_IMPL_I__
+
+#include "multi_class_classifier_model.h"
+#include "threading.h"
+#include "service_memory.h"
+#include "service_error_handling.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_class_classifier
+{
+namespace prediction
+{
+namespace internal
+{
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status MultiClassClassifierPredictKernel<defaultDense, training::oneAgainstRest, algorithmFPType, cpu>::
+compute(const NumericTable *a, const daal::algorithms::Model *m, NumericTable *r,
+        const daal::algorithms::Parameter *par)
+{
+    Model *model = static_cast<Model *>(const_cast<daal::algorithms::Model *>(m));
+    const ParameterBase *mccPar = static_cast<const ParameterBase *>(par);
+
+    /* Classes without observations in the training data set have no two-class classifier */
+    const size_t nClasses = model->getNumberOfTwoClassClassifierModels();
+    TArray<size_t, cpu> nonEmptyClassMapBuffer(nClasses);
+    DAAL_CHECK_MALLOC(nonEmptyClassMapBuffer.get());
+    size_t *nonEmptyClassMap = nonEmptyClassMapBuffer.get();
+    size_t nModels = 0;
+    for (size_t i = 0; i < nClasses; i++)
+    {
+        if (model->getTwoClassClassifierModel(i))
+            nonEmptyClassMap[nModels++] = i;
+    }
+    DAAL_CHECK(nModels, services::ErrorModelNotFullInitialized);
+
+    const size_t nFeatures = a->getNumberOfColumns();
+    const size_t nVectors = a->getNumberOfRows();
+
+    size_t nRowsInBlock = getMultiClassClassifierPredictBlockSize<algorithmFPType, cpu>();
+    /* Calculate number of blocks of rows including tail block */
+    size_t nBlocks = nVectors / nRowsInBlock;
+    if (nBlocks * nRowsInBlock < nVectors) { nBlocks++; }
+
+    typedef OneAgainstRestSubTask<algorithmFPType, cpu> TSubTask;
+    daal::ls<TSubTask *> lsTask([=]()
+    {
+        if(a->getDataLayout() == NumericTableIface::csrArray)
+            return (TSubTask*)OneAgainstRestSubTaskCSR<algorithmFPType, cpu>::create(nRowsInBlock, a, mccPar->prediction);
+        return (TSubTask*)OneAgainstRestSubTaskDense<algorithmFPType, cpu>::create(nRowsInBlock, a, mccPar->prediction);
+    });
+
+    daal::SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        const size_t startRow = iBlock * nRowsInBlock;
+        size_t nRows = nRowsInBlock;
+        if (startRow + nRows > nVectors)
+            nRows = nVectors - startRow;
+
+        TSubTask *local = lsTask.local();
+        if(!local)
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        DAAL_LS_RELEASE(TSubTask, lsTask, local); //releases local storage when leaving this scope
+
+        safeStat |= local->getBlockOfRowsOfResults(r, nFeatures, startRow, nRows, nModels, nonEmptyClassMap, model);
+    } );
+
+    lsTask.reduce([=](TSubTask *local)
+    {
+        delete local;
+    } );
+    return safeStat.detach();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status OneAgainstRestSubTask<algorithmFPType, cpu>::getBlockOfRowsOfResults(NumericTable *r, size_t nFeatures,
+    size_t startRow, size_t nRows, size_t nModels, const size_t *nonEmptyClassMap, Model *model)
+{
+    algorithmFPType *maxDecision = _buffer.get();
+    algorithmFPType *y           = maxDecision + nRows;
+
+    NumericTablePtr xTable;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, getInput(nFeatures, startRow, nRows, xTable));
+
+    NumericTablePtr yTable(new HomogenNumericTableCPU<algorithmFPType, cpu>(y, 1, nRows));
+    classifier::prediction::ResultPtr yRes(new classifier::prediction::Result());
+    DAAL_CHECK_MALLOC(yTable.get() && yRes.get());
+    yRes->set(classifier::prediction::prediction, yTable);
+
+    _mtR.set(r, 0, startRow, nRows);
+    DAAL_CHECK_BLOCK_STATUS(_mtR);
+    int *label = _mtR.get();
+
+    _simplePrediction->inputBase->set(classifier::prediction::data, xTable);
+    for (size_t i = 0; i < nModels; i++)
+    {
+        /* Compute decision function values of the "simple" classifier for class i against the rest */
+        const size_t iClass = nonEmptyClassMap[i];
+        _simplePrediction->inputBase->set(classifier::prediction::model, model->getTwoClassClassifierModel(iClass));
+        _simplePrediction->setResult(yRes);
+        s = _simplePrediction->computeNoThrow();
+        if(!s)
+            return services::Status(services::ErrorMultiClassFailedToComputeTwoClassPrediction).add(s);
+
+        /* Class with the largest decision function value wins */
+        if (i == 0)
+        {
+            for (size_t k = 0; k < nRows; k++)
+            {
+                maxDecision[k] = y[k];
+                label[k] = (int)iClass;
+            }
+            continue;
+        }
+        for (size_t k = 0; k < nRows; k++)
+        {
+            if (y[k] > maxDecision[k])
+            {
+                maxDecision[k] = y[k];
+                label[k] = (int)iClass;
+            }
+        }
+    }
+    return services::Status();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status OneAgainstRestSubTaskCSR<algorithmFPType, cpu>::getInput(size_t nFeatures, size_t startRow, size_t nRows, NumericTablePtr& res)
+{
+    _mtX.next(startRow, nRows);
+    DAAL_CHECK_BLOCK_STATUS(_mtX);
+    res.reset(new CSRNumericTable(const_cast<algorithmFPType*>(_mtX.values()), _mtX.cols(), _mtX.rows(), nFeatures, nRows));
+    DAAL_CHECK_MALLOC(res.get());
+    return services::Status();
+}
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status OneAgainstRestSubTaskDense<algorithmFPType, cpu>::getInput(size_t nFeatures, size_t startRow, size_t nRows, NumericTablePtr& res)
+{
+    _mtX.next(startRow, nRows);
+    DAAL_CHECK_BLOCK_STATUS(_mtX);
+    res.reset(new HomogenNumericTableCPU<algorithmFPType, cpu>(const_cast<algorithmFPType*>(_mtX.get()), nFeatures, nRows));
+    DAAL_CHECK_MALLOC(res.get());
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace multi_class_classifier
+} // namespace algorithms
+} // namespace daal
+
+#endif
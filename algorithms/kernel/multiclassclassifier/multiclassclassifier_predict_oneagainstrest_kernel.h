@@ -0,0 +1,145 @@
+/* file: multiclassclassifier_predict_oneagainstrest_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/*
+//++
+//  Declaration of template function that computes prediction results using
+//  Multi-class classifier model trained with One-Against-Rest method.
+//--
+*/
+
+#ifndef __MULTICLASSCLASSIFIER_PREDICT_ONEAGAINSTREST_KERNEL_H__
+#define __MULTICLASSCLASSIFIER_PREDICT_ONEAGAINSTREST_KERNEL_H__
+
+#include "multi_class_classifier_model.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_class_classifier
+{
+namespace prediction
+{
+namespace internal
+{
+
+/* Base class for the prediction subtask of the one-against-rest method.
+   All two-class classifiers are applied to a block of input observations while it is in cache */
+template<typename algorithmFPType, CpuType cpu>
+class OneAgainstRestSubTask
+{
+public:
+    DAAL_NEW_DELETE();
+    virtual ~OneAgainstRestSubTask() {}
+
+    /* Get multiclass classification results for a block of input observations */
+    services::Status getBlockOfRowsOfResults(NumericTable *r, size_t nFeatures, size_t startRow, size_t nRows,
+        size_t nModels, const size_t *nonEmptyClassMap, Model *model);
+
+protected:
+    OneAgainstRestSubTask(size_t nRowsInBlock, const services::SharedPtr<classifier::prediction::Batch>& sp) :
+        _simplePrediction(sp->clone()), _buffer(2 * nRowsInBlock) {}
+
+    bool isValid() const
+    {
+        return _buffer.get() && _simplePrediction.get();
+    }
+
+    virtual services::Status getInput(size_t nFeatures, size_t startRow, size_t nRows, NumericTablePtr& res) = 0;
+
+protected:
+    WriteOnlyColumns<int, cpu> _mtR;
+    services::SharedPtr<classifier::prediction::Batch> _simplePrediction;
+    TArray<algorithmFPType, cpu> _buffer;
+};
+
+template<typename algorithmFPType, CpuType cpu>
+class OneAgainstRestSubTaskCSR : public OneAgainstRestSubTask<algorithmFPType, cpu>
+{
+public:
+    typedef OneAgainstRestSubTask<algorithmFPType, cpu> super;
+    static OneAgainstRestSubTaskCSR* create(size_t nRowsInBlock, const NumericTable *xTable,
+        const services::SharedPtr<classifier::prediction::Batch>& sp)
+    {
+        auto val = new OneAgainstRestSubTaskCSR(nRowsInBlock, dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(xTable)), sp);
+        if(val && val->isValid())
+            return val;
+        delete val;
+        return nullptr;
+    }
+
+private:
+    OneAgainstRestSubTaskCSR(size_t nRowsInBlock, CSRNumericTableIface *xTable,
+        const services::SharedPtr<classifier::prediction::Batch>& sp) :
+        super(nRowsInBlock, sp), _mtX(xTable)
+    {
+    }
+    virtual services::Status getInput(size_t nFeatures, size_t startRow, size_t nRows, NumericTablePtr& res) DAAL_C11_OVERRIDE;
+
+private:
+    ReadRowsCSR<algorithmFPType, cpu> _mtX;
+};
+
+template<typename algorithmFPType, CpuType cpu>
+class OneAgainstRestSubTaskDense : public OneAgainstRestSubTask<algorithmFPType, cpu>
+{
+public:
+    typedef OneAgainstRestSubTask<algorithmFPType, cpu> super;
+    static OneAgainstRestSubTaskDense* create(size_t nRowsInBlock, const NumericTable *xTable,
+        const services::SharedPtr<classifier::prediction::Batch>& sp)
+    {
+        auto val = new OneAgainstRestSubTaskDense(nRowsInBlock, xTable, sp);
+        if(val && val->isValid())
+            return val;
+        delete val;
+        return nullptr;
+    }
+
+private:
+    OneAgainstRestSubTaskDense(size_t nRowsInBlock, const NumericTable *xTable,
+        const services::SharedPtr<classifier::prediction::Batch>& sp) :
+        super(nRowsInBlock, sp), _mtX(const_cast<NumericTable *>(xTable))
+    {
+    }
+    virtual services::Status getInput(size_t nFeatures, size_t startRow, size_t nRows, NumericTablePtr& res) DAAL_C11_OVERRIDE;
+
+private:
+    ReadRows<algorithmFPType, cpu> _mtX;
+};
+
+template<typename algorithmFPType, CpuType cpu>
+struct MultiClassClassifierPredictKernel<defaultDense, training::oneAgainstRest, algorithmFPType, cpu>
+        : public Kernel
+{
+    services::Status compute(const NumericTable *a, const daal::algorithms::Model *m, NumericTable *r,
+                             const daal::algorithms::Parameter *par);
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace multi_class_classifier
+} // namespace algorithms
+} // namespace daal
+
+#endif
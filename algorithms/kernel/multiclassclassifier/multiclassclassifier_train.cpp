@@ -40,6 +40,10 @@ Model::Model(const ParameterBase *par) : _modelsArray(NULL), _models(new data_ma
 {
 }
 
+Model::Model(const ParameterBase *par, size_t nModels) : _modelsArray(NULL), _models(new data_management::DataCollection(nModels))
+{
+}
+
 Model::Model() : _modelsArray(NULL), _models(new data_management::DataCollection())
 {
 }
@@ -130,7 +134,8 @@ services::Status Result::check(const daal::algorithms::Input *input, const daal:
     {
         return services::Status(services::ErrorModelNotFullInitialized);
     }
-    if(m->getNumberOfTwoClassClassifierModels() != par->nClasses * (par->nClasses - 1) / 2)
+    const size_t nModels = (method == oneAgainstRest ? par->nClasses : par->nClasses * (par->nClasses - 1) / 2);
+    if(m->getNumberOfTwoClassClassifierModels() != nModels)
     {
         return services::Status(services::ErrorModelNotFullInitialized);
     }
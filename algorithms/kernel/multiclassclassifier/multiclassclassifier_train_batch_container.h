@@ -25,6 +25,7 @@
 #include "multi_class_classifier_train.h"
 #include "multiclassclassifier_train_kernel.h"
 #include "multiclassclassifier_train_oneagainstone_kernel.h"
+#include "multiclassclassifier_train_oneagainstrest_kernel.h"
 #include "kernel.h"
 
 using namespace daal::data_management;
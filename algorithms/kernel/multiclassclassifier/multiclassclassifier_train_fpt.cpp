@@ -43,7 +43,10 @@ template <typename algorithmFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
 {
     const ParameterBase *algParameter = static_cast<const ParameterBase *>(parameter);
-    set(classifier::training::model, classifier::ModelPtr(new Model(algParameter)));
+    if(method == oneAgainstRest)
+        set(classifier::training::model, classifier::ModelPtr(new Model(algParameter, algParameter->nClasses)));
+    else
+        set(classifier::training::model, classifier::ModelPtr(new Model(algParameter)));
     return services::Status();
 }
 
@@ -0,0 +1,127 @@
+/* file: multiclassclassifier_train_oneagainstrest_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/*
+//++
+//  Implementation of One-Against-Rest method for Multi-class classifier
+//  training algorithm.
+//--
+*/
+
+#ifndef __MULTICLASSCLASSIFIER_TRAIN_ONEAGAINSTREST_IMPL_I__
+#define __MULTICLASSCLASSIFIER_TRAIN_ONEAGAINSTREST_IMPL_I__
+
+#include "multi_class_classifier_model.h"
+
+#include "threading.h"
+#include "service_error_handling.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_class_classifier
+{
+namespace training
+{
+namespace internal
+{
+
+template<typename algorithmFPType, CpuType cpu>
+services::Status MultiClassClassifierTrainKernel<oneAgainstRest, algorithmFPType, cpu>::
+compute(const NumericTable *xTable, const NumericTable *yTable, daal::algorithms::Model *r,
+        const daal::algorithms::Parameter *par)
+{
+    Model *model = static_cast<Model *>(r);
+    const Parameter *mccPar = static_cast<const Parameter *>(par);
+
+    const size_t nVectors = xTable->getNumberOfRows();
+    ReadColumns<int, cpu> mtY(*const_cast<NumericTable*>(yTable), 0, 0, nVectors);
+    DAAL_CHECK_BLOCK_STATUS(mtY);
+    const int* y = mtY.get();
+    const size_t nFeatures = xTable->getNumberOfColumns();
+    model->setNFeatures(nFeatures);
+    services::SharedPtr<classifier::training::Batch> simpleTrainingInit = mccPar->training->clone();
+
+    const size_t nClasses = mccPar->nClasses;
+    /* Classes without observations get no two-class classifier */
+    TArray<size_t, cpu> classLabelsCountBuffer(nClasses);
+    DAAL_CHECK_MALLOC(classLabelsCountBuffer.get());
+    size_t *classLabelsCount = classLabelsCountBuffer.get();
+    daal::services::internal::service_memset<size_t, cpu>(classLabelsCount, 0, nClasses);
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        DAAL_CHECK(y[i] >= 0 && (size_t)y[i] < nClasses, services::ErrorIncorrectClassLabels);
+        classLabelsCount[y[i]]++;
+    }
+
+    /* Input data table is not copied: all two-class classifiers are trained on it */
+    NumericTablePtr xTableShared(const_cast<NumericTable *>(xTable), EmptyDeleter());
+
+    typedef OneAgainstRestSubTask<algorithmFPType, cpu> TSubTask;
+    daal::ls<TSubTask *> lsTask([=, &simpleTrainingInit, &xTableShared]()
+    {
+        return TSubTask::create(nVectors, xTableShared, simpleTrainingInit);
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nClasses, nClasses, [&](size_t iClass)
+    {
+        classifier::ModelPtr pModel;
+        if(classLabelsCount[iClass])
+        {
+            TSubTask *local = lsTask.local();
+            if(!local)
+            {
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            DAAL_LS_RELEASE(TSubTask, lsTask, local); //releases local storage when leaving this scope
+
+            Status s = local->trainSimpleClassifier(nVectors, (int)iClass, y);
+            if(!s)
+            {
+                safeStat |= s;
+                safeStat.add(services::ErrorMultiClassFailedToTrainTwoClassClassifier);
+                return;
+            }
+            pModel = local->getModel();
+        }
+        model->setTwoClassClassifierModel(iClass, pModel);
+    } );
+
+    lsTask.reduce([=](TSubTask *local)
+    {
+        delete local;
+    } );
+
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace training
+} // namespace multi_class_classifier
+} // namespace algorithms
+} // namespace daal
+
+#endif
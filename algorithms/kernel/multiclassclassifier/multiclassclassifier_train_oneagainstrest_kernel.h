@@ -0,0 +1,123 @@
+/* file: multiclassclassifier_train_oneagainstrest_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/*
+//++
+//  Declaration of template structs for One-Against-Rest method for Multi-class classifier
+//  training algorithm.
+//--
+*/
+
+#ifndef __MULTICLASSCLASSIFIER_TRAIN_ONEAGAINSTREST_KERNEL_H__
+#define __MULTICLASSCLASSIFIER_TRAIN_ONEAGAINSTREST_KERNEL_H__
+
+#include "multi_class_classifier_model.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_class_classifier
+{
+namespace training
+{
+namespace internal
+{
+
+/* Trains two-class classifiers of the one-against-rest method.
+   All the classifiers share the input data table, only the labels are remapped for each class */
+template<typename algorithmFPType, CpuType cpu>
+class OneAgainstRestSubTask
+{
+public:
+    DAAL_NEW_DELETE();
+
+    static OneAgainstRestSubTask* create(size_t nVectors, const NumericTablePtr& xTable,
+        const services::SharedPtr<classifier::training::Batch>& st)
+    {
+        auto val = new OneAgainstRestSubTask(nVectors, xTable, st);
+        if(val && val->isValid())
+            return val;
+        delete val;
+        return nullptr;
+    }
+
+    services::Status trainSimpleClassifier(size_t nVectors, int classIdx, const int *y)
+    {
+        const algorithmFPType one(1.0);
+        algorithmFPType *subsetY = _subsetY.get();
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nVectors; i++)
+            subsetY[i] = (y[i] == classIdx ? one : -one);
+
+        _simpleTraining->input.set(classifier::training::data, _xTable);
+        _simpleTraining->input.set(classifier::training::labels, _subsetYTable);
+        _simpleTraining->resetResult();
+        return _simpleTraining->computeNoThrow();
+    }
+
+    classifier::ModelPtr getModel() { return _simpleTraining->getResult()->get(classifier::training::model); }
+
+private:
+    typedef HomogenNumericTableCPU<algorithmFPType, cpu> HomogenNT;
+
+    OneAgainstRestSubTask(size_t nVectors, const NumericTablePtr& xTable,
+        const services::SharedPtr<classifier::training::Batch>& st) : _subsetY(nVectors), _xTable(xTable)
+    {
+        if(!_subsetY.get())
+            return;
+        _subsetYTable.reset(new HomogenNT(_subsetY.get(), 1, nVectors));
+        if(!_subsetYTable)
+            return;
+        _simpleTraining = st->clone();
+    }
+
+    bool isValid() const
+    {
+        return _subsetY.get() && _subsetYTable.get() && _simpleTraining.get();
+    }
+
+private:
+    TArray<algorithmFPType, cpu> _subsetY;
+    NumericTablePtr _subsetYTable;
+    NumericTablePtr _xTable;
+    services::SharedPtr<classifier::training::Batch> _simpleTraining;
+};
+
+template<typename algorithmFPType, CpuType cpu>
+class MultiClassClassifierTrainKernel<oneAgainstRest, algorithmFPType, cpu> : public Kernel
+{
+public:
+    services::Status compute(const NumericTable *xTable, const NumericTable *yTable, daal::algorithms::Model *r,
+                             const daal::algorithms::Parameter *par);
+};
+
+} // namespace internal
+} // namespace training
+} // namespace multi_class_classifier
+} // namespace algorithms
+} // namespace daal
+
+#endif
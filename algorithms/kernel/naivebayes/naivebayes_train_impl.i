@@ -186,15 +186,15 @@ Status collectCounters( const Parameter *nbPar, NumericTable *ntData, NumericTab
     daal::tls<algorithmFPType *> tls_n_ci( [ = ]()-> algorithmFPType * { return _CALLOC_<algorithmFPType, cpu>(p * c); } );
 
     SafeStatus safeStat;
-    daal::threader_for_blocked( n, n, [ =, &tls_n_ci, &safeStat](algorithmFPType j0, algorithmFPType jn)
+    daal::threader_for_blocked_size( n, n, [ =, &tls_n_ci, &safeStat](size_t j0, size_t jn)
     {
         algorithmFPType *local_n_ci = tls_n_ci.local();
         DAAL_CHECK_THR(local_n_ci, ErrorMemoryAllocationFailed);
 
         localDataCollector<algorithmFPType, method, cpu> ldc(p, c, ntData, ntClass, local_n_ci);
 
-        algorithmFPType block_size = ldc.getBlockSize(jn);
-        int i;
+        size_t block_size = ldc.getBlockSize(jn);
+        size_t i;
 
         for ( i = 0 ; i + block_size < jn + 1 ; i += block_size )
         {
@@ -166,7 +166,7 @@ struct common_batchnorm_data_t
     /*******************************************************************************/
 
     /****************** Calculate weight and bias derivatives ***********************/
-    void compute_weights_biases(size_t i_index, size_t kbeg, size_t kend)
+    void compute_weights_biases(size_t i_index, size_t kbeg, size_t kend, algorithmFPType *biasesDer, algorithmFPType *weightsDer)
     {
         for(size_t k = kbeg; k < kend; k++)
         {
@@ -189,8 +189,28 @@ struct common_batchnorm_data_t
                 weightsDerSum  += g * (d - m) * s;
             }
 
-            _biasesDer[k]  += biasesDerSum;
-            _weightsDer[k] += weightsDerSum;
+            biasesDer[k]  += biasesDerSum;
+            weightsDer[k] += weightsDerSum;
+        }
+
+    return;
+    }
+    /*******************************************************************************/
+
+    /****************** Calculate multipliers of output gradients *******************/
+    void compute_multipliers(size_t kbeg, size_t kend)
+    {
+        algorithmFPType ij    = (algorithmFPType)(_offsetBefore * _offsetAfter);
+        algorithmFPType invM  = 1.0 / ij;
+        algorithmFPType invM1 = 1.0 / (ij - 1);
+
+       PRAGMA_IVDEP
+       PRAGMA_VECTOR_ALWAYS
+        for ( size_t k = kbeg; k < kend; k++ )
+        {
+            _invStDevByWeights[k]    = _weights[k] * _invStDev[k];
+            _biasesDerMultiplier[k]  = invM * _biasesDer[k];
+            _weightsDerMultiplier[k] = invM1 * _invStDev[k] * _weightsDer[k];
         }
 
     return;
@@ -387,45 +407,95 @@ services::Status BatchNormalizationKernel<algorithmFPType, method, cpu>::compute
         _cd._invStDev[k] = algorithmFPType(1.0) / _cd._stDev[k];
     }
 
-    /* Calculate weight and bias derivatives */
-    if( do_threading )
+    /* Each block of the target dimension is processed over all 'i' by one thread:
+       both weight and bias derivative sums are accumulated in a single pass and
+       the output gradient is written right after, while the block data are still in cache */
+    auto processBlockK = [ & ]( size_t kbeg, size_t kend )
     {
-        daal::threader_for( blocknum_ik, blocknum_ik, [ & ](int block_ik)
+        for (size_t i = 0; i < _cd._offsetBefore; i++)
         {
-            int block_i = block_ik / blocknum_k;
-            int block_k = block_ik % blocknum_k;
+            _cd.compute_weights_biases( i, kbeg, kend, _cd._biasesDer, _cd._weightsDer );
+        }
+
+        if(_cd._propagate_gradient)
+        {
+            _cd.compute_multipliers( kbeg, kend );
 
+            for (size_t i = 0; i < _cd._offsetBefore; i++)
+            {
+                _cd.compute_gradients( i, kbeg, kend );
+            }
+        }
+    };
+
+    if( !do_threading )
+    {
+        processBlockK( 0, _cd._dimensionSize );
+    }
+    else if( blocknum_k >= threadnum )
+    {
+        daal::threader_for( blocknum_k, blocknum_k, [ & ]( int block_k )
+        {
             size_t kbeg  = block_k * blocksize_k;
-            size_t kend  = kbeg + (( block_k == blocknum_k-1)? blocksize_last_k : blocksize_k);
+            size_t kend  = kbeg + (( block_k == (blocknum_k-1) )? blocksize_last_k : blocksize_k);
 
-            _cd.compute_weights_biases( (size_t)block_i, kbeg, kend );
+            processBlockK( kbeg, kend );
         } );
     }
     else
     {
-        for (size_t i = 0; i < _cd._offsetBefore; i++)
+        /* Not enough blocks of the target dimension to load all threads:
+           each thread accumulates partial sums over the (i, k) blocks it processes */
+        const size_t dimensionSize = _cd._dimensionSize;
+        daal::tls<algorithmFPType *> partialSums( [ = ]()-> algorithmFPType*
         {
-            _cd.compute_weights_biases( i, 0, _cd._dimensionSize );
-        }
-    }
+            algorithmFPType *ptr = (algorithmFPType *)daal_malloc(2 * dimensionSize * sizeof(algorithmFPType));
+            if( ptr )
+            {
+                for (size_t k = 0; k < 2 * dimensionSize; k++)
+                {
+                    ptr[k] = (algorithmFPType)0.0;
+                }
+            }
+            return ptr;
+        } );
 
-    /* Calculate output gradients */
-    if(_cd._propagate_gradient)
-    {
-        algorithmFPType invM  = 1.0 / (algorithmFPType)ij;
-        algorithmFPType invM1 = 1.0 / (algorithmFPType)(ij - 1);
+        daal::threader_for( blocknum_ik, blocknum_ik, [ & ](int block_ik)
+        {
+            algorithmFPType *partial = partialSums.local();
+            if( !partial ) { return; }
 
-       PRAGMA_IVDEP
-       PRAGMA_VECTOR_ALWAYS
-        for ( size_t k = 0; k < _cd._dimensionSize; k++ )
+            int block_i = block_ik / blocknum_k;
+            int block_k = block_ik % blocknum_k;
+
+            size_t kbeg  = block_k * blocksize_k;
+            size_t kend  = kbeg + (( block_k == blocknum_k-1)? blocksize_last_k : blocksize_k);
+
+            _cd.compute_weights_biases( (size_t)block_i, kbeg, kend, partial, partial + dimensionSize );
+        } );
+
+        bool isPartialAllocated = true;
+        partialSums.reduce( [ & ]( algorithmFPType *partial )
+        {
+            if( !partial ) { isPartialAllocated = false; return; }
+            for (size_t k = 0; k < dimensionSize; k++)
+            {
+                _cd._biasesDer[k]  += partial[k];
+                _cd._weightsDer[k] += partial[dimensionSize + k];
+            }
+            daal_free( partial );
+        } );
+
+        if( !isPartialAllocated )
         {
-            _cd._invStDevByWeights[k]    = _cd._weights[k] * _cd._invStDev[k];
-            _cd._biasesDerMultiplier[k]  = invM * _cd._biasesDer[k];
-            _cd._weightsDerMultiplier[k] = invM1 * _cd._invStDev[k] * _cd._weightsDer[k];
+            this->_errors->add(daal::services::ErrorMemoryAllocationFailed);
+            DAAL_RETURN_STATUS()
         }
 
-        if( do_threading ) /* threaded branch */
+        if(_cd._propagate_gradient)
         {
+            _cd.compute_multipliers( 0, dimensionSize );
+
             daal::threader_for( blocknum_ik, blocknum_ik, [ & ]( int block_ik )
             {
                 int block_i = block_ik / blocknum_k;
@@ -437,13 +507,6 @@ services::Status BatchNormalizationKernel<algorithmFPType, method, cpu>::compute
                 _cd.compute_gradients( (size_t)block_i, kbeg, kend);
             } ); /* daal::threader_for */
         }
-        else /* sequential branch */
-        {
-            for (size_t i = 0; i < _cd._offsetBefore; i++)
-            {
-                _cd.compute_gradients( i, 0, _cd._dimensionSize );
-            }
-        }
     }
 
     DAAL_RETURN_STATUS()
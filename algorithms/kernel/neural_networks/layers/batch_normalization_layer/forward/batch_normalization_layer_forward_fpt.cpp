@@ -24,6 +24,7 @@
 #include "batch_normalization_layer_forward_types.h"
 #include "batch_normalization_layer_types.h"
 #include "daal_strings.h"
+#include "layers_value_storage.h"
 
 namespace daal
 {
@@ -75,7 +76,8 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
 
     if (!get(layers::forward::value))
     {
-        DAAL_ALLOCATE_TENSOR_AND_SET(layers::forward::value, in->get(layers::forward::data)->getDimensions());
+        set(layers::forward::value, daal::internal::createLayerValueTensor<algorithmFPType, data_management::HomogenTensor>(
+                in->get(layers::forward::data)->getDimensions(), algParameter));
     }
     if (!get(layers::forward::resultForBackward))
     {
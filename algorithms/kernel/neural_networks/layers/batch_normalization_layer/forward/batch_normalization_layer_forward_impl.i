@@ -101,7 +101,6 @@ struct common_batchnorm_data_t
         }
 
         size_t ij  = _offsetBefore * _offsetAfter;
-        _invM      = 1.0 / (algorithmFPType)ij;
         _invM1     = 1.0 / (algorithmFPType)(ij - 1);
 
 
@@ -139,16 +138,19 @@ struct common_batchnorm_data_t
 
         _invstdw  = (algorithmFPType *)daal_malloc(_dimensionSize * sizeof(algorithmFPType));
         _variance = (algorithmFPType *)daal_malloc(_dimensionSize * sizeof(algorithmFPType));
+        _count    = (algorithmFPType *)daal_malloc(_dimensionSize * sizeof(algorithmFPType));
 
-        if( !(_input) || !(_mean) || !(_stdev) || !(_weights) || !(_biases) || !(_result) || !(_invstdw) || !(_variance) )
+        if( !(_input) || !(_mean) || !(_stdev) || !(_weights) || !(_biases) || !(_result) || !(_invstdw) || !(_variance) || !(_count) )
         {
             _malloc_errors++; return;
         }
 
+        /* _stdev keeps the sums of squared deviations from the mean until compute_means_stdevs() */
         for (size_t i = 0; i < _dimensionSize; i++)
         {
             _mean[i]  = (algorithmFPType)0.0;
             _stdev[i] = (algorithmFPType)0.0;
+            _count[i] = (algorithmFPType)0.0;
         }
 
     return;
@@ -175,38 +177,70 @@ struct common_batchnorm_data_t
 
         if(_invstdw)daal_free(_invstdw);
         if(_variance)daal_free(_variance);
+        if(_count)daal_free(_count);
 
     return;
     }
     /*******************************************************************************/
 
-    /****************** Calculate sums of input tensor *****************************/
-    void compute_sums( size_t i_index, size_t kbeg, size_t kend )
+    /****************** Accumulate moments of input tensor ************************/
+    /* Mean and sum of squared deviations of each row of _offsetAfter elements are computed
+       while the row is in cache and merged into the accumulated ones by Chan's formula */
+    void compute_moments( size_t i_index, size_t kbeg, size_t kend,
+                          algorithmFPType *mean, algorithmFPType *m2, algorithmFPType *count )
     {
+        const algorithmFPType nRow    = (algorithmFPType)_offsetAfter;
+        const algorithmFPType invNRow = (algorithmFPType)1.0 / nRow;
+
         for(size_t k = kbeg; k < kend; k++)
         {
             size_t idx_ik = ( i_index * _dimensionSize + k ) * _offsetAfter;
 
-            algorithmFPType sum   = 0.0;
-            algorithmFPType sumSq = 0.0;
+            algorithmFPType sum = 0.0;
 
            PRAGMA_IVDEP
            PRAGMA_VECTOR_ALWAYS
             for ( size_t j = 0; j < _offsetAfter; j++ )
             {
-                algorithmFPType arg = _input[ idx_ik + j ];
-                sum   += arg;
-                sumSq += arg * arg;
+                sum += _input[ idx_ik + j ];
             }
 
-            _mean[k]  += sum;
-            _stdev[k] += sumSq;
+            const algorithmFPType rowMean = sum * invNRow;
+            algorithmFPType rowM2 = 0.0;
+
+           PRAGMA_IVDEP
+           PRAGMA_VECTOR_ALWAYS
+            for ( size_t j = 0; j < _offsetAfter; j++ )
+            {
+                algorithmFPType dev = _input[ idx_ik + j ] - rowMean;
+                rowM2 += dev * dev;
+            }
+
+            merge_moments( k, rowMean, rowM2, nRow, mean, m2, count );
         }
 
     return;
     }
     /*******************************************************************************/
 
+    /****************** Merge moments of two sets of elements **********************/
+    static void merge_moments( size_t k, algorithmFPType otherMean, algorithmFPType otherM2, algorithmFPType otherCount,
+                               algorithmFPType *mean, algorithmFPType *m2, algorithmFPType *count )
+    {
+        if( otherCount == (algorithmFPType)0.0 ) { return; }
+
+        const algorithmFPType n     = count[k] + otherCount;
+        const algorithmFPType delta = otherMean - mean[k];
+        const algorithmFPType w     = otherCount / n;
+
+        mean[k]  += delta * w;
+        m2[k]    += otherM2 + delta * delta * count[k] * w;
+        count[k]  = n;
+
+    return;
+    }
+    /*******************************************************************************/
+
     /****************** Calculate means, stddevs... ********************************/
     void compute_means_stdevs( size_t kbeg, size_t kend )
     {
@@ -215,10 +249,8 @@ struct common_batchnorm_data_t
        PRAGMA_VECTOR_ALWAYS
         for( size_t k = kbeg; k < kend; k++ )
         {
-            _variance[k] = _invM1 * (_stdev[k] - _mean[k] * _mean[k] * _invM);
-            _mean[k]    *= _invM;
+            _variance[k] = _invM1 * _stdev[k];
             _stdev[k]    = _variance[k] + _epsilon;
-            _invstdw[k]  = _weights[k] / _stdev[k];
         }
 
         daal::internal::Math<algorithmFPType,cpu>::vSqrt( (kend-kbeg), &(_stdev[kbeg]), &(_stdev[kbeg]));
@@ -234,6 +266,23 @@ struct common_batchnorm_data_t
     }
     /*******************************************************************************/
 
+    /****************** Update population mean and variance ************************/
+    void compute_population( size_t kbeg, size_t kend, algorithmFPType alpha )
+    {
+        if( _prediction_stage ) { return; }
+
+       PRAGMA_IVDEP
+       PRAGMA_VECTOR_ALWAYS
+        for ( size_t k = kbeg; k < kend; k++ )
+        {
+            _popMean[k]     = _inPopMean[k]     + alpha * _mean[k];
+            _popVariance[k] = _inPopVariance[k] + alpha * _variance[k];
+        }
+
+    return;
+    }
+    /*******************************************************************************/
+
     /***************** Final result gradient compute *******************************/
     void compute_gradients( size_t i_index, size_t kbeg, size_t kend )
     {
@@ -292,8 +341,8 @@ struct common_batchnorm_data_t
 
     algorithmFPType *_invstdw;
     algorithmFPType *_variance;
+    algorithmFPType *_count;
 
-    algorithmFPType _invM;
     algorithmFPType _invM1;
     algorithmFPType _epsilon;
 
@@ -422,73 +471,94 @@ services::Status BatchNormalizationKernel<algorithmFPType, method, cpu>::compute
         blocknum_ik = _cd._offsetBefore * blocknum_k;
     }
 
-    /* Compute sums */
-    if( do_threading )
+    const algorithmFPType alpha = (algorithmFPType)( parameter->alpha );
+
+    /* Each block of the target dimension is processed over all 'i' by one thread:
+       moments of the block are accumulated in a single pass and the normalized result
+       is written right after, while the block data are still in cache */
+    auto processBlockK = [ & ]( size_t kbeg, size_t kend )
     {
-        daal::threader_for( blocknum_ik, blocknum_ik, [ & ](int block_ik)
+        for (size_t i = 0; i < _cd._offsetBefore; i++)
         {
-            int block_i = block_ik / blocknum_k;
-            int block_k = block_ik % blocknum_k;
-
-            size_t kbeg  = block_k * blocksize_k;
-            size_t kend  = kbeg + (( block_k == blocknum_k-1)? blocksize_last_k : blocksize_k);
+            _cd.compute_moments( i, kbeg, kend, _cd._mean, _cd._stdev, _cd._count );
+        }
 
-            _cd.compute_sums((size_t)block_i, kbeg, kend);
+        _cd.compute_means_stdevs( kbeg, kend );
+        _cd.compute_population( kbeg, kend, alpha );
 
-        } );
-    }
-    else
-    {
         for (size_t i = 0; i < _cd._offsetBefore; i++)
         {
-            _cd.compute_sums(i, 0, _cd._dimensionSize );
-
+            _cd.compute_gradients( i, kbeg, kend );
         }
-    }
+    };
 
-    /* Calculate target-dimension output vectors (means, stdev...) */
-    if( do_threading && (_cd._dimensionSize >= _MIN_THREAD_SIZE_) )
+    if( !do_threading )
+    {
+        processBlockK( 0, _cd._dimensionSize );
+    }
+    else if( blocknum_k >= threadnum )
     {
         daal::threader_for( blocknum_k, blocknum_k, [ & ]( int block_k )
         {
-            int ksize = ( block_k == (blocknum_k-1) )? blocksize_last_k : blocksize_k;
             size_t kbeg  = block_k * blocksize_k;
-            size_t kend  = kbeg + ksize;
-
-            _cd.compute_means_stdevs( kbeg, kend );
+            size_t kend  = kbeg + (( block_k == (blocknum_k-1) )? blocksize_last_k : blocksize_k);
 
+            processBlockK( kbeg, kend );
         } );
     }
     else
     {
-            _cd.compute_means_stdevs( 0, _cd._dimensionSize );
-    }
+        /* Not enough blocks of the target dimension to load all threads:
+           each thread accumulates partial moments over the (i, k) blocks it processes */
+        const size_t dimensionSize = _cd._dimensionSize;
+        daal::tls<algorithmFPType *> partialMoments( [ = ]()-> algorithmFPType*
+        {
+            algorithmFPType *ptr = (algorithmFPType *)daal_malloc(3 * dimensionSize * sizeof(algorithmFPType));
+            if( ptr )
+            {
+                for (size_t k = 0; k < 3 * dimensionSize; k++)
+                {
+                    ptr[k] = (algorithmFPType)0.0;
+                }
+            }
+            return ptr;
+        } );
 
-    /* Calculate "population" vectors if necessary */
-    if(parameter->predictionStage == false)
-    {
-        algorithmFPType alpha = (algorithmFPType)( parameter->alpha );
+        daal::threader_for( blocknum_ik, blocknum_ik, [ & ](int block_ik)
+        {
+            algorithmFPType *partial = partialMoments.local();
+            if( !partial ) { return; }
 
-       PRAGMA_IVDEP
-       PRAGMA_VECTOR_ALWAYS
-        for ( size_t k = 0; k < _cd._dimensionSize; k++ )
+            int block_i = block_ik / blocknum_k;
+            int block_k = block_ik % blocknum_k;
+
+            size_t kbeg  = block_k * blocksize_k;
+            size_t kend  = kbeg + (( block_k == blocknum_k-1)? blocksize_last_k : blocksize_k);
+
+            _cd.compute_moments( (size_t)block_i, kbeg, kend, partial, partial + dimensionSize, partial + 2 * dimensionSize );
+        } );
+
+        bool isPartialAllocated = true;
+        partialMoments.reduce( [ & ]( algorithmFPType *partial )
         {
-            _cd._popMean[k]     = _cd._inPopMean[k];
-            _cd._popVariance[k] = _cd._inPopVariance[k];
-        }
+            if( !partial ) { isPartialAllocated = false; return; }
+            for (size_t k = 0; k < dimensionSize; k++)
+            {
+                _cd.merge_moments( k, partial[k], partial[dimensionSize + k], partial[2 * dimensionSize + k],
+                                   _cd._mean, _cd._stdev, _cd._count );
+            }
+            daal_free( partial );
+        } );
 
-       PRAGMA_IVDEP
-       PRAGMA_VECTOR_ALWAYS
-        for ( size_t k = 0; k < _cd._dimensionSize; k++ )
+        if( !isPartialAllocated )
         {
-            _cd._popMean[k]     += alpha * _cd._mean[k];
-            _cd._popVariance[k] += alpha * _cd._variance[k];
+            this->_errors->add(daal::services::ErrorMemoryAllocationFailed);
+            DAAL_RETURN_STATUS()
         }
-    }
 
-    /* Final gradient result tensor compute */
-    if( do_threading )
-    {
+        _cd.compute_means_stdevs( 0, dimensionSize );
+        _cd.compute_population( 0, dimensionSize, alpha );
+
         daal::threader_for( blocknum_ik, blocknum_ik, [ & ]( int block_ik )
         {
             int block_i = block_ik / blocknum_k;
@@ -498,16 +568,8 @@ services::Status BatchNormalizationKernel<algorithmFPType, method, cpu>::compute
             size_t kend  = kbeg + (( block_k == (blocknum_k-1) )? blocksize_last_k : blocksize_k);
 
             _cd.compute_gradients( (size_t)block_i, kbeg, kend );
-
         } );
     }
-    else
-    {
-        for (size_t i = 0; i < _cd._offsetBefore; i++)
-        {
-            _cd.compute_gradients( i, 0, _cd._dimensionSize );
-        }
-    }
 
     DAAL_RETURN_STATUS()
 }
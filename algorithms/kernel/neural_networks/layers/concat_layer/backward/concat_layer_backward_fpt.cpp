@@ -66,15 +66,42 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input *input, const
 
     LayerDataPtr resultCollection = LayerDataPtr(new LayerData());
 
-    Collection<size_t> dimsCollection = in->get(layers::backward::inputGradient)->getDimensions();
+    TensorPtr inputGradient = in->get(layers::backward::inputGradient);
+    Collection<size_t> dimsCollection = inputGradient->getDimensions();
 
-    for(size_t i = 0; i < nOutputs; i++)
+    /* Gradients with respect to the inputs are contiguous parts of the input gradient
+       if all dimensions before the concatenation dimension are equal to one */
+    size_t offsetBefore = 1;
+    for(size_t j = 0; j < concatDimension; j++)
+    {
+        offsetBefore *= dimsCollection[j];
+    }
+    size_t offsetAfter = 1;
+    for(size_t j = concatDimension + 1; j < dimsCollection.size(); j++)
     {
-        NumericTablePtr dimsTable = in->get(layers::concat::auxInputDimensions);
+        offsetAfter *= dimsCollection[j];
+    }
 
+    HomogenTensor<algorithmFPType> *inputGradientHomo = dynamic_cast<HomogenTensor<algorithmFPType>*>(inputGradient.get());
+    const bool useViews = (inputGradientHomo != 0 && par->allowInplaceComputation && offsetBefore == 1);
+
+    NumericTablePtr dimsTable = in->get(layers::concat::auxInputDimensions);
+    size_t viewOffset = 0;
+    for(size_t i = 0; i < nOutputs; i++)
+    {
         dimsCollection[concatDimension] = getElem(dimsTable, i);
-        (*resultCollection)[i] = TensorPtr(new internal::MklTensor<algorithmFPType>(
-                                                                                  dimsCollection, Tensor::doAllocate));
+        if (useViews)
+        {
+            SharedPtr<algorithmFPType> inputGradientPtr = inputGradientHomo->getArraySharedPtr();
+            SharedPtr<algorithmFPType> viewPtr(inputGradientPtr, inputGradientPtr.get() + viewOffset);
+            (*resultCollection)[i] = TensorPtr(new HomogenTensor<algorithmFPType>(dimsCollection, viewPtr));
+            viewOffset += dimsCollection[concatDimension] * offsetAfter;
+        }
+        else
+        {
+            (*resultCollection)[i] = TensorPtr(new internal::MklTensor<algorithmFPType>(
+                                                                                      dimsCollection, Tensor::doAllocate));
+        }
     }
     set(layers::backward::resultLayerData, resultCollection);
     return Status();
@@ -62,7 +62,7 @@ Status ConcatKernel<algorithmFPType, method, cpu>::compute(Tensor *inputTensor,
     for (size_t i = 0; i < nOutputs && canUseMklTensor; i++)
     {
         MklTensor<algorithmFPType> *resultMklTensor = dynamic_cast<MklTensor<algorithmFPType>*>(resultTensors[i]);
-        if (!inputMklTensor)
+        if (!resultMklTensor)
         {
             canUseMklTensor = false;
         }
@@ -145,6 +145,13 @@ Status ConcatKernel<algorithmFPType, method, cpu>::compute(Tensor *inputTensor,
             for(int l = 0; l < nOutputs; l++)
             {
                 Tensor *resultTensor = resultTensors[l];
+                const algorithmFPType *inputPart = inputArray + sum * offsetAfter;
+                const size_t blockSize = auxDims[l] * offsetAfter;
+                sum += auxDims[l];
+
+                /* Result that is a view of its part of the input gradient is already computed */
+                HomogenTensor<algorithmFPType> *resultHomogenTensor = dynamic_cast<HomogenTensor<algorithmFPType>*>(resultTensor);
+                if (offsetBefore == 1 && resultHomogenTensor && resultHomogenTensor->getArray() == inputPart) { continue; }
 
                 const Collection<size_t> &resDims = resultTensor->getDimensions();
 
@@ -154,19 +161,11 @@ Status ConcatKernel<algorithmFPType, method, cpu>::compute(Tensor *inputTensor,
                 DAAL_CHECK_BLOCK_STATUS(resultSubtensor);
                 algorithmFPType *resultArray = resultSubtensor.get();
 
-                for(size_t i = 0; i < offsetBefore; i++)
+                daal::threader_for(offsetBefore, offsetBefore, [ = ](int i)
                 {
-                    for(size_t k = 0; k < auxDims[l]; k++)
-                    {
-                        for(size_t j = 0; j < offsetAfter; j++)
-                        {
-                            const size_t outputIndex = (i * auxDims[l] + k) * offsetAfter + j;
-                            const size_t inputIndex = (i * dimsSum + k + sum) * offsetAfter + j;
-                            resultArray[outputIndex] = inputArray[inputIndex];
-                        }
-                    }
-                }
-                sum += auxDims[l];
+                    daal_memcpy_s(resultArray + i * blockSize, blockSize * sizeof(algorithmFPType),
+                                  inputPart + i * dimsSum * offsetAfter, blockSize * sizeof(algorithmFPType));
+                } );
             }
         }
     }
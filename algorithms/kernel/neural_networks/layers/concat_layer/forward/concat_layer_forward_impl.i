@@ -133,26 +133,23 @@ Status ConcatKernel<algorithmFPType, method, cpu>::compute(size_t nInputs, Tenso
 
             const Collection<size_t> &dims = inputTensor->getDimensions();
             const size_t nInputRows = dims[0];
+            const size_t blockSize = dims[concatDimension] * offsetAfter;
+            algorithmFPType *resultPart = resultArray + sum * offsetAfter;
+            sum += dims[concatDimension];
+
+            /* Input that is a view of its part of the result is already in place */
+            HomogenTensor<algorithmFPType> *inputHomogenTensor = dynamic_cast<HomogenTensor<algorithmFPType>*>(inputTensor);
+            if (offsetBefore == 1 && inputHomogenTensor && inputHomogenTensor->getArray() == resultPart) { continue; }
 
             ReadSubtensor<algorithmFPType, cpu, Tensor> inputSubtensor(inputTensor, 0, 0, 0, nInputRows);
             DAAL_CHECK_BLOCK_STATUS(inputSubtensor);
             const algorithmFPType *inputArray = inputSubtensor.get();
 
-            for(size_t i = 0; i < offsetBefore; i++)
+            daal::threader_for(offsetBefore, offsetBefore, [ = ](int i)
             {
-
-                for(size_t k = 0; k < dims[concatDimension]; k++)
-                {
-                    for(size_t j = 0; j < offsetAfter; j++)
-                    {
-                        const size_t inputIndex = (i * dims[concatDimension] + k) * offsetAfter + j;
-                        const size_t outputIndex = (i * dimsSum + k + sum) * offsetAfter + j;
-                        resultArray[outputIndex] = inputArray[inputIndex];
-                    }
-                }
-            }
-
-            sum += dims[concatDimension];
+                daal_memcpy_s(resultPart + i * dimsSum * offsetAfter, blockSize * sizeof(algorithmFPType),
+                              inputArray + i * blockSize, blockSize * sizeof(algorithmFPType));
+            } );
         }
 
     }
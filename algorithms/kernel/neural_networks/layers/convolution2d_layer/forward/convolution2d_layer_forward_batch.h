@@ -25,6 +25,7 @@
 #include "convolution2d_layer_types.h"
 
 #include "service_mkl_tensor.h"
+#include "layers_value_storage.h"
 
 namespace daal
 {
@@ -85,8 +86,8 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
 
     if (!get(layers::forward::value))
     {
-        set(layers::forward::value, TensorPtr(
-                new MklTensor<algorithmFPType>(getValueSize(inDims, parameter, method), Tensor::doAllocate)));
+        set(layers::forward::value, daal::internal::createLayerValueTensor<algorithmFPType, MklTensor>(
+                getValueSize(inDims, parameter, method), static_cast<const layers::Parameter *>(parameter)));
     }
     services::Status s;
     const layers::Parameter *par = static_cast<const layers::Parameter * >(parameter);
@@ -23,6 +23,7 @@
 
 #include "fullyconnected_layer_forward_types.h"
 #include "fullyconnected_layer_types.h"
+#include "layers_value_storage.h"
 
 namespace daal
 {
@@ -75,13 +76,13 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
 {
     const Input *in = static_cast<const Input * >(input);
     services::Status s;
+    const layers::Parameter *par = static_cast<const layers::Parameter * >(parameter);
     if (!get(layers::forward::value))
     {
         const services::Collection<size_t> &valueDims = getValueSize(in->get(layers::forward::data)->getDimensions(), parameter, method);
-        DAAL_ALLOCATE_TENSOR_AND_SET(layers::forward::value, valueDims);
+        set(layers::forward::value, daal::internal::createLayerValueTensor<algorithmFPType, data_management::HomogenTensor>(valueDims, par));
     }
 
-    const layers::Parameter *par = static_cast<const layers::Parameter * >(parameter);
     if(!par->predictionStage)
     {
         if (!get(layers::forward::resultForBackward))
@@ -39,7 +39,8 @@ Parameter::Parameter() : predictionStage(false), propagateGradient(true),
     weightsInitializer(new initializers::uniform::Batch<>()),
     biasesInitializer(new initializers::uniform::Batch<>()),
     weightsAndBiasesInitialized(false),
-    allowInplaceComputation(true)
+    allowInplaceComputation(true),
+    valueStorageType(defaultValueStorage)
 {}
 
 }// namespace interface1
@@ -23,6 +23,7 @@
 #include "service_tensor.h"
 #include "service_numeric_table.h"
 #include "service_mkl_tensor.h"
+#include "service_tuning.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -86,11 +87,17 @@ inline void getFixedDimsIndexes(size_t fDimN, size_t *fDims, const Collection<si
         }                                                                   \
     }
 
+/* Zero minElementsNumInBlock stands for the tuned value of Environment::layersMinElementsInBlock */
 template<CpuType cpu, typename F>
-void computeImpl(Tensor *inputTensor, KernelErrorCollection *errors, const F &processBlock, size_t minElementsNumInBlock = 997)
+void computeImpl(Tensor *inputTensor, KernelErrorCollection *errors, const F &processBlock, size_t minElementsNumInBlock = 0)
 {
     __DAAL_MAKE_TENSOR_THREADSAFE(inputTensor)
 
+    if (!minElementsNumInBlock)
+    {
+        minElementsNumInBlock = services::internal::getTuningParameter<cpu>(Environment::layersMinElementsInBlock);
+    }
+
     const Collection<size_t> &dims = inputTensor->getDimensions();
     TensorOffsetLayout inputLayout = inputTensor->createRawSubtensorLayout();
 
@@ -0,0 +1,57 @@
+/* file: layers_value_storage.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Allocation of the value of the forward layer in the requested storage type
+//--
+*/
+
+#ifndef __LAYERS_VALUE_STORAGE_H__
+#define __LAYERS_VALUE_STORAGE_H__
+
+#include "homogen_tensor.h"
+#include "algorithms/neural_networks/layers/layer_types.h"
+
+namespace daal
+{
+namespace internal
+{
+
+/**
+ * Creates the tensor to store the value of the forward layer.
+ * Kernels access the bfloat16 value through the subtensors of algorithmFPType type,
+ * so the conversion is performed on load and on release of the subtensor
+ * \param[in] dims       Dimensions of the value
+ * \param[in] parameter  Parameter of the layer
+ * \return Tensor of DefaultTensorType<algorithmFPType> type or bfloat16 homogen tensor
+ */
+template<typename algorithmFPType, template<typename> class DefaultTensorType>
+data_management::TensorPtr createLayerValueTensor(const services::Collection<size_t> &dims,
+                                                  const algorithms::neural_networks::layers::Parameter *parameter)
+{
+    if (parameter->valueStorageType == algorithms::neural_networks::layers::bfloat16ValueStorage)
+    {
+        return data_management::TensorPtr(new data_management::HomogenTensor<data_management::bfloat16>(dims, data_management::Tensor::doAllocate));
+    }
+    return data_management::TensorPtr(new DefaultTensorType<algorithmFPType>(dims, data_management::Tensor::doAllocate));
+}
+
+} // namespace internal
+} // namespace daal
+
+#endif
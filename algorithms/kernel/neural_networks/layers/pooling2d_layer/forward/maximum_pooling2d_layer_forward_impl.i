@@ -31,7 +31,7 @@
 #include "service_numeric_table.h"
 #include "service_defines.h"
 #include "threading.h"
-#if defined (__INTEL_COMPILER)
+#if defined(__DAAL_INTRINSICS_SSE2__)
   #include <immintrin.h>
 #endif
 
@@ -72,17 +72,10 @@ struct pooling2d_opt_t
     }
 };
 
-#if defined (__INTEL_COMPILER)
-
-    /* AVX512_ALL common specialization for all CPU from Intel(R) Xeon Phi(TM) processors/coprocessors based on Intel(R) Advanced Vector Extensions 512 and newer */
-    #if __CPUID__(DAAL_CPU) >= __avx512_mic__
-        #define AVX512_ALL DAAL_CPU
-    #else
-        #define AVX512_ALL avx512_mic
-    #endif
+#if defined(__DAAL_INTRINSICS_SSE2__)
 
     /* Emulation of blendv instruction on hardware before sse4.2 */
-    #if __CPUID__(DAAL_CPU) < __sse42__
+    #if (__CPUID__(DAAL_CPU) < __sse42__) || !defined(__DAAL_INTRINSICS_SSE41__)
       # define __mm_blendv_ps( sA, sB, sMask ) _mm_or_ps( _mm_andnot_ps( sMask, sA ), _mm_and_ps( sB, sMask ))
       # define __mm_blendv_pd( dA, dB, dMask ) _mm_or_pd( _mm_andnot_pd( dMask, dA ), _mm_and_pd( dB, dMask ))
     #else
@@ -90,6 +83,15 @@ struct pooling2d_opt_t
       # define __mm_blendv_pd( dA, dB, dMask ) _mm_blendv_pd( dA, dB, dMask )
     #endif
 
+  #if defined(__DAAL_INTRINSICS_AVX512__)
+
+    /* AVX512_ALL common specialization for all CPU from Intel(R) Xeon Phi(TM) processors/coprocessors based on Intel(R) Advanced Vector Extensions 512 and newer */
+    #if __CPUID__(DAAL_CPU) >= __avx512_mic__
+        #define AVX512_ALL DAAL_CPU
+    #else
+        #define AVX512_ALL avx512_mic
+    #endif
+
     template<>
     struct pooling2d_opt_t<float, AVX512_ALL>
     {
@@ -109,7 +111,7 @@ struct pooling2d_opt_t
                     __m512    mamax      = _mm512_max_ps( ma, mmax );
                               mmax       = _mm512_set1_ps( _mm512_reduce_max_ps( mamax ) );
                     __mmask16 idx        = _mm512_cmp_ps_mask( ma, mmax, _CMP_EQ_UQ );
-                              idx        = _mm_tzcnt_32(((unsigned int)idx) | 0xffff0000);
+                              idx        = _tzcnt_u32(((unsigned int)idx) | 0xffff0000);
                               (*pmaxidx) = (idx<16)?(i+idx+offset):(*pmaxidx);
                 }
                 _mm512_mask_storeu_ps( pmax, 0x1, mmax );
@@ -144,7 +146,7 @@ struct pooling2d_opt_t
                     __m512d   mamax      = _mm512_max_pd( ma, mmax );
                               mmax       = _mm512_set1_pd( _mm512_reduce_max_pd( mamax ) );
                     __mmask8  idx        = _mm512_cmp_pd_mask( ma, mmax, _CMP_EQ_UQ );
-                              idx        = _mm_tzcnt_32(((unsigned int)idx) | 0xffffff00);
+                              idx        = _tzcnt_u32(((unsigned int)idx) | 0xffffff00);
                               (*pmaxidx) = (idx<8)?(i+idx+offset):(*pmaxidx);
                 }
                 _mm512_mask_storeu_pd( pmax, 0x1, mmax );
@@ -160,6 +162,8 @@ struct pooling2d_opt_t
         }
     };
 
+  #endif /* defined(__DAAL_INTRINSICS_AVX512__) */
+
     template<CpuType cpu>
     struct pooling2d_opt_t<float, cpu>
     {
@@ -182,9 +186,9 @@ struct pooling2d_opt_t
             {
                 const int one    = 1;
                 const int newidx = offset;
-                __m128i mone     = _mm_loadu_si32( &one );
-                __m128i mnewidx  = _mm_loadu_si32( &newidx );
-                __m128i mmaxidx  = _mm_loadu_si32( pmaxidx );
+                __m128i mone     = _mm_cvtsi32_si128( one );
+                __m128i mnewidx  = _mm_cvtsi32_si128( newidx );
+                __m128i mmaxidx  = _mm_cvtsi32_si128( *pmaxidx );
                 __m128 mmax      = _mm_load_ss( pmax );
 
                 for(int i = 0; i < n; i++)
@@ -198,7 +202,7 @@ struct pooling2d_opt_t
                     mnewidx       = _mm_add_epi32(mnewidx,mone);
                 }
 
-                _mm_store_ss( (float*)(pmaxidx), _mm_castsi128_ps(mmaxidx) );
+                *pmaxidx = _mm_cvtsi128_si32( mmaxidx );
                 _mm_store_ss( pmax, mmax );
             }
         }
@@ -226,9 +230,9 @@ struct pooling2d_opt_t
             {
                 const int one    = 1;
                 const int newidx = offset;
-                __m128i mone     = _mm_loadu_si32( &one );
-                __m128i mnewidx  = _mm_loadu_si32( &newidx );
-                __m128i mmaxidx  = _mm_loadu_si32( pmaxidx );
+                __m128i mone     = _mm_cvtsi32_si128( one );
+                __m128i mnewidx  = _mm_cvtsi32_si128( newidx );
+                __m128i mmaxidx  = _mm_cvtsi32_si128( *pmaxidx );
                 __m128d mmax     = _mm_load_sd( pmax );
 
                 for(int i = 0; i < n; i++)
@@ -242,13 +246,13 @@ struct pooling2d_opt_t
                     mnewidx       = _mm_add_epi32(mnewidx,mone);
                 }
 
-                _mm_store_ss( (float*)(pmaxidx), _mm_castsi128_ps(mmaxidx) );
+                *pmaxidx = _mm_cvtsi128_si32( mmaxidx );
                 _mm_store_sd( pmax, mmax );
             }
         }
     };
 
-#endif /* defined (__INTEL_COMPILER) */
+#endif /* defined(__DAAL_INTRINSICS_SSE2__) */
 
 template<typename algorithmFPType, Method method, CpuType cpu>
 services::Status PoolingKernel<algorithmFPType, method, cpu>::initialize(const services::Collection<size_t>& inDims, const maximum_pooling2d::Parameter *parameter,
@@ -26,6 +26,7 @@
 #include "daal_strings.h"
 
 #include "service_mkl_tensor.h"
+#include "layers_value_storage.h"
 
 namespace daal
 {
@@ -72,8 +73,7 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
 
     if (!get(layers::forward::value))
     {
-        set(layers::forward::value, data_management::TensorPtr(
-                new MklTensor<algorithmFPType>(valueDims, data_management::Tensor::doAllocate)));
+        set(layers::forward::value, daal::internal::createLayerValueTensor<algorithmFPType, MklTensor>(valueDims, algParameter));
     }
     if (!get(layers::forward::resultForBackward))
     {
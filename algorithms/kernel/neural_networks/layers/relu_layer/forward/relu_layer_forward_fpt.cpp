@@ -25,6 +25,7 @@
 #include "relu_layer_types.h"
 #include "service_mkl_tensor.h"
 #include "tensor.h"
+#include "layers_value_storage.h"
 
 namespace daal
 {
@@ -60,7 +61,7 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
     {
         if (!get(layers::forward::value))
         {
-            set(layers::forward::value, TensorPtr(new MklTensor<algorithmFPType>(in->get(layers::forward::data)->getDimensions())));
+            set(layers::forward::value, daal::internal::createLayerValueTensor<algorithmFPType, MklTensor>(in->get(layers::forward::data)->getDimensions(), par));
         }
         if (!get(layers::forward::resultForBackward))
         {
@@ -82,7 +83,7 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
             }
             else
             {
-                set(layers::forward::value, TensorPtr(new MklTensor<algorithmFPType>(in->get(layers::forward::data)->getDimensions())));
+                set(layers::forward::value, daal::internal::createLayerValueTensor<algorithmFPType, MklTensor>(in->get(layers::forward::data)->getDimensions(), par));
             }
         }
     }
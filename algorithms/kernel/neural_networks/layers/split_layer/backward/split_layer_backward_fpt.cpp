@@ -59,10 +59,21 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input *inp
         data_management::TensorPtr valueTable = in->get(inputGradientCollection, 0);
         DAAL_CHECK(valueTable, services::ErrorNullInputNumericTable);
 
+        data_management::HomogenTensor<algorithmFPType> *valueHomo =
+            dynamic_cast<data_management::HomogenTensor<algorithmFPType>*>(valueTable.get());
+
         if (!get(layers::backward::gradient))
         {
-            set(layers::backward::gradient, data_management::TensorPtr(new internal::MklTensor<algorithmFPType>(
-                                                                                        valueTable->getDimensions())));
+            if (valueHomo && param->allowInplaceComputation)
+            {
+                /* Gradients of the other outputs are accumulated in place into the first input gradient */
+                set(layers::backward::gradient, valueTable);
+            }
+            else
+            {
+                set(layers::backward::gradient, data_management::TensorPtr(new internal::MklTensor<algorithmFPType>(
+                                                                                            valueTable->getDimensions())));
+            }
         }
     }
     return services::Status();
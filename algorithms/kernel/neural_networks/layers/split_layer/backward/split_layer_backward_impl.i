@@ -27,6 +27,7 @@
 #include "threading.h"
 
 #include "service_mkl_tensor.h"
+#include "service_error_handling.h"
 
 using namespace daal::services;
 
@@ -106,76 +107,102 @@ Status SplitKernel<algorithmFPType, method, cpu>::compute(Tensor *inputTensors[]
         const Collection<size_t> &dims = inputTensors[0]->getDimensions();
         const size_t nInputRows = dims[0];
 
-        const size_t nBlocks = nInputRows / _nRowsInBlock;
-        const size_t nRowsInLastBlock = nInputRows - nBlocks * _nRowsInBlock;
+        size_t nBlocks = nInputRows / _nRowsInBlock;
+        nBlocks += (nBlocks * _nRowsInBlock != nInputRows);
 
-        for(size_t block = 0; block < nBlocks; block++)
-        {
-            DAAL_CHECK_STATUS(s, processBlockInit(inputTensors[0], block * _nRowsInBlock, _nRowsInBlock, resultTensor));
-        }
-        if(nRowsInLastBlock > 0)
+        /* Result aliases the first input gradient when the layer is computed in place */
+        const bool inPlace = (resultTensor == inputTensors[0]);
+        if (inPlace && nInputs == 1) { return s; }
+
+        __DAAL_MAKE_TENSOR_THREADSAFE(resultTensor)
+        for (size_t i = 0; i < nInputs; i++)
         {
-            DAAL_CHECK_STATUS(s, processBlockInit(inputTensors[0], nBlocks * _nRowsInBlock, nRowsInLastBlock, resultTensor));
+            __DAAL_MAKE_TENSOR_THREADSAFE(inputTensors[i])
         }
 
-        for(int i = 1; i < nInputs; i++)
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [ =, &safeStat ](size_t block)
         {
-            Tensor *inputTensor = inputTensors[i];
+            size_t nRowsToProcess = _nRowsInBlock;
+            if( block == nBlocks - 1 )
+            {
+                nRowsToProcess = nInputRows - block * _nRowsInBlock;
+            }
 
-            for(size_t block = 0; block < nBlocks; block++)
+            if (inPlace)
             {
-                DAAL_CHECK_STATUS(s, processBlock(inputTensor, block * _nRowsInBlock, _nRowsInBlock, resultTensor));
+                safeStat |= processBlockInPlace(inputTensors, nInputs, block * _nRowsInBlock, nRowsToProcess, resultTensor);
             }
-            if(nRowsInLastBlock > 0)
+            else
             {
-                DAAL_CHECK_STATUS(s, processBlock(inputTensor, nBlocks * _nRowsInBlock, nRowsInLastBlock, resultTensor));
+                safeStat |= processBlock(inputTensors, nInputs, block * _nRowsInBlock, nRowsToProcess, resultTensor);
             }
-        }
+        } );
+        DAAL_CHECK_SAFE_STATUS();
     }
     return s;
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
-inline Status SplitKernel<algorithmFPType, method, cpu>::processBlock(Tensor *inputTensor,
+inline Status SplitKernel<algorithmFPType, method, cpu>::processBlock(Tensor *inputTensors[], size_t nInputs,
                                                                     size_t nProcessedRows,
                                                                     size_t nRowsInCurrentBlock,
                                                                     Tensor *resultTensor)
 {
-    ReadSubtensor<algorithmFPType, cpu, Tensor> inputSubtensor(inputTensor, 0, 0, nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(inputSubtensor);
-    const algorithmFPType *inputArray = inputSubtensor.get();
-
-    WriteSubtensor<algorithmFPType, cpu, Tensor> resultSubtensor(resultTensor, 0, 0, nProcessedRows, nRowsInCurrentBlock);
+    WriteOnlySubtensor<algorithmFPType, cpu, Tensor> resultSubtensor(resultTensor, 0, 0, nProcessedRows, nRowsInCurrentBlock);
     DAAL_CHECK_BLOCK_STATUS(resultSubtensor);
     algorithmFPType *resultArray = resultSubtensor.get();
 
-    const size_t nDataElements = inputSubtensor.getSize();
+    ReadSubtensor<algorithmFPType, cpu, Tensor> firstInputSubtensor(inputTensors[0], 0, 0, nProcessedRows, nRowsInCurrentBlock);
+    DAAL_CHECK_BLOCK_STATUS(firstInputSubtensor);
+    const algorithmFPType *firstInputArray = firstInputSubtensor.get();
+
+    const size_t nDataElements = firstInputSubtensor.getSize();
     for(size_t i = 0; i < nDataElements; i++)
     {
-        resultArray[i] += inputArray[i];
+        resultArray[i] = firstInputArray[i];
+    }
+
+    for(size_t l = 1; l < nInputs; l++)
+    {
+        ReadSubtensor<algorithmFPType, cpu, Tensor> inputSubtensor(inputTensors[l], 0, 0, nProcessedRows, nRowsInCurrentBlock);
+        DAAL_CHECK_BLOCK_STATUS(inputSubtensor);
+        const algorithmFPType *inputArray = inputSubtensor.get();
+
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < nDataElements; i++)
+        {
+            resultArray[i] += inputArray[i];
+        }
     }
 
     return Status();
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
-inline Status SplitKernel<algorithmFPType, method, cpu>::processBlockInit(Tensor *inputTensor,
-                                                                        size_t nProcessedRows,
-                                                                        size_t nRowsInCurrentBlock,
-                                                                        Tensor *resultTensor)
+inline Status SplitKernel<algorithmFPType, method, cpu>::processBlockInPlace(Tensor *inputTensors[], size_t nInputs,
+                                                                           size_t nProcessedRows,
+                                                                           size_t nRowsInCurrentBlock,
+                                                                           Tensor *resultTensor)
 {
-    ReadSubtensor<algorithmFPType, cpu, Tensor> inputSubtensor(inputTensor, 0, 0, nProcessedRows, nRowsInCurrentBlock);
-    DAAL_CHECK_BLOCK_STATUS(inputSubtensor);
-    const algorithmFPType *inputArray = inputSubtensor.get();
-
-    WriteOnlySubtensor<algorithmFPType, cpu, Tensor> resultSubtensor(resultTensor, 0, 0, nProcessedRows, nRowsInCurrentBlock);
+    WriteSubtensor<algorithmFPType, cpu, Tensor> resultSubtensor(resultTensor, 0, 0, nProcessedRows, nRowsInCurrentBlock);
     DAAL_CHECK_BLOCK_STATUS(resultSubtensor);
     algorithmFPType *resultArray = resultSubtensor.get();
 
-    const size_t nDataElements = inputSubtensor.getSize();
-    for(size_t i = 0; i < nDataElements; i++)
+    const size_t nDataElements = resultSubtensor.getSize();
+    for(size_t l = 1; l < nInputs; l++)
     {
-        resultArray[i] = inputArray[i];
+        ReadSubtensor<algorithmFPType, cpu, Tensor> inputSubtensor(inputTensors[l], 0, 0, nProcessedRows, nRowsInCurrentBlock);
+        DAAL_CHECK_BLOCK_STATUS(inputSubtensor);
+        const algorithmFPType *inputArray = inputSubtensor.get();
+
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < nDataElements; i++)
+        {
+            resultArray[i] += inputArray[i];
+        }
     }
 
     return Status();
@@ -62,8 +62,10 @@ private:
 
     const size_t _nRowsInBlock = 5000;
 
-    inline Status processBlock(Tensor *inputTensor, size_t nProcessedRows, size_t nRowsInCurrentBlock, Tensor *resultTensor);
-    inline Status processBlockInit(Tensor *inputTensor, size_t nProcessedRows, size_t nRowsInCurrentBlock, Tensor *resultTensor);
+    inline Status processBlock(Tensor *inputTensors[], size_t nInputs, size_t nProcessedRows, size_t nRowsInCurrentBlock,
+                               Tensor *resultTensor);
+    inline Status processBlockInPlace(Tensor *inputTensors[], size_t nInputs, size_t nProcessedRows, size_t nRowsInCurrentBlock,
+                                      Tensor *resultTensor);
 };
 
 } // internal
@@ -23,8 +23,11 @@
 */
 
 #include "neural_networks_training_feedforward.h"
+#include "neural_networks_feedforward.h"
 #include "daal_strings.h"
 #include "services/daal_memory.h"
+#include "neural_networks/layers/dropout/dropout_layer_forward.h"
+#include "neural_networks/layers/batch_normalization/batch_normalization_layer_forward.h"
 
 using namespace daal::services;
 using namespace daal::data_management;
@@ -83,3 +86,124 @@ bool daal::algorithms::neural_networks::internal::LearnableLayerIndices::isValid
 {
     return layerIndices.get();
 }
+
+/* Returns true if the forward computation of the layer gives different results or changes the state of the layer on each call */
+static bool isRepeatable(const forward::LayerIfacePtr &layer)
+{
+    return !(dynamicPointerCast<dropout::forward::Batch<float>,  forward::LayerIface>(layer).get()  ||
+             dynamicPointerCast<dropout::forward::Batch<double>, forward::LayerIface>(layer).get()  ||
+             dynamicPointerCast<batch_normalization::forward::Batch<float>,  forward::LayerIface>(layer).get() ||
+             dynamicPointerCast<batch_normalization::forward::Batch<double>, forward::LayerIface>(layer).get());
+}
+
+daal::algorithms::neural_networks::internal::ActivationCheckpoints::ActivationCheckpoints(
+                ForwardLayers *forwardLayers, const Collection<NextLayers> *nextLayers, size_t checkpointInterval) :
+    nLayers(forwardLayers->size()), interval(checkpointInterval), recomputed(forwardLayers->size())
+{
+    if (!recomputed.get())
+        return;
+
+    for(size_t layerId = 0; layerId < nLayers; layerId++)
+    {
+        recomputed[layerId] = false;
+
+        const size_t iSegment = segmentIndex(layerId);
+        if (layerId + 1 == segmentEnd(iSegment)) { continue; }
+
+        const NextLayers &next = nextLayers->get(layerId);
+        if (next.size() == 0) { continue; }
+
+        bool isConsumedInSegment = true;
+        for(size_t j = 0; j < next.size(); j++)
+        {
+            isConsumedInSegment = isConsumedInSegment && (segmentIndex(next[j]) == iSegment);
+        }
+        if (!isConsumedInSegment) { continue; }
+
+        const forward::LayerIfacePtr layer = forwardLayers->get(layerId);
+        if (!isRepeatable(layer)) { continue; }
+
+        TensorPtr value = layer->getLayerResult()->get(forward::value);
+        if (!value || value->getDataMemoryStatus() != Tensor::internallyAllocated) { continue; }
+
+        bool isShared = false;
+        for(size_t otherId = 0; otherId < nLayers && !isShared; otherId++)
+        {
+            if (otherId == layerId) { continue; }
+            isShared = (forwardLayers->get(otherId)->getLayerResult()->get(forward::value).get() == value.get());
+        }
+        recomputed[layerId] = !isShared;
+    }
+}
+
+daal::algorithms::neural_networks::internal::ActivationCheckpoints::~ActivationCheckpoints()
+{}
+
+size_t daal::algorithms::neural_networks::internal::ActivationCheckpoints::nSegments() const
+{
+    return (nLayers + interval - 1) / interval;
+}
+
+size_t daal::algorithms::neural_networks::internal::ActivationCheckpoints::segmentIndex(size_t layerId) const
+{
+    return layerId / interval;
+}
+
+size_t daal::algorithms::neural_networks::internal::ActivationCheckpoints::segmentBegin(size_t iSegment) const
+{
+    return iSegment * interval;
+}
+
+size_t daal::algorithms::neural_networks::internal::ActivationCheckpoints::segmentEnd(size_t iSegment) const
+{
+    const size_t end = (iSegment + 1) * interval;
+    return (end < nLayers ? end : nLayers);
+}
+
+bool daal::algorithms::neural_networks::internal::ActivationCheckpoints::isRecomputed(size_t layerId) const
+{
+    return recomputed[layerId];
+}
+
+Status daal::algorithms::neural_networks::internal::ActivationCheckpoints::allocate(ForwardLayers *forwardLayers, size_t layerId)
+{
+    if (!recomputed[layerId]) { return Status(); }
+
+    TensorPtr value = forwardLayers->get(layerId)->getLayerResult()->get(forward::value);
+    if (value->getDataMemoryStatus() != Tensor::notAllocated) { return Status(); }
+
+    Status s = value->allocateDataMemory();
+    if (s && value->getDataMemoryStatus() == Tensor::notAllocated)
+    {
+        s.add(ErrorMemoryAllocationFailed);
+    }
+    return s;
+}
+
+Status daal::algorithms::neural_networks::internal::ActivationCheckpoints::release(ForwardLayers *forwardLayers, size_t iSegment)
+{
+    Status s;
+    for(size_t layerId = segmentBegin(iSegment); layerId < segmentEnd(iSegment); layerId++)
+    {
+        if (!recomputed[layerId]) { continue; }
+        s |= forwardLayers->get(layerId)->getLayerResult()->get(forward::value)->freeDataMemory();
+    }
+    return s;
+}
+
+Status daal::algorithms::neural_networks::internal::ActivationCheckpoints::recompute(ForwardLayers *forwardLayers, size_t iSegment)
+{
+    Status s;
+    for(size_t layerId = segmentBegin(iSegment); layerId < segmentEnd(iSegment); layerId++)
+    {
+        if (!recomputed[layerId]) { continue; }
+        DAAL_CHECK_STATUS(s, allocate(forwardLayers, layerId));
+        DAAL_CHECK_STATUS(s, processLayerErrors(layerId, forwardLayers->get(layerId)->computeNoThrow()));
+    }
+    return s;
+}
+
+bool daal::algorithms::neural_networks::internal::ActivationCheckpoints::isValid() const
+{
+    return recomputed.get();
+}
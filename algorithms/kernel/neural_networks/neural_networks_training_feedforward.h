@@ -28,6 +28,7 @@
 #include "algorithms/optimization_solver/objective_function/precomputed_batch.h"
 #include "algorithms/optimization_solver/iterative_solver/iterative_solver_batch.h"
 #include "algorithms/neural_networks/neural_networks_types.h"
+#include "algorithms/neural_networks/layers/layer_types.h"
 #include "service_numeric_table.h"
 
 namespace daal
@@ -47,6 +48,16 @@ public:
     typedef optimization_solver::precomputed::Batch<algorithmFPType> ObjectiveFunction;
     typedef services::SharedPtr<optimization_solver::iterative_solver::Batch>  IterativeSolverPtr;
 
+    /**
+     * Available methods to update the weights and biases
+     */
+    enum UpdateMethod
+    {
+        iterativeSolverUpdate, /* Computation of the iterative solver */
+        sgdMomentumUpdate,     /* Fused in-place update of the stochastic gradient descent with momentum */
+        adagradUpdate          /* Fused in-place update of the adaptive subgradient method */
+    };
+
     Solver();
     ~Solver();
     services::Status updateWeightsAndBiases(
@@ -73,6 +84,9 @@ public:
     }
     size_t getNIterations() const {return _nIterationSolver;}
     size_t getBatchSize() const {return _batchSize;}
+    UpdateMethod getUpdateMethod() const {return _updateMethod;}
+    const optimization_solver::iterative_solver::Parameter *getSolverParameter() const {return solver->parameter;}
+    void setFusedUpdateResult(const data_management::NumericTablePtr &weightsAndBiases);
 protected:
     services::SharedPtr<ObjectiveFunction> precomputed;
     IterativeSolverPtr solver;
@@ -80,6 +94,7 @@ protected:
     services::SharedPtr<data_management::HomogenNumericTable<int> > nIterations;
     size_t _nIterationSolver;
     size_t _batchSize;
+    UpdateMethod _updateMethod;
 };
 
 class LearnableLayerIndices
@@ -98,6 +113,38 @@ protected:
     TArray<size_t, sse2> layerIndices;
 };
 
+/**
+ * Splits the layers of the network into segments of consecutive layers and selects the layers whose
+ * forward results are released after the forward pass through the segment and recomputed before
+ * the backward pass through it. Results of the last layer in the segment, of the layers consumed
+ * outside the segment, of the layers sharing their results with other layers, and of the layers
+ * whose forward computation is not repeatable are kept.
+ */
+class ActivationCheckpoints
+{
+public:
+    ActivationCheckpoints(ForwardLayers *forwardLayers, const services::Collection<layers::NextLayers> *nextLayers,
+                          size_t checkpointInterval);
+    virtual ~ActivationCheckpoints();
+
+    size_t nSegments() const;
+    size_t segmentIndex(size_t layerId) const;
+    size_t segmentBegin(size_t iSegment) const;
+    size_t segmentEnd(size_t iSegment) const;
+
+    bool isRecomputed(size_t layerId) const;
+
+    services::Status allocate(ForwardLayers *forwardLayers, size_t layerId);
+    services::Status release(ForwardLayers *forwardLayers, size_t iSegment);
+    services::Status recompute(ForwardLayers *forwardLayers, size_t iSegment);
+
+    bool isValid() const;
+protected:
+    size_t nLayers;
+    size_t interval;
+    TArray<bool, sse2> recomputed;
+};
+
 }
 }
 }
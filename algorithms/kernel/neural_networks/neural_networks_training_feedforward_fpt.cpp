@@ -24,6 +24,8 @@
 
 #include "neural_networks_training_feedforward.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "algorithms/optimization_solver/sgd/sgd_batch.h"
+#include "algorithms/optimization_solver/adagrad/adagrad_batch.h"
 
 namespace daal
 {
@@ -41,7 +43,8 @@ using namespace daal::algorithms::optimization_solver;
 template<typename algorithmFPType>
 Solver<algorithmFPType>::Solver():
     precomputed(new ObjectiveFunction()),
-    nIterations(new HomogenNumericTable<int>(1, 1, NumericTable::doAllocate, 0))
+    nIterations(new HomogenNumericTable<int>(1, 1, NumericTable::doAllocate, 0)),
+    _updateMethod(iterativeSolverUpdate)
 {}
 
 template<typename algorithmFPType>
@@ -63,6 +66,18 @@ Status Solver<algorithmFPType>::init(const IterativeSolverPtr &_solver)
 
     solver->parameter->optionalResultRequired = true;
 
+    /* One step of these solvers on the precomputed gradient is an element-wise update
+       that the training kernel can apply directly to the weights and biases */
+    _updateMethod = iterativeSolverUpdate;
+    if(dynamic_cast<sgd::Batch<algorithmFPType, sgd::momentum> *>(solver.get()))
+    {
+        _updateMethod = sgdMomentumUpdate;
+    }
+    else if(dynamic_cast<adagrad::Batch<algorithmFPType, adagrad::defaultDense> *>(solver.get()))
+    {
+        _updateMethod = adagradUpdate;
+    }
+
     Status s;
     DAAL_CHECK_STATUS(s, solver->createResult());
     solverResult = solver->getResult();
@@ -94,6 +109,13 @@ NumericTablePtr Solver<algorithmFPType>::getMinimum()
     return solverResult->get(iterative_solver::minimum);
 }
 
+template<typename algorithmFPType>
+void Solver<algorithmFPType>::setFusedUpdateResult(const NumericTablePtr &weightsAndBiases)
+{
+    solverResult->set(iterative_solver::minimum, weightsAndBiases);
+    nIterations->getArray()[0] = 1;
+}
+
 
 template DAAL_EXPORT Solver<DAAL_FPTYPE>::Solver();
 template DAAL_EXPORT Solver<DAAL_FPTYPE>::~Solver();
@@ -101,6 +123,7 @@ template DAAL_EXPORT Status Solver<DAAL_FPTYPE>::updateWeightsAndBiases(
                 const NumericTablePtr &weightsAndBiases,
                 const NumericTablePtr &weightsAndBiasesDerivatives);
 template DAAL_EXPORT NumericTablePtr Solver<DAAL_FPTYPE>::getMinimum();
+template DAAL_EXPORT void Solver<DAAL_FPTYPE>::setFusedUpdateResult(const NumericTablePtr &weightsAndBiases);
 template DAAL_EXPORT Status Solver<DAAL_FPTYPE>::init(const SharedPtr<iterative_solver::Batch> &_solver);
 }
 }
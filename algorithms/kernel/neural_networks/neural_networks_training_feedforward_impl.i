@@ -36,6 +36,9 @@ namespace internal
 {
 using namespace daal::services;
 
+/* Number of weights and biases updated by one thread in the fused update */
+const size_t fusedUpdateBlockSize = 4096;
+
 /**
  *  \brief Kernel for Neural Network training in batch processing mode
  */
@@ -86,6 +89,13 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 Status TrainingKernelBatch<algorithmFPType, method, cpu>::updateWeights(Model& nnModel)
 {
     Status s;
+    bool isUpdated = false;
+    DAAL_NN_CHECK_STATUS(s, updateWeightsFused(nnModel, isUpdated))
+    if (isUpdated)
+    {
+        return s;
+    }
+
     if (oneTableForAllWeights)
     {
         Solver<algorithmFPType> &solver = solvers[0];
@@ -109,6 +119,184 @@ Status TrainingKernelBatch<algorithmFPType, method, cpu>::updateWeights(Model& n
     return s;
 }
 
+/**
+ *  \brief Updates the weights and biases of all solvers in one parallel in-place pass
+ *         without the computation of the iterative solvers.
+ *         Applicable to the stochastic gradient descent with momentum and to the adaptive subgradient method
+ *         once the solvers have their optional results allocated on the first iteration
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status TrainingKernelBatch<algorithmFPType, method, cpu>::updateWeightsFused(Model& nnModel, bool &isUpdated)
+{
+    isUpdated = false;
+    const typename Solver<algorithmFPType>::UpdateMethod updateMethod = solvers[0].getUpdateMethod();
+    if (updateMethod == Solver<algorithmFPType>::iterativeSolverUpdate)
+    {
+        return Status();
+    }
+
+    const size_t nSolvers = solvers.size();
+    TArray<NumericTablePtr, cpu> weightsAndBiases(nSolvers);
+    TArray<NumericTablePtr, cpu> derivatives(nSolvers);
+    TArray<FusedUpdateTask, cpu> tasks(nSolvers);
+    TArray<size_t, cpu> blockOffsets(nSolvers + 1);
+    DAAL_CHECK_MALLOC(weightsAndBiases.get() && derivatives.get() && tasks.get() && blockOffsets.get())
+
+    Status s;
+    blockOffsets[0] = 0;
+    for (size_t j = 0; j < nSolvers; j++)
+    {
+        const size_t layerId = (oneTableForAllWeights ? 0 : learnableLayerIndices->layerIndex(j));
+        weightsAndBiases[j] = (oneTableForAllWeights ? nnModel.getWeightsAndBiases() : nnModel.getWeightsAndBiases(layerId));
+        derivatives[j] = (oneTableForAllWeights ? nnModel.getWeightsAndBiasesDerivatives() : nnModel.getWeightsAndBiasesDerivatives(layerId));
+
+        bool isReady = false;
+        DAAL_CHECK_STATUS(s, initFusedUpdateTask(solvers[j], weightsAndBiases[j], derivatives[j], tasks[j], isReady))
+        if (!isReady)
+        {
+            return s;
+        }
+        const size_t nRows = tasks[j].weightsAndBiases->getNumberOfRows();
+        blockOffsets[j + 1] = blockOffsets[j] + (nRows + fusedUpdateBlockSize - 1) / fusedUpdateBlockSize;
+    }
+
+    /* Blocks of all the weights and biases tables are processed in one parallel loop */
+    const size_t nBlocks = blockOffsets[nSolvers];
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+    {
+        size_t j = 0;
+        while (blockOffsets[j + 1] <= (size_t)iBlock) { j++; }
+
+        const size_t nRows    = tasks[j].weightsAndBiases->getNumberOfRows();
+        const size_t startRow = ((size_t)iBlock - blockOffsets[j]) * fusedUpdateBlockSize;
+        const size_t nRowsInBlock = (startRow + fusedUpdateBlockSize < nRows ? fusedUpdateBlockSize : nRows - startRow);
+        safeStat |= processFusedUpdateBlock(updateMethod, tasks[j], startRow, nRowsInBlock);
+    });
+    DAAL_CHECK_SAFE_STATUS()
+
+    for (size_t j = 0; j < nSolvers; j++)
+    {
+        WriteRows<int, cpu> lastIterationRows(tasks[j].lastIteration, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lastIterationRows);
+        lastIterationRows.get()[0]++;
+
+        solvers[j].setFusedUpdateResult(weightsAndBiases[j]);
+        if (oneTableForAllWeights)
+        {
+            nnModel.setWeightsAndBiases(weightsAndBiases[j]);
+        }
+        else
+        {
+            nnModel.setWeightsAndBiases(learnableLayerIndices->layerIndex(j), weightsAndBiases[j]);
+        }
+    }
+    isUpdated = true;
+    return s;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status TrainingKernelBatch<algorithmFPType, method, cpu>::initFusedUpdateTask(Solver<algorithmFPType> &solver,
+    const NumericTablePtr &weightsAndBiases, const NumericTablePtr &derivatives, FusedUpdateTask &task, bool &isReady)
+{
+    using namespace optimization_solver;
+    isReady = false;
+
+    const bool isMomentum = (solver.getUpdateMethod() == Solver<algorithmFPType>::sgdMomentumUpdate);
+    const size_t stateId = (isMomentum ? (size_t)sgd::pastUpdateVector : (size_t)adagrad::gradientSquareSum);
+
+    /* The optional result of the solver keeps the state of the update between the iterations */
+    algorithms::OptionalArgumentPtr optionalResult = solver.getSolverOptionalResult();
+    if (!optionalResult || optionalResult->size() <= stateId || !weightsAndBiases || !derivatives)
+    {
+        return Status();
+    }
+    NumericTable *state = NumericTable::cast(optionalResult->get(stateId)).get();
+    NumericTable *lastIteration = NumericTable::cast(optionalResult->get(iterative_solver::lastIteration)).get();
+    const size_t nRows = weightsAndBiases->getNumberOfRows();
+    if (!state || !lastIteration || state->getNumberOfRows() != nRows || derivatives->getNumberOfRows() != nRows)
+    {
+        return Status();
+    }
+
+    task.weightsAndBiases = weightsAndBiases.get();
+    task.derivatives      = derivatives.get();
+    task.state            = state;
+    task.lastIteration    = lastIteration;
+    task.momentum         = 0;
+    task.degenerateCasesThreshold = 0;
+
+    if (isMomentum)
+    {
+        const sgd::Parameter<sgd::momentum> *parameter = static_cast<const sgd::Parameter<sgd::momentum> *>(solver.getSolverParameter());
+        NumericTable *learningRateSequence = parameter->learningRateSequence.get();
+        DAAL_CHECK(learningRateSequence, ErrorNullParameterNotSupported)
+
+        ReadRows<int, cpu> lastIterationRows(lastIteration, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lastIterationRows);
+        const size_t learningRateRow = (size_t)lastIterationRows.get()[0] % learningRateSequence->getNumberOfRows();
+
+        ReadRows<algorithmFPType, cpu> learningRateRows(learningRateSequence, learningRateRow, 1);
+        DAAL_CHECK_BLOCK_STATUS(learningRateRows);
+        task.learningRate = learningRateRows.get()[0];
+        task.momentum     = (algorithmFPType)parameter->momentum;
+    }
+    else
+    {
+        const adagrad::Parameter *parameter = static_cast<const adagrad::Parameter *>(solver.getSolverParameter());
+        DAAL_CHECK(parameter->learningRate, ErrorNullParameterNotSupported)
+
+        ReadRows<algorithmFPType, cpu> learningRateRows(parameter->learningRate.get(), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(learningRateRows);
+        task.learningRate = learningRateRows.get()[0];
+        task.degenerateCasesThreshold = (algorithmFPType)parameter->degenerateCasesThreshold;
+    }
+    isReady = true;
+    return Status();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Status TrainingKernelBatch<algorithmFPType, method, cpu>::processFusedUpdateBlock(
+    typename Solver<algorithmFPType>::UpdateMethod updateMethod, const FusedUpdateTask &task, size_t startRow, size_t nRows)
+{
+    WriteRows<algorithmFPType, cpu> weightsRows(task.weightsAndBiases, startRow, nRows);
+    DAAL_CHECK_BLOCK_STATUS(weightsRows);
+    WriteRows<algorithmFPType, cpu> stateRows(task.state, startRow, nRows);
+    DAAL_CHECK_BLOCK_STATUS(stateRows);
+    ReadRows<algorithmFPType, cpu> derivativesRows(task.derivatives, startRow, nRows);
+    DAAL_CHECK_BLOCK_STATUS(derivativesRows);
+
+    algorithmFPType *weights = weightsRows.get();
+    algorithmFPType *state = stateRows.get();
+    const algorithmFPType *gradient = derivativesRows.get();
+    const algorithmFPType learningRate = task.learningRate;
+
+    if (updateMethod == Solver<algorithmFPType>::sgdMomentumUpdate)
+    {
+        const algorithmFPType momentum = task.momentum;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nRows; i++)
+        {
+            state[i] = momentum * state[i] - learningRate * gradient[i];
+            weights[i] += state[i];
+        }
+    }
+    else
+    {
+        const algorithmFPType one(1.0);
+        const algorithmFPType degenerateCasesThreshold = task.degenerateCasesThreshold;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nRows; i++)
+        {
+            state[i] += gradient[i] * gradient[i];
+            weights[i] -= learningRate * gradient[i] * (one / daal::internal::Math<algorithmFPType, cpu>::sSqrt(state[i] + degenerateCasesThreshold));
+        }
+    }
+    return Status();
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 size_t TrainingKernelBatch<algorithmFPType, method, cpu>::getMaxIterations(size_t nSamples, size_t batchSizeParam) const
 {
@@ -273,6 +461,13 @@ Status TrainingKernelBase<algorithmFPType, cpu>::initializeBase(Tensor *data, Mo
 
     nLastLayers = lastLayersIndices->nLast(); /* number of last layers in the network */
 
+    /* Select the layers whose forward results are recomputed during the backward pass */
+    if (parameter->checkpointInterval > 0 && parameter->checkpointInterval < nLayers)
+    {
+        checkpoints.reset(new ActivationCheckpoints(forwardLayers.get(), nnModel->getNextLayers().get(), parameter->checkpointInterval));
+        DAAL_NN_CHECK_MALLOC(checkpoints.get() && checkpoints->isValid())
+    }
+
     /* Create a tensor to pass as an input to the first forward layer in neural network */
     Collection<size_t> sampleSize = data->getDimensions();
     sampleSize[0] = batchSizeParam;
@@ -344,18 +539,25 @@ Status TrainingKernelBase<algorithmFPType, cpu>::computeBase(Tensor *data, Model
             sampleGroundTruth->setArray(const_cast<algorithmFPType *>(groundTruthTensors[j].get()));
         }
 
-        /* Forward pass through the neural network */
-        for(size_t layerId = 0; layerId < nLayers; layerId++)
+        if (checkpoints.get())
         {
-            layers::forward::LayerIfacePtr forwardLayer = forwardLayers->get(layerId);
-            DAAL_NN_CHECK_STATUS(s, processLayerErrors(layerId, forwardLayer->computeNoThrow()))
+            DAAL_NN_CHECK_STATUS(s, computeCheckpointed(forwardLayers.get(), backwardLayers.get()))
         }
-
-        /* Backward pass through the neural network */
-        for(int layerId = nLayers - 1; layerId >= 0; layerId--)
+        else
         {
-            layers::backward::LayerIfacePtr backwardLayer = backwardLayers->get(layerId);
-            DAAL_NN_CHECK_STATUS(s, processLayerErrors(layerId, backwardLayer->computeNoThrow()))
+            /* Forward pass through the neural network */
+            for(size_t layerId = 0; layerId < nLayers; layerId++)
+            {
+                layers::forward::LayerIfacePtr forwardLayer = forwardLayers->get(layerId);
+                DAAL_NN_CHECK_STATUS(s, processLayerErrors(layerId, forwardLayer->computeNoThrow()))
+            }
+
+            /* Backward pass through the neural network */
+            for(int layerId = nLayers - 1; layerId >= 0; layerId--)
+            {
+                layers::backward::LayerIfacePtr backwardLayer = backwardLayers->get(layerId);
+                DAAL_NN_CHECK_STATUS(s, processLayerErrors(layerId, backwardLayer->computeNoThrow()))
+            }
         }
 
         /* Update weights and biases of the network */
@@ -364,10 +566,49 @@ Status TrainingKernelBase<algorithmFPType, cpu>::computeBase(Tensor *data, Model
     return s;
 }
 
+template<typename algorithmFPType, CpuType cpu>
+Status TrainingKernelBase<algorithmFPType, cpu>::computeCheckpointed(ForwardLayers *forwardLayers, BackwardLayers *backwardLayers)
+{
+    Status s;
+    const size_t nSegments = checkpoints->nSegments();
+
+    /* Forward pass through the neural network. Forward results inside the segments are released
+       when they are not needed anymore to compute the rest of the forward pass */
+    for(size_t iSegment = 0; iSegment < nSegments; iSegment++)
+    {
+        for(size_t layerId = checkpoints->segmentBegin(iSegment); layerId < checkpoints->segmentEnd(iSegment); layerId++)
+        {
+            DAAL_CHECK_STATUS(s, checkpoints->allocate(forwardLayers, layerId))
+            DAAL_CHECK_STATUS(s, processLayerErrors(layerId, forwardLayers->get(layerId)->computeNoThrow()))
+        }
+        if (iSegment + 1 < nSegments)
+        {
+            DAAL_CHECK_STATUS(s, checkpoints->release(forwardLayers, iSegment))
+        }
+    }
+
+    /* Backward pass through the neural network. Released forward results of the segment
+       are recomputed from the kept ones before the backward pass through the segment */
+    for(int iSegment = (int)nSegments - 1; iSegment >= 0; iSegment--)
+    {
+        if ((size_t)iSegment + 1 < nSegments)
+        {
+            DAAL_CHECK_STATUS(s, checkpoints->recompute(forwardLayers, iSegment))
+        }
+        for(int layerId = (int)checkpoints->segmentEnd(iSegment) - 1; layerId >= (int)checkpoints->segmentBegin(iSegment); layerId--)
+        {
+            DAAL_CHECK_STATUS(s, processLayerErrors(layerId, backwardLayers->get(layerId)->computeNoThrow()))
+        }
+        DAAL_CHECK_STATUS(s, checkpoints->release(forwardLayers, iSegment))
+    }
+    return s;
+}
+
 template<typename algorithmFPType, CpuType cpu>
 Status TrainingKernelBase<algorithmFPType, cpu>::reset()
 {
     lastLayersIndices.reset();
+    checkpoints.reset();
     sampleGroundTruthCollection.reset(0);
     groundTruthTensors.reset(0);
     sample.reset();
@@ -32,7 +32,12 @@
 #include "optimization_solver/objective_function/precomputed_batch.h"
 #include "optimization_solver/iterative_solver/iterative_solver_batch.h"
 #include "optimization_solver/iterative_solver/iterative_solver_types.h"
+#include "optimization_solver/sgd/sgd_types.h"
+#include "optimization_solver/adagrad/adagrad_types.h"
 #include "service_tensor.h"
+#include "service_math.h"
+#include "service_error_handling.h"
+#include "threading.h"
 #include "neural_networks_feedforward.h"
 #include "neural_networks_training_feedforward.h"
 
@@ -63,6 +68,7 @@ protected:
     services::Status initializeBase(Tensor* data, Model *nnModel, const neural_networks::training::Parameter *parameter,
                         const KeyValueDataCollectionPtr &groundTruthCollectionPtr);
     services::Status computeBase(Tensor *data, Model *model, const KeyValueDataCollectionPtr &groundTruthCollectionPtr);
+    services::Status computeCheckpointed(ForwardLayers *forwardLayers, BackwardLayers *backwardLayers);
     services::Status reset();
     virtual services::Status updateWeights(Model &nnModel) = 0;
     virtual size_t getMaxIterations(size_t nSamples, size_t batchSizeParam) const = 0;
@@ -72,6 +78,7 @@ private:
     size_t nLayers;
     size_t nSamples;
     UniquePtr<LastLayerIndices, cpu> lastLayersIndices;
+    UniquePtr<ActivationCheckpoints, cpu> checkpoints;
     HomogenTensorPtr sample;
     TArray<HomogenTensorPtr, cpu> sampleGroundTruthCollection;
     TArray<ReadSubtensor<algorithmFPType, cpu>, cpu> groundTruthTensors;
@@ -94,6 +101,26 @@ public:
     services::Status compute(Tensor* data, Model* nnModel, const KeyValueDataCollectionPtr &groundTruthCollectionPtr);
     services::Status reset();
 private:
+    /**
+     * Weights and biases updated by one of the solvers in the fused update
+     */
+    struct FusedUpdateTask
+    {
+        NumericTable *weightsAndBiases;
+        NumericTable *derivatives;
+        NumericTable *state;         /* Past update vector or sum of squared gradients */
+        NumericTable *lastIteration;
+        algorithmFPType learningRate;
+        algorithmFPType momentum;
+        algorithmFPType degenerateCasesThreshold;
+    };
+
+    services::Status updateWeightsFused(Model &nnModel, bool &isUpdated);
+    services::Status initFusedUpdateTask(Solver<algorithmFPType> &solver, const NumericTablePtr &weightsAndBiases,
+                                         const NumericTablePtr &derivatives, FusedUpdateTask &task, bool &isReady);
+    services::Status processFusedUpdateBlock(typename Solver<algorithmFPType>::UpdateMethod updateMethod, const FusedUpdateTask &task,
+                                             size_t startRow, size_t nRows);
+
     bool oneTableForAllWeights;
     UniquePtr<LearnableLayerIndices, cpu> learnableLayerIndices;
     TArray<Solver<algorithmFPType>, cpu> solvers;
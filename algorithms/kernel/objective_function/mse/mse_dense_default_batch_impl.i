@@ -39,6 +39,7 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                                                              NumericTable *valueNT, NumericTable *hessianNT, NumericTable *gradientNT, Parameter *parameter)
 {
     const size_t nDataRows = dataNT->getNumberOfRows();
+    const size_t blockSizeDefault = services::internal::getTuningParameter<cpu>(services::Environment::mseBlockSize);
     if(parameter->batchIndices.get() != NULL && parameter->batchIndices->getNumberOfColumns() != nDataRows)
     {
         MSETaskSample<algorithmFPType, cpu> task(dataNT, dependentVariablesNT, argumentNT, valueNT, hessianNT, gradientNT, parameter, blockSizeDefault);
@@ -60,6 +61,7 @@ services::Status MSEKernel<algorithmFPType, method, cpu>::run(MSETask<algorithmF
     DAAL_CHECK_STATUS(s, task.getResultValues(value, gradient, hessian));
     task.setResultValuesToZero(value, gradient, hessian);
 
+    const size_t blockSizeDefault = task.nRowsInBlock;
     size_t blockSize = blockSizeDefault;
     size_t nBlocks = task.batchSize / blockSizeDefault;
     nBlocks += (nBlocks * blockSizeDefault != task.batchSize);
@@ -81,6 +81,7 @@ struct MSETask
     size_t argumentSize;
     size_t nTheta;
     size_t batchSize;
+    size_t nRowsInBlock;
     TArray<algorithmFPType, cpu> xMultTheta;
 };
 
@@ -112,6 +113,7 @@ struct MSETaskAll : public MSETask<algorithmFPType, cpu>
     using super::argumentSize;
     using super::nTheta;
     using super::batchSize;
+    using super::nRowsInBlock;
     using super::xMultTheta;
 
     MSETaskAll(NumericTable *data, NumericTable *dependentVariables, NumericTable *argument, NumericTable *value, NumericTable *hessian, NumericTable *gradient,
@@ -154,6 +156,7 @@ struct MSETaskSample : public MSETask<algorithmFPType, cpu>
     using super::argumentSize;
     using super::nTheta;
     using super::batchSize;
+    using super::nRowsInBlock;
     using super::xMultTheta;
 
     MSETaskSample(NumericTable *data, NumericTable *dependentVariables, NumericTable *argument,
@@ -23,6 +23,7 @@
 
 #include "mse_dense_default_batch_kernel.h"
 #include "service_blas.h"
+#include "service_tuning.h"
 
 namespace daal
 {
@@ -38,7 +39,6 @@ namespace internal
 using namespace daal::data_management;
 using namespace daal::internal;
 using namespace daal::services;
-static const size_t blockSizeDefault = 512;
 
 template<typename algorithmFPType, CpuType cpu>
 MSETask<algorithmFPType, cpu>::MSETask(NumericTable *data, NumericTable *dependentVariables, NumericTable *argument,
@@ -147,6 +147,7 @@ MSETaskAll<algorithmFPType, cpu>::MSETaskAll(NumericTable *data, NumericTable *d
     super(data, dependentVariables, argument, value, hessian, gradient, parameter)
 {
     batchSize = ntData->getNumberOfRows();
+    nRowsInBlock = blockSizeDefault;
     xMultTheta.reset(batchSize < blockSizeDefault ? batchSize : blockSizeDefault);
 }
 
@@ -194,6 +195,7 @@ MSETaskSample<algorithmFPType, cpu>::MSETaskSample(NumericTable *data, NumericTa
     ntIndices(parameter->batchIndices.get())
 {
     batchSize = parameter->batchIndices->getNumberOfColumns();
+    nRowsInBlock = blockSizeDefault;
 }
 
 template<typename algorithmFPType, CpuType cpu>
@@ -205,7 +207,7 @@ Status MSETaskSample<algorithmFPType, cpu>::init(algorithmFPType *&pArgumentArra
     if(!s)
         return s;
     indicesArray = indicesBlock.getBlockPtr();
-    const size_t allocationSize = (batchSize < blockSizeDefault ? batchSize : blockSizeDefault);
+    const size_t allocationSize = (batchSize < nRowsInBlock ? batchSize : nRowsInBlock);
 
     if(nTheta > 0)
     {
@@ -88,7 +88,10 @@ services::Status AdagradKernel<algorithmFPType, method, cpu>::compute(NumericTab
         ReadRows<algorithmFPType, cpu> startValueBD(*inputArgument, 0, nRows);
         DAAL_CHECK_BLOCK_STATUS(startValueBD);
         const algorithmFPType *startValueArray = startValueBD.get();
-        daal_memcpy_s(workValue, nRows * sizeof(algorithmFPType), startValueArray, nRows * sizeof(algorithmFPType));
+        if(workValue != startValueArray)
+        {
+            daal_memcpy_s(workValue, nRows * sizeof(algorithmFPType), startValueArray, nRows * sizeof(algorithmFPType));
+        }
     }
 
     const size_t nIter = parameter->nIterations;
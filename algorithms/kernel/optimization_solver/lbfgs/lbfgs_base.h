@@ -211,6 +211,10 @@ private:
     algorithmFPType *correctionY;            /*!< Array of correction pairs parts y(1), ..., y(m). See formula (2.2) in [1] */
     algorithmFPType *rho;                    /*!< Array of parameters rho of BFGS update. See formula (7.17) in [2] */
     algorithmFPType *alpha;                  /*!< Intermediate values used in two-loop recursion. See algorithm 7.4 in [2] */
+    algorithmFPType *correctionDots;         /*!< Matrix of dot products of the vectors s(1), ..., s(m), y(1), ..., y(m) */
+    algorithmFPType *gradientDots;           /*!< Dot products of the vectors s(1), ..., s(m), y(1), ..., y(m) with the gradient */
+    algorithmFPType *recursionCoefficients;  /*!< Coefficients of the vectors s(j), y(j) in the result of two-loop recursion */
+    const size_t nCorrectionPairs;           /*!< Number of correction pairs m */
     const size_t nStepLength;                /*!< Number of values in the provided step-length sequence */
     const algorithmFPType *stepLength;       /*!< Array that stores step-length sequence */
     RNGs _rng;                               /*!< Random number generator */
@@ -26,6 +26,7 @@
 
 #include "service_blas.h"
 #include "service_rng.h"
+#include "iterative_solver_kernel.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -55,6 +56,20 @@ bool getOptionalInputData(NumericTable* pCorrectionIndexInput, size_t& lastCorre
 
 static size_t mod(size_t a, size_t m) { return (a - (a / m) * m); }
 
+/* Number of argument elements processed by one thread in the vector operations of LBFGS */
+const size_t vectorBlockSize = 1024;
+
+/* Number of argument elements starting from which the vector operations of LBFGS are threaded */
+const size_t vectorThreadingThreshold = 8192;
+
+/* Calls processBlock(startOffset, nElementsInBlock) for the blocks of a vector of size n,
+   in parallel if the vector is large enough */
+template<CpuType cpu, typename F>
+void processVectorByBlocks(size_t n, const F &processBlock)
+{
+    iterative_solver::internal::processByBlocks<cpu>(n, processBlock, vectorBlockSize, vectorThreadingThreshold);
+}
+
 /**
  * \brief Kernel for LBFGS calculation
  */
@@ -127,10 +142,17 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(Numeri
     {
         for(; epoch < (t + 1) * L; ++epoch, ++curIteration)
         {
-            for (size_t j = 0; j < task.argumentSize; j++)
+            processVectorByBlocks<cpu>(task.argumentSize, [=](size_t startOffset, size_t nInBlock)
             {
-                argumentLCur[j] += argument[j];
-            }
+                algorithmFPType *argumentLCurBlock = argumentLCur + startOffset;
+                const algorithmFPType *argumentBlock = argument + startOffset;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nInBlock; j++)
+                {
+                    argumentLCurBlock[j] += argumentBlock[j];
+                }
+            });
 
             bool bContinue = true;
             DAAL_CHECK_STATUS(s, task.updateArgument(curIteration, t, epoch, m, correctionIndex, nTerms, batchSize,
@@ -142,10 +164,16 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(Numeri
             }
         }
 
-        for (size_t j = 0; j < task.argumentSize; j++)
+        processVectorByBlocks<cpu>(task.argumentSize, [=](size_t startOffset, size_t nInBlock)
         {
-            argumentLCur[j] *= invL;
-        }
+            algorithmFPType *argumentLCurBlock = argumentLCur + startOffset;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nInBlock; j++)
+            {
+                argumentLCurBlock[j] *= invL;
+            }
+        });
 
         t++;
         if (t >= 2)
@@ -167,11 +195,18 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(Numeri
             ntHessian = hessianFunction->getResult()->get(objective_function::hessianIdx);
             DAAL_CHECK_STATUS(s, task.computeCorrectionPair(correctionIndex, ntHessian.get()));
         }
-        for (size_t j = 0; j < task.argumentSize; j++)
+        processVectorByBlocks<cpu>(task.argumentSize, [=](size_t startOffset, size_t nInBlock)
         {
-            argumentLPrev[j] = argumentLCur[j];
-            argumentLCur[j] = 0.0;
-        }
+            algorithmFPType *argumentLCurBlock  = argumentLCur + startOffset;
+            algorithmFPType *argumentLPrevBlock = argumentLPrev + startOffset;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nInBlock; j++)
+            {
+                argumentLPrevBlock[j] = argumentLCurBlock[j];
+                argumentLCurBlock[j] = 0.0;
+            }
+        });
     }
 
     for(; epoch < maxEpoch; ++epoch, ++curIteration)
@@ -189,7 +224,7 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(Numeri
 }
 
 /**
- * Computes the dot product of two vectors
+ * Computes the dot product of two vectors sequentially
  *
  * \param[in] n     Number of elements in each input vector
  * \param[in] x     Array that contains elements of the first input vector
@@ -197,9 +232,10 @@ services::Status LBFGSKernel<algorithmFPType, defaultDense, cpu>::compute(Numeri
  * \return Resulting dot product
  */
 template<typename algorithmFPType, CpuType cpu>
-algorithmFPType dotProduct(size_t n, const algorithmFPType *x, const algorithmFPType *y)
+algorithmFPType dotProductBlock(size_t n, const algorithmFPType *x, const algorithmFPType *y)
 {
     algorithmFPType dot = 0.0;
+    PRAGMA_VECTOR_ALWAYS
     for (size_t i = 0; i < n; i++)
     {
         dot += x[i] * y[i];
@@ -207,6 +243,45 @@ algorithmFPType dotProduct(size_t n, const algorithmFPType *x, const algorithmFP
     return dot;
 }
 
+/**
+ * Computes the dot product of two vectors.
+ * Partial dot products of the blocks are computed in parallel and summed up in the order of the blocks,
+ * so the result does not depend on the number of threads
+ *
+ * \param[in] n     Number of elements in each input vector
+ * \param[in] x     Array that contains elements of the first input vector
+ * \param[in] y     Array that contains elements of the second input vector
+ * \return Resulting dot product
+ */
+template<typename algorithmFPType, CpuType cpu>
+algorithmFPType dotProduct(size_t n, const algorithmFPType *x, const algorithmFPType *y)
+{
+    if (n < vectorThreadingThreshold)
+    {
+        return dotProductBlock<algorithmFPType, cpu>(n, x, y);
+    }
+
+    const size_t nBlocks = n / vectorBlockSize + (n % vectorBlockSize != 0);
+    TArray<algorithmFPType, cpu> partialDotsArray(nBlocks);
+    algorithmFPType *partialDots = partialDotsArray.get();
+    if (!partialDots)
+    {
+        return dotProductBlock<algorithmFPType, cpu>(n, x, y);
+    }
+
+    processVectorByBlocks<cpu>(n, [=](size_t startOffset, size_t nInBlock)
+    {
+        partialDots[startOffset / vectorBlockSize] = dotProductBlock<algorithmFPType, cpu>(nInBlock, x + startOffset, y + startOffset);
+    });
+
+    algorithmFPType dot = 0.0;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        dot += partialDots[i];
+    }
+    return dot;
+}
+
 /**
  * Updates argument of the objective function
  *
@@ -267,10 +342,17 @@ Status LBFGSTask<algorithmFPType, cpu>::updateArgument(size_t iIteration,
     }
 
     /* Update argument */
-    for (size_t j = 0; j < this->argumentSize; j++)
+    processVectorByBlocks<cpu>(this->argumentSize, [=](size_t startOffset, size_t nInBlock)
     {
-        argument[j] -= stepLengthVal * gradient[j];
-    }
+        algorithmFPType *argumentBlock = argument + startOffset;
+        const algorithmFPType *gradientBlock = gradient + startOffset;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nInBlock; j++)
+        {
+            argumentBlock[j] -= stepLengthVal * gradientBlock[j];
+        }
+    });
     mtGradient.release();
     return s;
 }
@@ -320,6 +402,11 @@ Status LBFGSTask<algorithmFPType, cpu>::updateBatchIndices(size_t iPredefinedInd
  *
  * See Algorithm 7.4 in [2].
  *
+ * The result of the recursion is the gradient plus a linear combination of the vectors s(j), y(j).
+ * The recursion is performed over the coefficients of this combination using the dot products
+ * of the correction vectors with each other and with the gradient, so the only operations
+ * on the vectors of argument size are two matrix-vector products with the buffer of correction pairs.
+ *
  * \param[in]  m               Number of correction pairs
  * \param[in]  correctionIndex Index of starting correction pair in a cyclic buffer
  * \param[in,out] gradient     On input:  Gradient vector.
@@ -328,35 +415,51 @@ Status LBFGSTask<algorithmFPType, cpu>::updateBatchIndices(size_t iPredefinedInd
 template<typename algorithmFPType, CpuType cpu>
 void LBFGSTask<algorithmFPType, cpu>::twoLoopRecursion(size_t m, size_t correctionIndex, algorithmFPType *gradient)
 {
-    size_t index = 0;
+    const size_t nVectors = 2 * m;
+    char trans = 'T';
+    algorithmFPType zero = 0.0;
+    algorithmFPType one = 1.0;
+    DAAL_INT n = (DAAL_INT)(this->argumentSize);
+    DAAL_INT nv = (DAAL_INT)nVectors;
+    DAAL_INT ione = 1;
+
+    /* Compute dot products of s(j), y(j) with the gradient */
+    Blas<algorithmFPType, cpu>::xgemv(&trans, &n, &nv, &one, correctionS, &n, gradient, &ione, &zero, gradientDots, &ione);
 
+    daal::services::internal::service_memset<algorithmFPType, cpu>(recursionCoefficients, 0, nVectors);
+
+    size_t index = 0;
     for (size_t k = 0; k < m; k++)
     {
         index = mod(correctionIndex + m - 1 - k, m);
-        const algorithmFPType *correctionSPtr = correctionS + index * this->argumentSize;
-        const algorithmFPType *correctionYPtr = correctionY + index * this->argumentSize;
+        const algorithmFPType *sDots = correctionDots + index * nVectors;
 
-        alpha[index] = rho[index] * dotProduct<algorithmFPType, cpu>(this->argumentSize, correctionSPtr, gradient);
-
-        for(size_t j = 0; j < this->argumentSize; j++)
+        algorithmFPType dot = gradientDots[index];
+        for (size_t j = 0; j < nVectors; j++)
         {
-            gradient[j] -= alpha[index] * correctionYPtr[j];
+            dot += recursionCoefficients[j] * sDots[j];
         }
+        alpha[index] = rho[index] * dot;
+        recursionCoefficients[m + index] -= alpha[index];
     }
 
     for (size_t k = 0; k < m; k++)
     {
         index = mod(correctionIndex + k, m);
-        const algorithmFPType *correctionSPtr = correctionS + index * this->argumentSize;
-        const algorithmFPType *correctionYPtr = correctionY + index * this->argumentSize;
-
-        algorithmFPType beta = rho[index] * dotProduct<algorithmFPType, cpu>(this->argumentSize, correctionYPtr, gradient);
+        const algorithmFPType *yDots = correctionDots + (m + index) * nVectors;
 
-        for(size_t j = 0; j < this->argumentSize; j++)
+        algorithmFPType dot = gradientDots[m + index];
+        for (size_t j = 0; j < nVectors; j++)
         {
-            gradient[j] += correctionSPtr[j] * (alpha[index] - beta);
+            dot += recursionCoefficients[j] * yDots[j];
         }
+        algorithmFPType beta = rho[index] * dot;
+        recursionCoefficients[index] += alpha[index] - beta;
     }
+
+    /* Add the linear combination of s(j), y(j) to the gradient */
+    trans = 'N';
+    Blas<algorithmFPType, cpu>::xgemv(&trans, &n, &nv, &one, correctionS, &n, recursionCoefficients, &ione, &one, gradient, &ione);
 }
 
 /**
@@ -386,10 +489,20 @@ template<typename algorithmFPType, CpuType cpu>
 void LBFGSTask<algorithmFPType, cpu>::computeCorrectionPairImpl(size_t correctionIndex, const algorithmFPType *hessian)
 {
     algorithmFPType* s = correctionS + correctionIndex * this->argumentSize;
-    for(size_t j = 0; j < this->argumentSize; j++)
+    const algorithmFPType *argumentLCurPtr  = argumentLCur;
+    const algorithmFPType *argumentLPrevPtr = argumentLPrev;
+    processVectorByBlocks<cpu>(this->argumentSize, [=](size_t startOffset, size_t nInBlock)
     {
-        s[j] = argumentLCur[j] - argumentLPrev[j];
-    }
+        algorithmFPType *sBlock = s + startOffset;
+        const algorithmFPType *argumentLCurBlock  = argumentLCurPtr + startOffset;
+        const algorithmFPType *argumentLPrevBlock = argumentLPrevPtr + startOffset;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nInBlock; j++)
+        {
+            sBlock[j] = argumentLCurBlock[j] - argumentLPrevBlock[j];
+        }
+    });
 
     algorithmFPType* y = correctionY + correctionIndex * this->argumentSize;
     char trans = 'N';
@@ -399,7 +512,22 @@ void LBFGSTask<algorithmFPType, cpu>::computeCorrectionPairImpl(size_t correctio
     DAAL_INT ione = 1;
     Blas<algorithmFPType, cpu>::xgemv(&trans, &n, &n, &one, const_cast<algorithmFPType*>(hessian), &n, s, &ione, &zero, y, &ione);
 
-    rho[correctionIndex] = dotProduct<algorithmFPType, cpu>(this->argumentSize, s, y);
+    /* Update the dot products of the new pair with all correction vectors */
+    const size_t m = nCorrectionPairs;
+    const size_t nVectors = 2 * m;
+    DAAL_INT nv = (DAAL_INT)nVectors;
+    algorithmFPType *sDots = correctionDots + correctionIndex * nVectors;
+    algorithmFPType *yDots = correctionDots + (m + correctionIndex) * nVectors;
+    trans = 'T';
+    Blas<algorithmFPType, cpu>::xgemv(&trans, &n, &nv, &one, correctionS, &n, s, &ione, &zero, sDots, &ione);
+    Blas<algorithmFPType, cpu>::xgemv(&trans, &n, &nv, &one, correctionS, &n, y, &ione, &zero, yDots, &ione);
+    for (size_t j = 0; j < nVectors; j++)
+    {
+        correctionDots[j * nVectors + correctionIndex] = sDots[j];
+        correctionDots[j * nVectors + m + correctionIndex] = yDots[j];
+    }
+
+    rho[correctionIndex] = sDots[m + correctionIndex];
     if(rho[correctionIndex] != 0.0) // threshold
     {
         rho[correctionIndex] = 1.0 / rho[correctionIndex];
@@ -463,13 +591,14 @@ Status LBFGSTaskBase<algorithmFPType, cpu>::setToResult(NumericTable *correction
 template<typename algorithmFPType, CpuType cpu>
 LBFGSTask<algorithmFPType, cpu>::LBFGSTask(const Parameter *parameter, NumericTable *minimum) :
     super(minimum),
-    mtBatchIndices(parameter->batchIndices.get()), mtCorrectionPairBatchIndices(parameter->correctionPairBatchIndices.get()),
-    mtStepLength(parameter->stepLengthSequence.get(), 0, 1), correctionPairs(nullptr),
-    correctionS(NULL), correctionY(NULL),
-    batchIndices(NULL), batchIndicesStatus(all),
-    correctionPairBatchIndices(NULL), correctionPairBatchIndicesStatus(all),
+    batchIndicesStatus(all), correctionPairBatchIndicesStatus(all),
+    batchIndices(NULL), correctionPairBatchIndices(NULL),
+    mtCorrectionPairBatchIndices(parameter->correctionPairBatchIndices.get()),
+    mtStepLength(parameter->stepLengthSequence.get(), 0, 1), mtBatchIndices(parameter->batchIndices.get()), correctionPairs(nullptr),
+    correctionS(NULL), correctionY(NULL), correctionDots(NULL), gradientDots(NULL), recursionCoefficients(NULL),
+    nCorrectionPairs(parameter->m),
     nStepLength(parameter->stepLengthSequence->getNumberOfColumns()),
-    _baseGen(parameter->seed), _rng(), _rngStateChanged(false), _rngStateRequired(false)
+    _rng(), _baseGen(parameter->seed), _rngStateChanged(false), _rngStateRequired(false)
 {
 }
 
@@ -530,6 +659,7 @@ LBFGSTask<algorithmFPType, cpu>::~LBFGSTask()
     if(argumentLPrev && !argumentLPrevRows.get()) { daal_free(argumentLPrev); }
     if (rho)           { daal_free(rho);           }
     if (alpha)         { daal_free(alpha);         }
+    if (correctionDots) { daal_free(correctionDots); }
     if(correctionPairs)
     {
         correctionPairs->releaseBlockOfRows(correctionPairsBD);
@@ -537,7 +667,6 @@ LBFGSTask<algorithmFPType, cpu>::~LBFGSTask()
     else
     {
         if(correctionS)   { daal_free(correctionS); }
-        if(correctionY)   { daal_free(correctionY); }
     }
     if (stepLength)    { mtStepLength.release();   }
     releaseBatchIndices(batchIndices, batchIndicesStatus);
@@ -619,11 +748,19 @@ Status LBFGSTask<algorithmFPType, cpu>::initCorrectionPairs(NumericTable* correc
     }
     else
     {
-        correctionS = (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(cCorrectionPairSize);
-        correctionY = (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(cCorrectionPairSize);
+        /* Vectors s(j) and y(j) are stored in one buffer, so that they form a single matrix */
+        correctionS = (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(2 * cCorrectionPairSize);
+        if(correctionS)
+            correctionY = correctionS + cCorrectionPairSize; /* second half */
     }
     rho = (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(parameter->m);
-    DAAL_CHECK_MALLOC(correctionS && correctionY && rho);
+
+    /* Dot products of the correction vectors with each other, with the gradient and coefficients of the two-loop recursion */
+    const size_t nVectors = 2 * parameter->m;
+    correctionDots = (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(nVectors * nVectors + 2 * nVectors);
+    DAAL_CHECK_MALLOC(correctionS && correctionY && rho && correctionDots);
+    gradientDots = correctionDots + nVectors * nVectors;
+    recursionCoefficients = gradientDots + nVectors;
 
     /* If input correction pairs are given ... */
     if(correctionPairsInput)
@@ -637,12 +774,19 @@ Status LBFGSTask<algorithmFPType, cpu>::initCorrectionPairs(NumericTable* correc
             daal_memcpy_s(correctionS, cMemSize, correctionPairsInputBD.get(), cMemSize);
             daal_memcpy_s(correctionY, cMemSize, correctionPairsInputBD.get() + cMemSize, cMemSize);
         }
+        /* initialize dot products of the correction vectors */
+        char transa = 'T';
+        char transb = 'N';
+        algorithmFPType zero = 0.0;
+        algorithmFPType one = 1.0;
+        DAAL_INT n = (DAAL_INT)(this->argumentSize);
+        DAAL_INT nv = (DAAL_INT)nVectors;
+        Blas<algorithmFPType, cpu>::xgemm(&transa, &transb, &nv, &nv, &n, &one, correctionS, &n, correctionS, &n, &zero, correctionDots, &nv);
+
         /* initialize rho form S and Y */
         for(auto i = 0; i < parameter->m; ++i)
         {
-            auto s = correctionS + i*this->argumentSize;
-            auto y = correctionY + i*this->argumentSize;
-            rho[i] = dotProduct<algorithmFPType, cpu>(this->argumentSize, s, y);
+            rho[i] = correctionDots[i * nVectors + parameter->m + i];
             if(rho[i] != 0.0) // threshold
             {
                 rho[i] = 1.0 / rho[i];
@@ -24,6 +24,8 @@
 #ifndef __UNIVAR_OUTLIERDETECTION_DENSE_DEFAULT_IMPL_I__
 #define __UNIVAR_OUTLIERDETECTION_DENSE_DEFAULT_IMPL_I__
 
+#include "service_selection.h"
+
 namespace daal
 {
 namespace algorithms
@@ -55,7 +57,9 @@ compute(NumericTable &dataTable, NumericTable &resultTable,
 
     if(!locationTable || !scatterTable || !thresholdTable)
     {
-        defaultInitialization(locationArray, scatterArray, thresholdArray, nFeatures);
+        Status s = defaultInitialization(dataTable, locationArray, scatterArray, thresholdArray,
+                                         !locationTable, !scatterTable, !thresholdTable);
+        if(!s) { return s; }
     }
 
     /* Allocate memory for storing intermediate results */
@@ -72,19 +76,63 @@ compute(NumericTable &dataTable, NumericTable &resultTable,
     return Status();
 }
 
+/**
+ *  Initializes the parameters that are not provided. The defaultDense method uses location 0 and scatter 1.
+ *  The medianDense method uses the median as the location and the median absolute deviation from the location
+ *  scaled to be a consistent estimate of the standard deviation as the scatter. Threshold is 3
+ */
 template <typename algorithmFPType, Method method, CpuType cpu>
-void OutlierDetectionKernel<algorithmFPType, method, cpu>::defaultInitialization(
+Status OutlierDetectionKernel<algorithmFPType, method, cpu>::defaultInitialization(
+    NumericTable &dataTable,
     algorithmFPType *locationArray,
     algorithmFPType *scatterArray,
     algorithmFPType *thresholdArray,
-    const size_t nFeatures)
+    bool initLocation, bool initScatter, bool initThreshold)
 {
-    for(size_t i = 0; i < nFeatures; i++)
+    const size_t nFeatures = dataTable.getNumberOfColumns();
+    const size_t nVectors = dataTable.getNumberOfRows();
+
+    Status s;
+    if(method == medianDense && (initLocation || initScatter))
+    {
+        const algorithmFPType half = 0.5;
+        daal::algorithms::internal::ExactQuantiles<algorithmFPType, cpu> median;
+        s = median.init(nVectors, 1, &half);
+
+        if(s && initLocation)
+        {
+            s = median.compute(dataTable, locationArray);
+        }
+        if(s && initScatter)
+        {
+            /* 1 / Phi^{-1}(3/4), Phi is the standard normal distribution function */
+            const algorithmFPType madScale = 1.482602218505602;
+            s = median.compute(dataTable, scatterArray, locationArray);
+            if(s)
+            {
+                for(size_t i = 0; i < nFeatures; i++)
+                {
+                    scatterArray[i] *= madScale;
+                }
+            }
+        }
+    }
+    else
+    {
+        for(size_t i = 0; i < nFeatures; i++)
+        {
+            if(initLocation) { locationArray[i] = 0.0; }
+            if(initScatter)  { scatterArray[i]  = 1.0; }
+        }
+    }
+    if(initThreshold)
     {
-        locationArray[i]  = 0.0;
-        scatterArray[i]   = 1.0;
-        thresholdArray[i] = 3.0;
+        for(size_t i = 0; i < nFeatures; i++)
+        {
+            thresholdArray[i] = 3.0;
+        }
     }
+    return s;
 }
 
 } // namespace internal
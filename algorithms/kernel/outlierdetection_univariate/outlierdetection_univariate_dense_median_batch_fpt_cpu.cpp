@@ -0,0 +1,51 @@
+/* file: outlierdetection_univariate_dense_median_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of outliers detection algorithm with median-based initialization.
+//--
+*/
+
+#include "outlierdetection_univariate_batch_container.h"
+#include "outlierdetection_univariate_kernel.h"
+#include "outlierdetection_univariate_dense_default_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace univariate_outlier_detection
+{
+namespace interface1
+{
+
+template class BatchContainer<DAAL_FPTYPE, medianDense, DAAL_CPU>;
+
+}
+namespace internal
+{
+
+template class OutlierDetectionKernel<DAAL_FPTYPE, medianDense, DAAL_CPU>;
+
+} // namespace internal
+
+} // namespace univariate_outlier_detection
+
+} // namespace algorithms
+
+} // namespace daal
@@ -126,10 +126,11 @@ struct OutlierDetectionKernel : public Kernel
                    NumericTable *scatterTable,
                    NumericTable *thresholdTable);
 
-    void defaultInitialization(algorithmFPType *location,
-                               algorithmFPType *scatter,
-                               algorithmFPType *threshold,
-                               const size_t nFeatures);
+    Status defaultInitialization(NumericTable &dataTable,
+                                 algorithmFPType *location,
+                                 algorithmFPType *scatter,
+                                 algorithmFPType *threshold,
+                                 bool initLocation, bool initScatter, bool initThreshold);
 };
 
 } // namespace internal
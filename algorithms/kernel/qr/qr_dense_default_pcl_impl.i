@@ -31,6 +31,22 @@
   #undef  __LZCNT__
   #define __LZCNT__ _lzcnt_u32
 
+#elif defined(__GNUC__)
+
+ /*
+  * Count the number of leading zero bits in unsigned 32-bit integer.
+  * \param[in] a    Input 32-bit integer
+  * \result Number of leading zero bits in a
+  */
+
+  static inline unsigned int __lzcnt_u32__ (unsigned int a)
+  {
+      return (a ? (unsigned int)__builtin_clz(a) : 32);
+  }
+
+  #undef  __LZCNT__
+  #define __LZCNT__ __lzcnt_u32__
+
 #else
 
  /*
@@ -24,12 +24,11 @@
 #ifndef __QUANTILES_IMPL__
 #define __QUANTILES_IMPL__
 
-#include "service_micro_table.h"
-#include "service_memory.h"
-#include "service_math.h"
-#include "service_stat.h"
+#include "service_numeric_table.h"
+#include "service_selection.h"
 
 using namespace daal::internal;
+using namespace daal::algorithms::internal;
 
 namespace daal
 {
@@ -42,58 +41,22 @@ namespace internal
 template<Method method, typename algorithmFPType, CpuType cpu>
 services::Status QuantilesKernel<method, algorithmFPType, cpu>::compute(const NumericTable *a, NumericTable *r, const Parameter *par)
 {
-    size_t nFeatures = a->getNumberOfColumns();
-    size_t nVectors = a->getNumberOfRows();
-    size_t nQuantileOrders = r->getNumberOfColumns();
+    const size_t nFeatures = a->getNumberOfColumns();
+    const size_t nVectors = a->getNumberOfRows();
+    const size_t nQuantileOrders = r->getNumberOfColumns();
 
-    BlockMicroTable<algorithmFPType, readOnly, cpu> aMicroTable(const_cast<NumericTable *>(a));
-    BlockMicroTable<algorithmFPType, writeOnly, cpu> rMicroTable(r);
-    BlockMicroTable<algorithmFPType, readOnly, cpu> quantsQrderMicroTable(const_cast<NumericTable *>(par->quantileOrders.get()));
+    ReadRows<algorithmFPType, cpu> quantileOrdersBlock(const_cast<NumericTable *>(par->quantileOrders.get()), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(quantileOrdersBlock);
+    const algorithmFPType *quantileOrders = quantileOrdersBlock.get();
 
-    size_t nReadRows = 0;
+    WriteOnlyRows<algorithmFPType, cpu> quantilesBlock(r, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(quantilesBlock);
 
-    algorithmFPType *quantileOrders;
-    nReadRows = quantsQrderMicroTable.getBlockOfRows(0, 1, &quantileOrders);
-    if(nReadRows != 1)
-    {
-        quantsQrderMicroTable.release();
-        this->_errors->add(services::ErrorMemoryAllocationFailed);
-        DAAL_RETURN_STATUS()
-    }
+    ExactQuantiles<algorithmFPType, cpu> quantiles;
+    services::Status s = quantiles.init(nVectors, nQuantileOrders, quantileOrders);
+    if(!s) { return s; }
 
-    algorithmFPType *data;
-    nReadRows = aMicroTable.getBlockOfRows(0, nVectors, &data);
-    if(nReadRows != nVectors)
-    {
-        quantsQrderMicroTable.release();
-        aMicroTable.release();
-        this->_errors->add(services::ErrorMemoryAllocationFailed);
-        DAAL_RETURN_STATUS()
-    }
-
-    algorithmFPType *quants;
-    nReadRows = rMicroTable.getBlockOfRows(0, nFeatures, &quants);
-    if(nReadRows != nFeatures)
-    {
-        aMicroTable.release();
-        rMicroTable.release();
-        quantsQrderMicroTable.release();
-        this->_errors->add(services::ErrorMemoryAllocationFailed);
-        DAAL_RETURN_STATUS()
-    }
-
-    int errorcode = Statistics<algorithmFPType, cpu>::xQuantiles(data, nFeatures, nVectors, nQuantileOrders, quantileOrders, quants);
-
-    if(errorcode)
-    {
-        if(errorcode == __DAAL_VSL_SS_ERROR_BAD_QUANT_ORDER) { this->_errors->add(services::ErrorQuantileOrderValueIsInvalid); }
-        else { this->_errors->add(services::ErrorQuantilesInternal); }
-    }
-
-    aMicroTable.release();
-    rMicroTable.release();
-    quantsQrderMicroTable.release();
-    DAAL_RETURN_STATUS()
+    return quantiles.compute(*const_cast<NumericTable *>(a), quantilesBlock.get());
 }
 
 } // namespace daal::algorithms::quantiles::internal
@@ -28,7 +28,6 @@
 #include "quantiles_batch.h"
 
 #include "service_defines.h"
-#include "service_micro_table.h"
 
 using namespace daal::data_management;
 
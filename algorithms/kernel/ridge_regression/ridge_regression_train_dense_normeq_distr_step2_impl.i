@@ -83,14 +83,14 @@ template <typename algorithmFpType, CpuType cpu>
 void RidgeRegressionTrainDistributedKernel<algorithmFpType, training::normEqDense, cpu>::mergePartialSums(
             DAAL_INT nBetas, DAAL_INT nResponses, algorithmFpType * axtx, algorithmFpType * axty, algorithmFpType * rxtx, algorithmFpType * rxty)
 {
-    const size_t xtxSize = nBetas * nBetas;
-    daal::threader_for(xtxSize, xtxSize, [ = ](size_t i)
+    const size_t xtxSize = (size_t)nBetas * nBetas;
+    daal::threader_for_size(xtxSize, xtxSize, [ = ](size_t i)
     {
         rxtx[i] += axtx[i];
     } );
 
-    const size_t xtySize = nResponses * nBetas;
-    daal::threader_for(xtySize, xtySize, [ = ](size_t i)
+    const size_t xtySize = (size_t)nResponses * nBetas;
+    daal::threader_for_size(xtySize, xtySize, [ = ](size_t i)
     {
         rxty[i] += axty[i];
     } );
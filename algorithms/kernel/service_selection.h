@@ -0,0 +1,494 @@
+/* file: service_selection.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of selection algorithms and of the exact quantiles
+//  computation based on them.
+//--
+*/
+
+#ifndef __SERVICE_SELECTION_H__
+#define __SERVICE_SELECTION_H__
+
+#include "service_utils.h"
+#include "service_sort.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+
+/* Ranges not longer than this are ordered by insertion sort */
+const size_t selectionInsertionSortSize = 16;
+
+/* Ranges longer than this are partitioned by several threads */
+const size_t selectionParallelSize = 1 << 17;
+
+/* Number of elements partitioned by one thread at once */
+const size_t selectionBlockSize = 1 << 14;
+
+/* Number of elements sampled from the range to choose the pivot of the parallel partitioning */
+const size_t selectionSampleSize = 127;
+
+/**
+ * \brief Sorts array x by insertion
+ *
+ * \param n[in]     Length of input array
+ * \param x[in,out] Array to sort
+ */
+template <typename algorithmDataType, CpuType cpu>
+void insertionSort(size_t n, algorithmDataType *x)
+{
+    for(size_t j = 1; j < n; j++)
+    {
+        const algorithmDataType a = x[j];
+        size_t i = j;
+        for(; i > 0 && x[i - 1] > a; i--)
+        {
+            x[i] = x[i - 1];
+        }
+        x[i] = a;
+    }
+}
+
+/**
+ * \brief Introselect: rearranges array x so that x[k] is the k-th smallest element,
+ *        elements before x[k] are not greater and elements after x[k] are not less than x[k].
+ *        Quickselect with median-of-three pivots that switches to sorting of the remaining range
+ *        when the partitioning does not converge, so the worst case stays O(n log(n))
+ *
+ * \param n[in]     Length of input array
+ * \param x[in,out] Array to rearrange
+ * \param k[in]     Zero-based rank of the element to select, k < n
+ */
+template <typename algorithmDataType, CpuType cpu>
+void introSelect(size_t n, algorithmDataType *x, size_t k)
+{
+    if(n < 2) { return; }
+
+    size_t depthLimit = 0;
+    for(size_t m = n; m; m >>= 1) { depthLimit += 2; }
+
+    size_t l = 0, ir = n - 1;
+    while(ir > l)
+    {
+        if(ir - l < selectionInsertionSortSize)
+        {
+            insertionSort<algorithmDataType, cpu>(ir - l + 1, x + l);
+            return;
+        }
+        if(!depthLimit--)
+        {
+            qSort<algorithmDataType, cpu>(ir - l + 1, x + l);
+            return;
+        }
+
+        const size_t mid = l + ((ir - l) >> 1);
+        daal::services::internal::swap<cpu, algorithmDataType>(x[mid], x[l + 1]);
+        if(x[l] > x[ir])
+        {
+            daal::services::internal::swap<cpu, algorithmDataType>(x[l], x[ir]);
+        }
+        if(x[l + 1] > x[ir])
+        {
+            daal::services::internal::swap<cpu, algorithmDataType>(x[l + 1], x[ir]);
+        }
+        if(x[l] > x[l + 1])
+        {
+            daal::services::internal::swap<cpu, algorithmDataType>(x[l], x[l + 1]);
+        }
+
+        size_t i = l + 1;
+        size_t j = ir;
+        const algorithmDataType a = x[l + 1];
+        for(;;)
+        {
+            while(x[++i] < a);
+            while(x[--j] > a);
+            if(j < i) { break; }
+            daal::services::internal::swap<cpu, algorithmDataType>(x[i], x[j]);
+        }
+        x[l + 1] = x[j];
+        x[j] = a;
+
+        if(j >= k) { ir = j - 1; }
+        if(j <= k) { l = i; }
+    }
+}
+
+/**
+ * \brief Rearranges array x so that x[ranks[i] - offset] is the (ranks[i] - offset)-th smallest element
+ *        for each of the requested ranks. The range is split by the median requested rank,
+ *        so the cost is O(n log(nRanks)) instead of O(n log(n)) of the full sort
+ *
+ * \param n[in]       Length of input array
+ * \param x[in,out]   Array to rearrange
+ * \param ranks[in]   Ranks of the elements to select sorted in ascending order without duplicates
+ * \param nRanks[in]  Number of ranks
+ * \param offset[in]  Value subtracted from the ranks to get the indices in x
+ */
+template <typename algorithmDataType, CpuType cpu>
+void multiSelect(size_t n, algorithmDataType *x, const size_t *ranks, size_t nRanks, size_t offset)
+{
+    while(nRanks)
+    {
+        const size_t m = nRanks >> 1;
+        const size_t k = ranks[m] - offset;
+        introSelect<algorithmDataType, cpu>(n, x, k);
+
+        multiSelect<algorithmDataType, cpu>(k, x, ranks, m, offset);
+
+        /* Continue with the ranks greater than k */
+        x += k + 1;
+        n -= k + 1;
+        offset += k + 1;
+        ranks += m + 1;
+        nRanks -= m + 1;
+    }
+}
+
+/**
+ * \brief Three-way partitioning of array x into array y by several threads:
+ *        elements less than the pivot, then equal to the pivot, then greater than the pivot.
+ *        Relative order of the elements within the groups is preserved
+ */
+template <typename algorithmDataType, CpuType cpu>
+services::Status parallelPartition(size_t n, const algorithmDataType *x, algorithmDataType *y, algorithmDataType pivot,
+                                   size_t &nLess, size_t &nEqual)
+{
+    const size_t nBlocks = n / selectionBlockSize + !!(n % selectionBlockSize);
+
+    /* Per block numbers of elements less than and equal to the pivot, then per block output offsets */
+    daal::internal::TArray<size_t, cpu> aCounts(3 * nBlocks);
+    size_t *counts = aCounts.get();
+    DAAL_CHECK_MALLOC(counts);
+
+    daal::threader_for(nBlocks, nBlocks, [ & ](int iBlock)
+    {
+        const size_t iStart = iBlock * selectionBlockSize;
+        const size_t iEnd = (iStart + selectionBlockSize > n) ? n : iStart + selectionBlockSize;
+        size_t less = 0, equal = 0;
+        for(size_t i = iStart; i < iEnd; i++)
+        {
+            less  += (x[i] < pivot);
+            equal += (x[i] == pivot);
+        }
+        counts[3 * iBlock]     = less;
+        counts[3 * iBlock + 1] = equal;
+    } );
+
+    nLess = 0;
+    nEqual = 0;
+    for(size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    {
+        nLess  += counts[3 * iBlock];
+        nEqual += counts[3 * iBlock + 1];
+    }
+
+    size_t lessOffset = 0, equalOffset = nLess, greaterOffset = nLess + nEqual;
+    for(size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    {
+        const size_t less  = counts[3 * iBlock];
+        const size_t equal = counts[3 * iBlock + 1];
+        const size_t blockSize = ((iBlock + 1) * selectionBlockSize > n) ? n - iBlock * selectionBlockSize : selectionBlockSize;
+        counts[3 * iBlock]     = lessOffset;
+        counts[3 * iBlock + 1] = equalOffset;
+        counts[3 * iBlock + 2] = greaterOffset;
+        lessOffset    += less;
+        equalOffset   += equal;
+        greaterOffset += blockSize - less - equal;
+    }
+
+    daal::threader_for(nBlocks, nBlocks, [ & ](int iBlock)
+    {
+        const size_t iStart = iBlock * selectionBlockSize;
+        const size_t iEnd = (iStart + selectionBlockSize > n) ? n : iStart + selectionBlockSize;
+        size_t iLess = counts[3 * iBlock], iEqual = counts[3 * iBlock + 1], iGreater = counts[3 * iBlock + 2];
+        for(size_t i = iStart; i < iEnd; i++)
+        {
+            if(x[i] < pivot)       { y[iLess++]    = x[i]; }
+            else if(x[i] > pivot)  { y[iGreater++] = x[i]; }
+            else                   { y[iEqual++]   = x[i]; }
+        }
+    } );
+
+    return services::Status();
+}
+
+/**
+ * \brief Computes order statistics of array x: values[i] is the (ranks[i] - offset)-th smallest element of x.
+ *        Long ranges are partitioned by several threads around the pivots sampled near the requested ranks,
+ *        ranges shorter than selectionParallelSize are processed by multiSelect
+ *
+ * \param n[in]          Length of input array
+ * \param x[in,out]      Array of elements, its content is rearranged
+ * \param y[in]          Work array of size n
+ * \param ranks[in]      Ranks of the elements to select sorted in ascending order without duplicates
+ * \param nRanks[in]     Number of ranks
+ * \param offset[in]     Value subtracted from the ranks to get the indices in x
+ * \param values[out]    Selected elements
+ * \param inParallel[in] Flag that enables partitioning by several threads
+ */
+template <typename algorithmDataType, CpuType cpu>
+services::Status selectRanks(size_t n, algorithmDataType *x, algorithmDataType *y, const size_t *ranks, size_t nRanks,
+                             size_t offset, algorithmDataType *values, bool inParallel)
+{
+    if(!nRanks) { return services::Status(); }
+
+    if(!inParallel || n < selectionParallelSize)
+    {
+        multiSelect<algorithmDataType, cpu>(n, x, ranks, nRanks, offset);
+        for(size_t i = 0; i < nRanks; i++)
+        {
+            values[i] = x[ranks[i] - offset];
+        }
+        return services::Status();
+    }
+
+    /* Choose the pivot from the sorted sample at the position of the median requested rank */
+    algorithmDataType sample[selectionSampleSize];
+    const size_t sampleStep = n / selectionSampleSize;
+    for(size_t i = 0; i < selectionSampleSize; i++)
+    {
+        sample[i] = x[i * sampleStep];
+    }
+    qSort<algorithmDataType, cpu>(selectionSampleSize, sample);
+    size_t iPivot = ((ranks[nRanks >> 1] - offset) * selectionSampleSize) / n;
+    if(iPivot >= selectionSampleSize) { iPivot = selectionSampleSize - 1; }
+    const algorithmDataType pivot = sample[iPivot];
+
+    size_t nLess = 0, nEqual = 0;
+    services::Status s = parallelPartition<algorithmDataType, cpu>(n, x, y, pivot, nLess, nEqual);
+    if(!s) { return s; }
+
+    size_t nRanksLess = 0;
+    for(; nRanksLess < nRanks && ranks[nRanksLess] - offset < nLess; nRanksLess++);
+    size_t nRanksNotGreater = nRanksLess;
+    for(; nRanksNotGreater < nRanks && ranks[nRanksNotGreater] - offset < nLess + nEqual; nRanksNotGreater++)
+    {
+        values[nRanksNotGreater] = pivot;
+    }
+
+    /* The partitioned data is in y, x becomes the work array */
+    s = selectRanks<algorithmDataType, cpu>(nLess, y, x, ranks, nRanksLess, offset, values, inParallel);
+    if(!s) { return s; }
+
+    const size_t nNotGreater = nLess + nEqual;
+    return selectRanks<algorithmDataType, cpu>(n - nNotGreater, y + nNotGreater, x + nNotGreater,
+                                               ranks + nRanksNotGreater, nRanks - nRanksNotGreater, offset + nNotGreater,
+                                               values + nRanksNotGreater, inParallel);
+}
+
+/**
+ * \brief Exact computation of the quantiles of the columns of a numeric table via selection.
+ *        Quantile of order q of the sample x of size n is x(f) + (w - f) * (x(f + 1) - x(f)),
+ *        where x(i) is the i-th order statistic, w = q * (n - 1), f = floor(w).
+ *        Columns are processed in parallel; when there are fewer columns than threads
+ *        each long column is partitioned by several threads
+ */
+template <typename algorithmFPType, CpuType cpu>
+class ExactQuantiles
+{
+public:
+    ExactQuantiles() : _nVectors(0), _nOrders(0), _nRanks(0) {}
+
+    /**
+     * \brief Prepares the computation of the quantiles of the given orders for the columns of size nVectors
+     *
+     * \param nVectors[in] Number of elements in the columns
+     * \param nOrders[in]  Number of quantile orders
+     * \param orders[in]   Quantile orders from [0, 1]
+     */
+    services::Status init(size_t nVectors, size_t nOrders, const algorithmFPType *orders)
+    {
+        const algorithmFPType zero = 0.0;
+        const algorithmFPType one  = 1.0;
+
+        _nVectors = nVectors;
+        _nOrders  = nOrders;
+        DAAL_CHECK(nVectors, services::ErrorIncorrectNumberOfObservations);
+
+        _lowerRank.reset(nOrders);
+        _upperRank.reset(nOrders);
+        _fraction.reset(nOrders);
+        _ranks.reset(2 * nOrders);
+        DAAL_CHECK_MALLOC(_lowerRank.get() && _upperRank.get() && _fraction.get() && _ranks.get());
+
+        size_t *ranks = _ranks.get();
+        for(size_t i = 0; i < nOrders; i++)
+        {
+            DAAL_CHECK(orders[i] >= zero && orders[i] <= one, services::ErrorQuantileOrderValueIsInvalid);
+            const algorithmFPType w = orders[i] * algorithmFPType(nVectors - 1);
+            size_t f = (size_t)w;
+            if(f > nVectors - 1) { f = nVectors - 1; }
+            _fraction[i] = w - algorithmFPType(f);
+            ranks[2 * i]     = f;
+            ranks[2 * i + 1] = (f + 1 < nVectors) ? f + 1 : f;
+        }
+
+        /* Keep the unique ranks in ascending order */
+        qSort<size_t, cpu>(2 * nOrders, ranks);
+        _nRanks = 0;
+        for(size_t i = 0; i < 2 * nOrders; i++)
+        {
+            if(!_nRanks || ranks[_nRanks - 1] != ranks[i]) { ranks[_nRanks++] = ranks[i]; }
+        }
+
+        for(size_t i = 0; i < nOrders; i++)
+        {
+            const algorithmFPType w = orders[i] * algorithmFPType(nVectors - 1);
+            size_t f = (size_t)w;
+            if(f > nVectors - 1) { f = nVectors - 1; }
+            _lowerRank[i] = findRank(f);
+            _upperRank[i] = findRank((f + 1 < nVectors) ? f + 1 : f);
+        }
+        return services::Status();
+    }
+
+    /**
+     * \brief Computes the quantiles of the columns of the numeric table
+     *
+     * \param data[in]    Numeric table of size nVectors x nFeatures
+     * \param quants[out] Array of size nFeatures x nOrders, quants[j * nOrders + i] is the quantile of order i for column j
+     * \param shift[in]   Optional array of size nFeatures. If specified, the quantiles of |x(j) - shift[j]| are computed
+     */
+    services::Status compute(NumericTable &data, algorithmFPType *quants, const algorithmFPType *shift = 0) const
+    {
+        const size_t nFeatures = data.getNumberOfColumns();
+        const size_t nThreads = threader_get_threads_number();
+
+        if(nFeatures < nThreads && _nVectors >= selectionParallelSize)
+        {
+            /* Few long columns: partition each column by several threads */
+            ColumnBuffers buffers(_nVectors, _nRanks);
+            DAAL_CHECK_MALLOC(buffers.isValid());
+
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                services::Status s = computeColumn(data, j, shift, buffers, quants + j * _nOrders, true);
+                if(!s) { return s; }
+            }
+            return services::Status();
+        }
+
+        const size_t nVectors = _nVectors;
+        const size_t nRanks = _nRanks;
+        daal::tls<ColumnBuffers *> tlsBuffers([ = ]()
+        {
+            return new ColumnBuffers(nVectors, nRanks);
+        });
+
+        SafeStatus safeStat;
+        daal::threader_for(nFeatures, nFeatures, [ & ](int j)
+        {
+            ColumnBuffers *buffers = tlsBuffers.local();
+            DAAL_CHECK_THR(buffers && buffers->isValid(), services::ErrorMemoryAllocationFailed);
+            safeStat |= computeColumn(data, j, shift, *buffers, quants + j * _nOrders, false);
+        } );
+
+        tlsBuffers.reduce([](ColumnBuffers *buffers)
+        {
+            delete buffers;
+        } );
+
+        return safeStat.detach();
+    }
+
+protected:
+    /* Work arrays for the computation of quantiles of a column */
+    struct ColumnBuffers
+    {
+        ColumnBuffers(size_t nVectors, size_t nRanks) : x(nVectors), y(nVectors), values(nRanks) {}
+        bool isValid() const { return x.get() && y.get() && values.get(); }
+
+        daal::internal::TArrayScalable<algorithmFPType, cpu> x;
+        daal::internal::TArrayScalable<algorithmFPType, cpu> y;
+        daal::internal::TArrayScalable<algorithmFPType, cpu> values;
+    };
+
+    services::Status computeColumn(NumericTable &data, size_t iFeature, const algorithmFPType *shift,
+                                   ColumnBuffers &buffers, algorithmFPType *quants, bool inParallel) const
+    {
+        daal::internal::ReadColumns<algorithmFPType, cpu> column(data, iFeature, 0, _nVectors);
+        DAAL_CHECK_BLOCK_STATUS(column);
+        const algorithmFPType *src = column.get();
+
+        algorithmFPType *x = buffers.x.get();
+        if(shift)
+        {
+            const algorithmFPType s = shift[iFeature];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < _nVectors; i++)
+            {
+                x[i] = (src[i] > s) ? src[i] - s : s - src[i];
+            }
+        }
+        else
+        {
+            daal::services::daal_memcpy_s(x, _nVectors * sizeof(algorithmFPType), src, _nVectors * sizeof(algorithmFPType));
+        }
+
+        algorithmFPType *values = buffers.values.get();
+        services::Status s = selectRanks<algorithmFPType, cpu>(_nVectors, x, buffers.y.get(), _ranks.get(), _nRanks, 0,
+                                                               values, inParallel);
+        if(!s) { return s; }
+
+        for(size_t i = 0; i < _nOrders; i++)
+        {
+            const algorithmFPType lower = values[_lowerRank[i]];
+            const algorithmFPType upper = values[_upperRank[i]];
+            quants[i] = lower + _fraction[i] * (upper - lower);
+        }
+        return s;
+    }
+
+    /* Returns the position of rank in the array of unique ranks */
+    size_t findRank(size_t rank) const
+    {
+        const size_t *ranks = _ranks.get();
+        size_t l = 0, r = _nRanks - 1;
+        while(l < r)
+        {
+            const size_t m = (l + r) >> 1;
+            if(ranks[m] < rank) { l = m + 1; }
+            else { r = m; }
+        }
+        return l;
+    }
+
+    size_t _nVectors;
+    size_t _nOrders;
+    size_t _nRanks;
+    daal::internal::TArray<size_t, cpu> _ranks;
+    daal::internal::TArray<size_t, cpu> _lowerRank;
+    daal::internal::TArray<size_t, cpu> _upperRank;
+    daal::internal::TArray<algorithmFPType, cpu> _fraction;
+};
+
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
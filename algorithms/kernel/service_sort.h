@@ -40,6 +40,8 @@ namespace internal
 
 typedef int (*CompareFunction)(const void *, const void *);
 
+/* Quick sort functions below use 64-bit indices to sort the arrays with more than 2^31 elements */
+
 /**
  * \brief Quick sort function that sorts array x
  *
@@ -49,12 +51,13 @@ typedef int (*CompareFunction)(const void *, const void *);
 template <typename algorithmDataType, CpuType cpu>
 void qSort(size_t n, algorithmDataType *x)
 {
-    int i, ir, j, k, jstack = -1, l = 0;
+    DAAL_INT64 i, ir, j, k, l = 0;
+    int jstack = -1;
     algorithmDataType a;
     const int M = 7, NSTACK = 128;
-    int istack[NSTACK];
+    DAAL_INT64 istack[NSTACK];
 
-    ir = n - 1;
+    ir = (DAAL_INT64)n - 1;
 
     for(;;)
     {
@@ -135,12 +138,13 @@ void qSort(size_t n, algorithmDataType *x)
 template <typename algorithmDataType, CpuType cpu>
 void qSort(size_t n, algorithmDataType *x, CompareFunction compare)
 {
-    int i, ir, j, k, jstack = -1, l = 0;
+    DAAL_INT64 i, ir, j, k, l = 0;
+    int jstack = -1;
     algorithmDataType a;
     const int M = 7, NSTACK = 128;
-    int istack[NSTACK];
+    DAAL_INT64 istack[NSTACK];
 
-    ir = n - 1;
+    ir = (DAAL_INT64)n - 1;
 
     for(;;)
     {
@@ -224,13 +228,14 @@ void qSort(size_t n, algorithmDataType *x, CompareFunction compare)
 template <typename algorithmDataType, typename algorithmIndexType, CpuType cpu>
 void qSort(size_t n, algorithmDataType *x, algorithmIndexType *index)
 {
-    int i, ir, j, k, jstack = -1, l = 0;
+    DAAL_INT64 i, ir, j, k, l = 0;
+    int jstack = -1;
     algorithmDataType a;
     algorithmIndexType b;
     const int M = 7, NSTACK = 128;
-    algorithmDataType istack[NSTACK];
+    DAAL_INT64 istack[NSTACK];
 
-    ir = n - 1;
+    ir = (DAAL_INT64)n - 1;
 
     for(;;)
     {
@@ -315,14 +320,15 @@ void qSort(size_t n, algorithmDataType *x, algorithmIndexType *index)
 template <typename algorithmFPtype, typename wType, typename zType, CpuType cpu>
 void qSort(size_t n, algorithmFPtype *x, wType *w, zType *z)
 {
-    int i, ir, j, k, jstack = -1, l = 0;
+    DAAL_INT64 i, ir, j, k, l = 0;
+    int jstack = -1;
     algorithmFPtype a;
     wType b;
     zType c;
     const int M = 7, NSTACK = 128;
-    algorithmFPtype istack[NSTACK];
+    DAAL_INT64 istack[NSTACK];
 
-    ir = n - 1;
+    ir = (DAAL_INT64)n - 1;
 
     for(;;)
     {
@@ -439,6 +445,18 @@ struct RadixSort {};
 #if defined(__INTEL_COMPILER_BUILD_DATE)
 #define __RADIX_SORT_CAST32(x) (_castf32_u32(x))
 #define __RADIX_SORT_CAST64(x) (_castf64_u64(x))
+#elif defined(__GNUC__)
+/* Type punning through a union is supported by GCC and Clang and, unlike the pointer cast,
+   is not broken by the strict aliasing optimizations; it is compiled into one register move */
+template <typename IntegerType, typename FPType>
+inline IntegerType radixSortCast(const FPType x)
+{
+    union { FPType f; IntegerType i; } u;
+    u.f = x;
+    return u.i;
+}
+#define __RADIX_SORT_CAST32(x) (radixSortCast<unsigned int, float>(x))
+#define __RADIX_SORT_CAST64(x) (radixSortCast<DAAL_UINT64, double>(x))
 #else
 #define __RADIX_SORT_CAST32(x) (*reinterpret_cast<const unsigned int *>(&(x)))
 #define __RADIX_SORT_CAST64(x) (*reinterpret_cast<const DAAL_UINT64 *>(&(x)))
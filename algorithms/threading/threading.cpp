@@ -99,6 +99,36 @@ DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const v
   #endif
 }
 
+DAAL_EXPORT void _daal_threader_for_size(size_t n, size_t threads_request, const void* a, daal::functype_size func)
+{
+  #if defined(__DO_TBB_LAYER__)
+    tbb::parallel_for( tbb::blocked_range<size_t>(0,n,1), [&](tbb::blocked_range<size_t> r)
+    {
+        for( size_t i = r.begin(); i < r.end(); i++ )
+        {
+            func(i, a);
+        }
+    } );
+  #elif defined(__DO_SEQ_LAYER__)
+    for( size_t i = 0; i < n; i++ )
+    {
+        func(i, a);
+    }
+  #endif
+}
+
+DAAL_EXPORT void _daal_threader_for_blocked_size(size_t n, size_t threads_request, const void* a, daal::functype2_size func)
+{
+  #if defined(__DO_TBB_LAYER__)
+    tbb::parallel_for( tbb::blocked_range<size_t>(0,n,1), [&](tbb::blocked_range<size_t> r)
+    {
+        func(r.begin(), r.end()-r.begin(), a);
+    } );
+  #elif defined(__DO_SEQ_LAYER__)
+    func(0, n, a);
+  #endif
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
   #if defined(__DO_TBB_LAYER__)
@@ -31,6 +31,8 @@ namespace daal
 
 typedef void (*functype)(int i, const void *a);
 typedef void (*functype2)(int i, int n, const void *a);
+typedef void (*functype_size)(size_t i, const void *a);
+typedef void (*functype2_size)(size_t i, size_t n, const void *a);
 typedef void *(*tls_functype)(const void *a);
 typedef void (*tls_reduce_functype)(void *p, const void *a);
 
@@ -42,6 +44,8 @@ extern "C" {
     DAAL_EXPORT void  _daal_threader_for(int n, int threads_request, const void *a, daal::functype func);
     DAAL_EXPORT void  _daal_threader_for_blocked(int n, int threads_request, const void *a, daal::functype2 func);
     DAAL_EXPORT void  _daal_threader_for_optional(int n, int threads_request, const void *a, daal::functype func);
+    DAAL_EXPORT void  _daal_threader_for_size(size_t n, size_t threads_request, const void *a, daal::functype_size func);
+    DAAL_EXPORT void  _daal_threader_for_blocked_size(size_t n, size_t threads_request, const void *a, daal::functype2_size func);
 
     DAAL_EXPORT void *_daal_get_tls_ptr( void *a, daal::tls_functype func );
     DAAL_EXPORT void *_daal_get_tls_local( void *tlsPtr );
@@ -113,6 +117,20 @@ inline void threader_func_b(int i0, int in, const void *a)
     lambda(i0, in);
 }
 
+template<typename F>
+inline void threader_func_size(size_t i, const void *a)
+{
+    const F &lambda = *static_cast<const F *>(a);
+    lambda(i);
+}
+
+template<typename F>
+inline void threader_func_b_size(size_t i0, size_t in, const void *a)
+{
+    const F &lambda = *static_cast<const F *>(a);
+    lambda(i0, in);
+}
+
 template<typename F>
 inline void threader_for(int n, int threads_request, const F &lambda)
 {
@@ -137,6 +155,23 @@ inline void threader_for_optional(int n, int threads_request, const F &lambda)
     _daal_threader_for_optional(n, threads_request, a, threader_func<F>);
 }
 
+/* Versions of threader_for and threader_for_blocked for the iteration spaces that do not fit into int */
+template<typename F>
+inline void threader_for_size(size_t n, size_t threads_request, const F &lambda)
+{
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_size(n, threads_request, a, threader_func_size<F>);
+}
+
+template<typename F>
+inline void threader_for_blocked_size(size_t n, size_t threads_request, const F &lambda)
+{
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_blocked_size(n, threads_request, a, threader_func_b_size<F>);
+}
+
 template<typename lambdaType>
 inline void *tls_func(const void *a)
 {
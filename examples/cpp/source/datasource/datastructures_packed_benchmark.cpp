@@ -0,0 +1,99 @@
+/* file: datastructures_packed_benchmark.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of measuring the row access time of packed data structures
+!    compared to the homogen numeric table of the same dimension
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASTRUCTURES_PACKED_BENCHMARK">
+ * \example datastructures_packed_benchmark.cpp
+ */
+
+#include <chrono>
+#include "daal.h"
+#include "service.h"
+
+using namespace daal;
+
+const size_t nDim        = 4096;
+const size_t nBlockRows  = 256;
+const size_t nIterations = 5;
+
+/* Returns the average time in milliseconds of reading and writing back all rows of the table */
+template <typename TableType>
+double measureRowAccess(TableType &table)
+{
+    BlockDescriptor<double> block;
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+    for (size_t it = 0; it < nIterations; it++)
+    {
+        for (size_t i = 0; i < nDim; i += nBlockRows)
+        {
+            table.getBlockOfRows(i, nBlockRows, readWrite, block);
+            table.releaseBlockOfRows(block);
+        }
+    }
+
+    std::chrono::duration<double, std::milli> time = std::chrono::high_resolution_clock::now() - start;
+    return time.count() / nIterations;
+}
+
+void printTime(const char *name, double time, double baseTime)
+{
+    std::cout << name << ": " << time << " ms (" << time / baseTime << "x of the homogen table time)" << std::endl;
+}
+
+int main()
+{
+    std::cout << "Packed data structures row access benchmark" << std::endl << std::endl;
+
+    const size_t nPacked = nDim * (nDim + 1) / 2;
+    float *packedData = new float[nPacked];
+    float *fullData   = new float[nDim * nDim];
+
+    for (size_t i = 0; i < nPacked; i++)
+    {
+        packedData[i] = (float)(i % 1000) * 0.001f;
+    }
+    for (size_t i = 0; i < nDim * nDim; i++)
+    {
+        fullData[i] = (float)(i % 1000) * 0.001f;
+    }
+
+    HomogenNumericTable<float> fullTable(fullData, nDim, nDim);
+    PackedSymmetricMatrix<NumericTableIface::upperPackedSymmetricMatrix, float> upperSymmetric(packedData, nDim);
+    PackedSymmetricMatrix<NumericTableIface::lowerPackedSymmetricMatrix, float> lowerSymmetric(packedData, nDim);
+    PackedTriangularMatrix<NumericTableIface::upperPackedTriangularMatrix, float> upperTriangular(packedData, nDim);
+    PackedTriangularMatrix<NumericTableIface::lowerPackedTriangularMatrix, float> lowerTriangular(packedData, nDim);
+
+    const double baseTime = measureRowAccess(fullTable);
+    std::cout << "Matrix dimension: " << nDim << ", rows per block: " << nBlockRows << std::endl;
+    printTime("Homogen numeric table          ", baseTime, baseTime);
+    printTime("Upper packed symmetric matrix  ", measureRowAccess(upperSymmetric), baseTime);
+    printTime("Lower packed symmetric matrix  ", measureRowAccess(lowerSymmetric), baseTime);
+    printTime("Upper packed triangular matrix ", measureRowAccess(upperTriangular), baseTime);
+    printTime("Lower packed triangular matrix ", measureRowAccess(lowerTriangular), baseTime);
+
+    delete[] packedData;
+    delete[] fullData;
+
+    return 0;
+}
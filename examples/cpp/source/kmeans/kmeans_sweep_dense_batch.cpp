@@ -0,0 +1,80 @@
+/* file: kmeans_sweep_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the dense K-Means sweep over several numbers of clusters
+!    in the batch processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KMEANS_SWEEP_DENSE_BATCH"></a>
+ * \example kmeans_sweep_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string datasetFileName     = "../data/batch/kmeans_dense.csv";
+
+/* K-Means sweep parameters */
+const size_t minClusters  = 5;
+const size_t maxClusters  = 40;
+const size_t clustersStep = 5;
+const size_t nIterations  = 5;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm object for the K-Means sweep */
+    kmeans::sweep::Batch<> algorithm(nIterations);
+    algorithm.input.set(kmeans::sweep::data, dataSource.getNumericTable());
+
+    /* Get initial clusters for each number of clusters */
+    for (size_t nClusters = minClusters; nClusters <= maxClusters; nClusters += clustersStep)
+    {
+        kmeans::init::Batch<float, kmeans::init::randomDense> init(nClusters);
+
+        init.input.set(kmeans::init::data, dataSource.getNumericTable());
+        init.compute();
+
+        algorithm.input.add(kmeans::sweep::inputCentroids, init.getResult()->get(kmeans::init::centroids));
+    }
+
+    /* Run the K-Means algorithm for all the numbers of clusters with shared passes over the data */
+    algorithm.compute();
+
+    /* Print the results */
+    printNumericTable(algorithm.getResult()->get(kmeans::sweep::objectiveFunction), "Objective function values:");
+    printNumericTable(algorithm.getResult()->get(kmeans::sweep::nIterations), "Numbers of executed iterations:");
+    printNumericTable(algorithm.getResult()->get(kmeans::sweep::centroids, 0), "First 10 dimensions of centroids for the smallest number of clusters:", 20, 10);
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+/* file: multi_model_scoring_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the multi-model scoring in the batch processing mode.
+!
+!    The program trains the decision forest regression and the linear regression
+!    models and computes predictions of both models for the test data
+!    in one pass over the data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-MULTI_MODEL_SCORING_DENSE_BATCH"></a>
+ * \example multi_model_scoring_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName  = "../data/batch/df_regression_test.csv";
+const size_t nFeatures = 13;  /* Number of features in training and testing data sets */
+
+/* Decision forest parameters */
+const size_t nTrees = 100;
+
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    /* Train the decision forest regression model */
+    decision_forest::regression::training::Batch<> dfTraining;
+    dfTraining.input.set(decision_forest::regression::training::data, trainData);
+    dfTraining.input.set(decision_forest::regression::training::dependentVariable, trainDependentVariable);
+    dfTraining.parameter.nTrees = nTrees;
+    dfTraining.compute();
+    decision_forest::regression::ModelPtr dfModel =
+        dfTraining.getResult()->get(decision_forest::regression::training::model);
+
+    /* Convert the decision forest into the compact form used for prediction only */
+    dfModel->compact();
+
+    /* Train the linear regression model */
+    linear_regression::training::Batch<> lrTraining;
+    lrTraining.input.set(linear_regression::training::data, trainData);
+    lrTraining.input.set(linear_regression::training::dependentVariables, trainDependentVariable);
+    lrTraining.compute();
+    linear_regression::ModelPtr lrModel = lrTraining.getResult()->get(linear_regression::training::model);
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Compute predictions of both models reading each block of the test data once */
+    multi_model_scoring::Batch<> algorithm;
+    algorithm.input.set(multi_model_scoring::data, testData);
+    algorithm.input.add(multi_model_scoring::models, dfModel);
+    algorithm.input.add(multi_model_scoring::models, lrModel);
+    algorithm.compute();
+
+    printNumericTable(algorithm.getResult()->get(multi_model_scoring::prediction),
+        "Decision forest and linear regression predictions (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+
+    return 0;
+}
+
+void loadData(const std::string& fileName, NumericTablePtr& pData, NumericTablePtr& pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName,
+        DataSource::notAllocateNumericTable,
+        DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    dataSource.loadDataBlock(mergedData.get());
+}
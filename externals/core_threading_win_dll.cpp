@@ -191,6 +191,8 @@ FARPROC load_daal_thr_func(char *ordinal)
 
 typedef void (* _daal_threader_for_t)(int , int , const void *, daal::functype );
 typedef void (* _daal_threader_for_blocked_t)(int , int , const void *, daal::functype2 );
+typedef void (* _daal_threader_for_size_t)(size_t , size_t , const void *, daal::functype_size );
+typedef void (* _daal_threader_for_blocked_size_t)(size_t , size_t , const void *, daal::functype2_size );
 typedef int (* _daal_threader_get_max_threads_t)(void);
 
 typedef void *(* _daal_get_tls_ptr_t)(void *, daal::tls_functype );
@@ -216,6 +218,8 @@ typedef void *(*_daal_threader_env_t)();
 static _daal_threader_for_t _daal_threader_for_ptr = NULL;
 static _daal_threader_for_blocked_t _daal_threader_for_blocked_ptr = NULL;
 static _daal_threader_for_t _daal_threader_for_optional_ptr = NULL;
+static _daal_threader_for_size_t _daal_threader_for_size_ptr = NULL;
+static _daal_threader_for_blocked_size_t _daal_threader_for_blocked_size_ptr = NULL;
 static _daal_threader_get_max_threads_t _daal_threader_get_max_threads_ptr = NULL;
 
 static _daal_get_tls_ptr_t _daal_get_tls_ptr_ptr = NULL;
@@ -263,6 +267,24 @@ DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const v
     _daal_threader_for_optional_ptr(n, threads_request, a, func);
 }
 
+DAAL_EXPORT void _daal_threader_for_size(size_t n, size_t threads_request, const void *a, daal::functype_size func)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_for_size_ptr == NULL) { _daal_threader_for_size_ptr = (_daal_threader_for_size_t)load_daal_thr_func("_daal_threader_for_size"); }
+    _daal_threader_for_size_ptr(n, threads_request, a, func);
+}
+
+DAAL_EXPORT void _daal_threader_for_blocked_size(size_t n, size_t threads_request, const void *a, daal::functype2_size func)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_for_blocked_size_ptr == NULL)
+    {
+        _daal_threader_for_blocked_size_ptr
+            = (_daal_threader_for_blocked_size_t)load_daal_thr_func("_daal_threader_for_blocked_size");
+    }
+    _daal_threader_for_blocked_size_ptr(n, threads_request, a, func);
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
     load_daal_thr_dll();
@@ -23,10 +23,74 @@
 
 #include "service_memory.h"
 #include "service_service.h"
+#include "threading.h"
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+#endif
+
+static int    daal_large_allocation_flags    = daal::services::largeAllocationDefault;
+static size_t daal_large_allocation_min_size = 0;
+
+static const size_t daal_huge_page_size = 2 * 1024 * 1024;
+static const size_t daal_page_size      = 4096;
+
+static void daal_advise_huge_pages(void *ptr, size_t size)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    /* Only the whole huge pages inside the block are advised */
+    const size_t begin = ((size_t)ptr + daal_huge_page_size - 1) / daal_huge_page_size * daal_huge_page_size;
+    const size_t end   = ((size_t)ptr + size) / daal_huge_page_size * daal_huge_page_size;
+    if(end > begin)
+    {
+        madvise((void *)begin, end - begin, MADV_HUGEPAGE);
+    }
+#endif
+}
+
+static void daal_prefault(void *ptr, size_t size)
+{
+    /* Chunks are multiples of the huge page size so that each huge page is faulted by one thread */
+    const size_t chunkSize = 16 * daal_huge_page_size;
+    const size_t nChunks   = (size + chunkSize - 1) / chunkSize;
+    char *bytes = (char *)ptr;
+
+    daal::threader_for_size(nChunks, nChunks, [=](size_t iChunk)
+    {
+        const size_t begin = iChunk * chunkSize;
+        const size_t end   = (begin + chunkSize < size ? begin + chunkSize : size);
+        for(size_t i = begin; i < end; i += daal_page_size)
+        {
+            bytes[i] = 0;
+        }
+    });
+}
+
+void daal::services::daal_set_large_allocation_policy(int flags, size_t minSize)
+{
+    daal_large_allocation_min_size = minSize;
+    daal_large_allocation_flags    = flags;
+}
 
 void *daal::services::daal_malloc(size_t size, size_t alignment)
 {
-    return daal::internal::Service<>::serv_malloc(size, alignment);
+    const int flags = daal_large_allocation_flags;
+    if(flags == largeAllocationDefault || size < daal_large_allocation_min_size)
+    {
+        return daal::internal::Service<>::serv_malloc(size, alignment);
+    }
+
+    if((flags & largeAllocationHugePages) && alignment < daal_huge_page_size)
+    {
+        alignment = daal_huge_page_size;
+    }
+
+    void *ptr = daal::internal::Service<>::serv_malloc(size, alignment);
+    if(!ptr) { return ptr; }
+
+    if(flags & largeAllocationHugePages) { daal_advise_huge_pages(ptr, size); }
+    if(flags & largeAllocationPrefault)  { daal_prefault(ptr, size); }
+    return ptr;
 }
 
 void daal::services::daal_free(void *ptr)
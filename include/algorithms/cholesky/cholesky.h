@@ -97,7 +97,7 @@ public:
      * \param[in] other An algorithm to be used as the source to initialize the input objects
      *                  and parameters of the algorithm
      */
-    Batch(const Batch<algorithmFPType, method> &other) : input(other.input)
+    Batch(const Batch<algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
     {
         initialize();
     }
@@ -152,7 +152,7 @@ protected:
 
     virtual services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _result->allocate<algorithmFPType>(&input, NULL, (int)method);
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, (int)method);
         _res = _result.get();
         return s;
     }
@@ -161,11 +161,13 @@ protected:
     {
         Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
         _in = &input;
+        _par = &parameter;
         _result = ResultPtr(new Result());
     }
 
 public:
     Input input;         /*!< %Input data structure */
+    Parameter parameter; /*!< %Parameter data structure */
 
 private:
     ResultPtr _result;
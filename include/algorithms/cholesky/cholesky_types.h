@@ -50,7 +50,18 @@ namespace cholesky
  */
 enum Method
 {
-    defaultDense = 0       /*!< Default: performance-oriented method. */
+    defaultDense = 0,      /*!< Default: performance-oriented method. */
+    rankUpdateDense = 1    /*!< Rank-k update or downdate of the given Cholesky factor */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CHOLESKY__UPDATETYPE"></a>
+ * Available types of modification of the Cholesky factor computed with the rankUpdateDense method
+ */
+enum UpdateType
+{
+    update   = 0,          /*!< Factor of the matrix A + X'*X is computed from the factor of the matrix A */
+    downdate = 1           /*!< Factor of the matrix A - X'*X is computed from the factor of the matrix A */
 };
 
 /**
@@ -59,8 +70,9 @@ enum Method
  */
 enum InputId
 {
-    data,                /*!< %Input data table */
-    lastInputId = data
+    data,                /*!< %Input data table. For the rankUpdateDense method, contains the rows of the matrix X of the modification */
+    inputCholeskyFactor, /*!< Lower triangle matrix L of the decomposition to modify. Used only by the rankUpdateDense method */
+    lastInputId = inputCholeskyFactor
 };
 
 /**
@@ -78,6 +90,25 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__CHOLESKY__PARAMETER"></a>
+ * \brief Parameters for the Cholesky algorithm
+ *
+ * \snippet cholesky/cholesky_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     *  Constructs parameters of the Cholesky algorithm
+     *  \param[in] _updateType   Type of modification of the Cholesky factor
+     */
+    Parameter(UpdateType _updateType = update);
+
+    UpdateType updateType;   /*!< Type of modification of the Cholesky factor. Used only by the rankUpdateDense method */
+};
+/* [Parameter source code] */
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__CHOLESKY__INPUT"></a>
  * \brief %Input parameters for the Cholesky algorithm
@@ -178,6 +209,7 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 /** @} */
 } // namespace interface1
+using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
@@ -0,0 +1,226 @@
+/* file: binary_confusion_matrix_online.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Interface for the binary confusion matrix algorithm in the online processing mode
+//--
+*/
+
+#ifndef __BINARY_CONFUSION_MATRIX_ONLINE_H__
+#define __BINARY_CONFUSION_MATRIX_ONLINE_H__
+
+#include "algorithms/algorithm.h"
+#include "algorithms/classifier/binary_confusion_matrix_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace classifier
+{
+namespace quality_metric
+{
+namespace binary_confusion_matrix
+{
+
+namespace interface1
+{
+/**
+ * @defgroup quality_metric_binary_online Online
+ * @ingroup quality_metric_binary
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__BINARY_CONFUSION_MATRIX__ONLINECONTAINER"></a>
+ *  \brief Class containing methods to compute the binary confusion matrix in the online processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the binary confusion matrix, double or float
+ * \tparam method           Computation method for the binary confusion matrix, \ref Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT OnlineContainer : public daal::algorithms::AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the binary confusion matrix algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~OnlineContainer();
+    /**
+     * Accumulates the binary confusion matrix for the next block of labels in the online processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the quality metrics from the accumulated binary confusion matrix in the online processing mode
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__BINARY_CONFUSION_MATRIX__ONLINE"></a>
+ * \brief Computes the binary confusion matrix in the online processing mode.
+ *        Each call of compute() adds the counts for the next block of predicted and ground truth labels
+ *        to the partial result, finalizeCompute() computes the quality metrics from the accumulated counts
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the binary confusion matrix, double or float
+ * \tparam method           Computation method for the binary confusion matrix, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods for the binary confusion matrix
+ *      - \ref InputId          Identifiers of input objects for the binary confusion matrix algorithm
+ *      - \ref PartialResultId  Identifiers of partial results of the binary confusion matrix algorithm
+ *      - \ref ResultId         Identifiers of results of the binary confusion matrix algorithm
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Online : public daal::algorithms::Analysis<online>
+{
+public:
+    Input input;            /*!< %Input objects of the algorithm */
+    Parameter parameter;    /*!< Parameters of the algorithm */
+
+    /** Default constructor */
+    Online()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs a confusion matrix algorithm by copying input objects and parameters
+     * of another confusion matrix algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> &other) : input(other.input), parameter(other.parameter)
+    {
+        initialize();
+    }
+
+    /**
+     * Returns the method of the algorithm
+     * \return Method of the algorithm
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int) method; }
+
+    /**
+     * Returns the structure that contains results of the binary confusion matrix algorithm
+     * \return Structure that contains results of the binary confusion matrix algorithm
+     */
+    ResultPtr getResult() const
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the binary confusion matrix algorithm
+     * \param[in] result  Structure to store results of the binary confusion matrix algorithm
+     */
+    services::Status setResult(const ResultPtr& result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the binary confusion matrix algorithm
+     * \return Structure that contains partial results of the binary confusion matrix algorithm
+     */
+    PartialResultPtr getPartialResult() const
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the binary confusion matrix algorithm
+     * \param[in] partialResult  Structure to store partial results of the binary confusion matrix algorithm
+     * \param[in] initFlag       Flag that specifies whether the partial results are initialized
+     */
+    services::Status setPartialResult(const PartialResultPtr& partialResult, bool initFlag = false)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult)
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated confusion matrix algorithm with a copy of input objects
+     * and parameters of this confusion matrix algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Online<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Online<algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(_pres, &parameter, (int) method);
+        _res = _result.get();
+        return s;
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, (int) method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->initialize<algorithmFPType>(&input, &parameter, (int) method);
+        _pres = _partialResult.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<online>::_ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _result = ResultPtr(new Result());
+        _partialResult = PartialResultPtr(new PartialResult());
+    }
+
+private:
+    PartialResultPtr _partialResult;
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::OnlineContainer;
+using interface1::Online;
+
+}
+}
+}
+}
+}
+#endif
@@ -69,6 +69,16 @@ enum InputId
     lastInputId = groundTruthLabels
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the multi-class confusion matrix algorithm in the online processing mode
+ */
+enum PartialResultId
+{
+    partialConfusionMatrix,   /*!< Multi-class confusion matrix accumulated over the blocks of labels processed so far */
+    lastPartialResultId = partialConfusionMatrix
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__RESULTID"></a>
  * Available identifiers of the results of the confusion matrix algorithm
@@ -154,10 +164,86 @@ public:
     services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__PARTIALRESULT"></a>
+ * \brief Partial results obtained with the compute() method of the multi-class confusion matrix algorithm
+ *        in the online processing mode
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE();
+    PartialResult();
+    virtual ~PartialResult() {}
+
+    /**
+     * Returns the partial result of the multi-class confusion matrix algorithm
+     * \param[in] id    Identifier of the partial result, \ref PartialResultId
+     * \return          Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets the partial result of the multi-class confusion matrix algorithm
+     * \param[in] id    Identifier of the partial result, \ref PartialResultId
+     * \param[in] value Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Allocates memory for storing partial results of the quality metric algorithm
+     * \param[in] input     Pointer to the input objects structure
+     * \param[in] parameter Pointer to the parameter structure
+     * \param[in] method    Computation method of the algorithm
+     */
+    template<typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Initializes partial results of the quality metric algorithm with zero counts
+     * \param[in] input     Pointer to the input objects structure
+     * \param[in] parameter Pointer to the parameter structure
+     * \param[in] method    Computation method of the algorithm
+     */
+    template<typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Checks the correctness of the PartialResult object
+     * \param[in] input     Pointer to the structure of the input objects
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of the PartialResult object
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    services::Status check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__MULTICLASS_CONFUSION_MATRIX__RESULT"></a>
  * \brief Results obtained with the compute() method of the multi-class confusion matrix algorithm
- *        in the batch processing mode
+ *        in the batch processing mode or with the finalizeCompute() method in the online processing mode
  */
 class DAAL_EXPORT Result : public daal::algorithms::Result
 {
@@ -189,6 +275,15 @@ public:
     template<typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 
+    /**
+     * Allocates memory for storing final results of the quality metric algorithm in the online processing mode
+     * \param[in] partialResult Pointer to the partial result structure
+     * \param[in] parameter     Pointer to the parameter structure
+     * \param[in] method        Computation method of the algorithm
+     */
+    template<typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+
     /**
      * Checks the correctness of the Result object
      * \param[in] input     Pointer to the input structure
@@ -197,6 +292,14 @@ public:
      */
     services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
 
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] partialResult Pointer to the partial results
+     * \param[in] parameter     Pointer to the structure of the algorithm parameters
+     * \param[in] method        Computation method
+     */
+    services::Status check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
 protected:
     /** \private */
     template<typename Archive, bool onDeserialize>
@@ -215,6 +318,8 @@ typedef services::SharedPtr<Result> ResultPtr;
 } // namespace interface1
 using interface1::Parameter;
 using interface1::Input;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
 using interface1::Result;
 using interface1::ResultPtr;
 
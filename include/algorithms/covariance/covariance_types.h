@@ -103,6 +103,16 @@ enum OutputMatrixType
     correlationMatrix           /*!< Correlation matrix */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__COVARIANCE__OUTPUTMATRIXSTORAGE"></a>
+ * Available storage formats of the cross-product and the computed matrix for Covariance
+ */
+enum OutputMatrixStorage
+{
+    fullStorage,                /*!< Full square matrix stored in the homogeneous numeric table */
+    packedStorage               /*!< Upper triangle stored in the packed symmetric matrix. Takes half of the memory */
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__COVARIANCE__MASTERINPUTID"></a>
  * \brief Available identifiers of master node input arguments of the Covariance algorithm
@@ -267,7 +277,8 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
     /** Default constructor */
     Parameter();
-    OutputMatrixType outputMatrixType;      /*!< Type of the computed matrix */
+    OutputMatrixType outputMatrixType;          /*!< Type of the computed matrix */
+    OutputMatrixStorage outputMatrixStorage;    /*!< Storage format of the cross-product and the computed matrix */
 };
 
 /**
@@ -122,6 +122,15 @@ public:
     */
     virtual void traverseBF(size_t iTree, NodeVisitor& visitor) const = 0;
 
+    /**
+    *  Converts the model into the compact form used for prediction only.
+    *  Split values are replaced with indices of bins of per-feature bin edges and the trees are stored as arrays
+    *  of 8-byte nodes, numbers of observations and impurities of the nodes are not kept.
+    *  Traversal methods report the bin edges as the split values
+    *  \return Status of the conversion
+    */
+    virtual services::Status compact() = 0;
+
 protected:
     template<typename Archive, bool onDeserialize>
     void serialImpl(Archive *arch)
@@ -103,7 +103,8 @@ public:
         seed(77),
         impurityThreshold(0.),
         varImportance(none),
-        resultsToCompute(0) {}
+        resultsToCompute(0),
+        levelWiseTreeBuilding(false) {}
 
     size_t nTrees;                          /*!< Number of trees in the forest. Default is 10 */
     double observationsPerTreeFraction;     /*!< Fraction of observations used for a training of one tree, 0 to 1.
@@ -119,6 +120,10 @@ public:
                                                  than the threshold then the node is not split anymore.*/
     VariableImportanceMode varImportance;   /*!< Variable importance computation mode */
     DAAL_UINT64 resultsToCompute;           /*!< 64 bit integer flag that indicates the results to compute */
+    bool levelWiseTreeBuilding;             /*!< If true, each tree is built level by level with the splits of all nodes
+                                                 of a level searched in parallel. The random numbers are then consumed
+                                                 in another order, so the trained forest differs from the default
+                                                 depth-first building with the same seed. Default is false */
 };
 /* [Parameter source code] */
 } // namespace interface1
@@ -0,0 +1,192 @@
+/* file: kmeans_sweep_batch.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the K-Means sweep in the batch
+//  processing mode
+//--
+*/
+
+#ifndef __KMEANS_SWEEP_BATCH_H__
+#define __KMEANS_SWEEP_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/kmeans/kmeans_sweep_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace sweep
+{
+
+namespace interface1
+{
+/**
+ * @defgroup kmeans_sweep_batch Batch
+ * @ingroup kmeans_sweep
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__SWEEP__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the K-Means sweep.
+ *        This class is associated with the daal::algorithms::kmeans::sweep::Batch class
+ *        and supports the method of the K-Means sweep in the batch processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the K-Means sweep, double or float
+ * \tparam method           Computation method of the algorithm, \ref daal::algorithms::kmeans::sweep::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the K-Means sweep with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~BatchContainer();
+    /**
+     * Computes the result of the K-Means sweep in the batch processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__SWEEP__BATCH"></a>
+ * \brief Runs the K-Means algorithm for several numbers of clusters in the batch processing mode.
+ *        Iterations of the Lloyd method for all the numbers of clusters share the passes over the input data:
+ *        each block of observations is read once per iteration and multiplied by all the candidate centroids at once
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the K-Means sweep, double or float
+ * \tparam method           Computation method of the algorithm, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method              Computation methods for the K-Means sweep
+ *      - \ref InputId             Identifiers of input objects for the K-Means sweep
+ *      - \ref InputCollectionId   Identifiers of input collections for the K-Means sweep
+ *      - \ref ResultId            Identifiers of results of the K-Means sweep
+ *      - \ref ResultCollectionId  Identifiers of result collections of the K-Means sweep
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = lloydDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    /**
+     *  Main constructor
+     *  \param[in] nIterations Maximal number of iterations for each number of clusters
+     */
+    Batch(size_t nIterations = 1) : parameter(nIterations)
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the K-Means sweep by copying input objects and parameters
+     * of another K-Means sweep
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : parameter(other.parameter)
+    {
+        initialize();
+        input.set(data, other.input.get(data));
+        input.set(inputCentroids, other.input.get(inputCentroids));
+    }
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int) method; }
+
+    /**
+     * Returns the structure that contains the results of the K-Means sweep
+     * \return Structure that contains the results of the K-Means sweep
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the K-Means sweep
+     * \param[in] result  Structure to store the results of the K-Means sweep
+     */
+    services::Status setResult(const ResultPtr& result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated K-Means sweep with a copy of input objects
+     * and parameters of this K-Means sweep
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result = ResultPtr(new Result());
+        services::Status s = _result->allocate<algorithmFPType>(_in, _par, (int) method);
+        _res = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+    }
+
+public:
+    Input input;            /*!< %Input data structure */
+    Parameter parameter;    /*!< Parameters of the K-Means sweep */
+
+private:
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace daal::algorithms::kmeans::sweep
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
+#endif
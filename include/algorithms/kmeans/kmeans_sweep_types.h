@@ -0,0 +1,297 @@
+/* file: kmeans_sweep_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface of the K-Means algorithm
+//  that runs for several numbers of clusters simultaneously.
+//--
+*/
+
+#ifndef __KMEANS_SWEEP_TYPES_H__
+#define __KMEANS_SWEEP_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+/**
+ * @defgroup kmeans_sweep Sweep over the number of clusters
+ * \copydoc daal::algorithms::kmeans::sweep
+ * @ingroup kmeans
+ * @{
+ */
+/**
+ * \brief Contains classes of the K-Means algorithm that runs for several numbers of clusters simultaneously.
+ *        Each data block is read once per iteration for all the candidate sets of centroids
+ */
+namespace sweep
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__SWEEP__METHOD"></a>
+ * Available methods of the K-Means sweep
+ */
+enum Method
+{
+    lloydDense   = 0,  /*!< Default: Lloyd algorithm for dense numeric tables */
+    defaultDense = 0   /*!< Synonym of lloydDense */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__SWEEP__INPUTID"></a>
+ * \brief Available identifiers of input objects for the K-Means sweep
+ */
+enum InputId
+{
+    data,            /*!< %Input data table */
+    lastInputId = data
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__SWEEP__INPUTCOLLECTIONID"></a>
+ * \brief Available identifiers of input collections for the K-Means sweep
+ */
+enum InputCollectionId
+{
+    inputCentroids = lastInputId + 1,  /*!< Collection of tables with initial centroids, one table per number of clusters */
+    lastInputCollectionId = inputCentroids
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__SWEEP__RESULTID"></a>
+ * \brief Available identifiers of results of the K-Means sweep
+ */
+enum ResultId
+{
+    objectiveFunction,  /*!< Table containing objective function values, one row per number of clusters */
+    nIterations,        /*!< Table containing the numbers of executed iterations, one row per number of clusters */
+    lastResultId = nIterations
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__SWEEP__RESULTCOLLECTIONID"></a>
+ * \brief Available identifiers of result collections of the K-Means sweep
+ */
+enum ResultCollectionId
+{
+    centroids = lastResultId + 1,  /*!< Collection of tables with cluster centroids, one table per number of clusters */
+    lastResultCollectionId = centroids
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__KMEANS__SWEEP__PARAMETER"></a>
+ * \brief Parameters of the K-Means sweep.
+ *        Unlike kmeans::Batch, which moves the centroid of an empty cluster to the farthest observation,
+ *        the sweep keeps the centroid of an empty cluster unchanged
+ *
+ * \snippet kmeans/kmeans_sweep_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     *  Constructs parameters of the K-Means sweep
+     *  \param[in] _maxIterations Maximal number of iterations for each number of clusters
+     */
+    Parameter(size_t _maxIterations = 1);
+
+    /**
+     *  Constructs parameters of the K-Means sweep by copying another parameters of the K-Means sweep
+     *  \param[in] other    Parameters of the K-Means sweep
+     */
+    Parameter(const Parameter &other);
+
+    size_t maxIterations;       /*!< Maximal number of iterations for each number of clusters */
+    double accuracyThreshold;   /*!< Threshold for the termination of the algorithm for each number of clusters */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__SWEEP__INPUT"></a>
+ * \brief %Input objects for the K-Means sweep
+ */
+class DAAL_EXPORT Input : public daal::algorithms::Input
+{
+public:
+    Input();
+    virtual ~Input() {}
+
+    /**
+     * Returns an input object for the K-Means sweep
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Returns a collection of input objects for the K-Means sweep
+     * \param[in] id    Identifier of the input collection
+     * \return          %Input collection that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(InputCollectionId id) const;
+
+    /**
+     * Returns an element of the collection of input objects for the K-Means sweep
+     * \param[in] id    Identifier of the input collection
+     * \param[in] idx   Index of the element in the collection
+     * \return          %Input object that corresponds to the given identifier and index
+     */
+    data_management::NumericTablePtr get(InputCollectionId id, size_t idx) const;
+
+    /**
+     * Sets an input object for the K-Means sweep
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(InputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Sets a collection of input objects for the K-Means sweep
+     * \param[in] id    Identifier of the input collection
+     * \param[in] ptr   Pointer to the collection
+     */
+    void set(InputCollectionId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Adds the table of initial centroids for one more number of clusters to the input of the K-Means sweep
+     * \param[in] id    Identifier of the input collection
+     * \param[in] ptr   Pointer to the table
+     */
+    void add(InputCollectionId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Returns the number of features in the input object
+     * \return Number of features in the input object
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Checks input objects for the K-Means sweep
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method of the algorithm
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__SWEEP__RESULT"></a>
+ * \brief Results obtained with the compute() method of the K-Means sweep in the batch processing mode
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE();
+    Result();
+
+    virtual ~Result() {};
+
+    /**
+     * Allocates memory to store the results of the K-Means sweep
+     * \param[in] input     Pointer to the structure of the input objects
+     * \param[in] parameter Pointer to the structure of the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the result of the K-Means sweep
+     * \param[in] id   Result identifier
+     * \return         Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Returns the collection of results of the K-Means sweep
+     * \param[in] id   Identifier of the result collection
+     * \return         Result collection that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(ResultCollectionId id) const;
+
+    /**
+     * Returns an element of the collection of results of the K-Means sweep
+     * \param[in] id   Identifier of the result collection
+     * \param[in] idx  Index of the element in the collection, equal to the index of the table of initial centroids
+     * \return         Result that corresponds to the given identifier and index
+     */
+    data_management::NumericTablePtr get(ResultCollectionId id, size_t idx) const;
+
+    /**
+     * Sets the result of the K-Means sweep
+     * \param[in] id    Identifier of the result
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Sets the collection of results of the K-Means sweep
+     * \param[in] id    Identifier of the result collection
+     * \param[in] ptr   Pointer to the collection
+     */
+    void set(ResultCollectionId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Checks the result of the K-Means sweep
+     * \param[in] input   %Input objects for the algorithm
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+};
+typedef services::SharedPtr<Result> ResultPtr;
+
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace daal::algorithms::kmeans::sweep
+/** @} */
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
+#endif
@@ -147,6 +147,12 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     double gamma;                                          /*!< Weight used in distance computation for categorical features */
     DistanceType distanceType;                             /*!< Distance used in the algorithm */
     bool assignFlag;                                       /*!< Do data points assignment */
+    bool mixedPrecisionAssignment;                         /*!< If true and the algorithm computes in double precision,
+                                                                distances to centroids in the Lloyd iterations on dense data are
+                                                                computed in single precision, and near-ties are re-checked in double
+                                                                precision. Centroids and the objective function are the same as in
+                                                                double precision unless several centroids are equally distant
+                                                                from an observation */
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
@@ -68,7 +68,10 @@ enum InputId
 {
     data               = linear_model::training::data,               /*!< %Input data table */
     dependentVariables = linear_model::training::dependentVariables, /*!< Values of the dependent variable for the input data */
-    lastInputId = dependentVariables
+    removedData,                 /*!< Optional. Observations to remove from the partial model in the online processing mode.
+                                      Supported by the normal equations method only, rejected in the batch processing mode */
+    removedDependentVariables,   /*!< Optional. Values of the dependent variable for the observations to remove */
+    lastInputId = removedDependentVariables
 };
 
 /**
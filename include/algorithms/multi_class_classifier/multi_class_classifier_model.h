@@ -107,6 +107,14 @@ public:
      */
     Model(const ParameterBase *par);
 
+    /**
+     *  Constructs multi-class classifier model with the given number of two-class classifier models.
+     *  The oneAgainstRest training method stores an empty model pointer for a class without observations
+     *  \param[in] par     Parameters of the multi-class classifier algorithm
+     *  \param[in] nModels Number of two-class classifier models
+     */
+    Model(const ParameterBase *par, size_t nModels);
+
     /**
      * Empty constructor for deserialization
      */
@@ -140,7 +148,8 @@ public:
     /**
      *  Returns a two-class classifier model in a multi-class classifier model
      *  \param[in]  idx   Index of the two-class classifier model in a multi-class classifier model
-     *  \return             Two-class classifier model
+     *  \return             Two-class classifier model, empty for a class without observations
+     *                      if the model is trained with the oneAgainstRest method
      */
     classifier::ModelPtr getTwoClassClassifierModel(size_t idx) const;
 
@@ -48,7 +48,8 @@ namespace training
  */
 enum Method
 {
-    oneAgainstOne    = 0   /*!< One-against-one method */
+    oneAgainstOne    = 0,  /*!< One-against-one method */
+    oneAgainstRest   = 1   /*!< One-against-rest method: one two-class classifier per class trained on the whole data set */
 };
 
 /**
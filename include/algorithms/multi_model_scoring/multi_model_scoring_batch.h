@@ -0,0 +1,179 @@
+/* file: multi_model_scoring_batch.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface of the multi-model scoring in the batch
+//  processing mode
+//--
+*/
+
+#ifndef __MULTI_MODEL_SCORING_BATCH_H__
+#define __MULTI_MODEL_SCORING_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/multi_model_scoring/multi_model_scoring_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace multi_model_scoring
+{
+
+namespace interface1
+{
+/**
+ * @defgroup multi_model_scoring_batch Batch
+ * @ingroup multi_model_scoring
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTI_MODEL_SCORING__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the multi-model scoring.
+ *        This class is associated with the daal::algorithms::multi_model_scoring::Batch class
+ *        and supports the method of the multi-model scoring in the batch processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the multi-model scoring, double or float
+ * \tparam method           Computation method of the algorithm, \ref daal::algorithms::multi_model_scoring::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the multi-model scoring with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~BatchContainer();
+    /**
+     * Computes the result of the multi-model scoring in the batch processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTI_MODEL_SCORING__BATCH"></a>
+ * \brief Computes predictions of several trained models for the same input data in the batch processing mode.
+ *        Blocks of observations are processed in parallel, each block is read from the input table once
+ *        and all the models are applied to it while it stays in cache
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the multi-model scoring, double or float
+ * \tparam method           Computation method of the algorithm, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method              Computation methods of the multi-model scoring
+ *      - \ref InputId             Identifiers of input objects of the multi-model scoring
+ *      - \ref InputCollectionId   Identifiers of input collections of the multi-model scoring
+ *      - \ref ResultId            Identifiers of results of the multi-model scoring
+ */
+template<typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    Input input; /*!< %Input data structure */
+
+    /** Default constructor */
+    Batch()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the multi-model scoring by copying input objects of another multi-model scoring
+     * \param[in] other An algorithm to be used as the source to initialize the input objects of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : input(other.input)
+    {
+        initialize();
+    }
+
+    virtual ~Batch() {}
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the results of the multi-model scoring
+     * \return Structure that contains the results of the multi-model scoring
+     */
+    ResultPtr getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the multi-model scoring
+     * \param[in] result  Structure to store the results of the multi-model scoring
+     */
+    services::Status setResult(const ResultPtr &result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated multi-model scoring with a copy of input objects
+     * of this multi-model scoring
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Batch<algorithmFPType, method> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(&input, method);
+        _res = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _result = ResultPtr(new Result());
+    }
+
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace daal::algorithms::multi_model_scoring
+} // namespace daal::algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,233 @@
+/* file: multi_model_scoring_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface of the algorithm that scores
+//  the input data with several models in one pass.
+//--
+*/
+
+#ifndef __MULTI_MODEL_SCORING_TYPES_H__
+#define __MULTI_MODEL_SCORING_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * @defgroup multi_model_scoring Multi-Model Scoring
+ * \copydoc daal::algorithms::multi_model_scoring
+ * @ingroup analysis
+ * @{
+ */
+/**
+ * \brief Contains classes of the algorithm that computes predictions of several trained models
+ *        for the same input data. Each block of observations is read once and all the models are applied to it
+ */
+namespace multi_model_scoring
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__MULTI_MODEL_SCORING__METHOD"></a>
+ * Available methods of the multi-model scoring
+ */
+enum Method
+{
+    defaultDense = 0   /*!< Default: performance-oriented method for dense numeric tables */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__MULTI_MODEL_SCORING__INPUTID"></a>
+ * \brief Available identifiers of input objects of the multi-model scoring
+ */
+enum InputId
+{
+    data,            /*!< %Input data table */
+    lastInputId = data
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__MULTI_MODEL_SCORING__INPUTCOLLECTIONID"></a>
+ * \brief Available identifiers of input collections of the multi-model scoring
+ */
+enum InputCollectionId
+{
+    models = lastInputId + 1,  /*!< Collection of the models to apply. Supported elements are
+                                    decision_forest::classification::Model, decision_forest::regression::Model,
+                                    linear_model::Model and numeric tables of K-Means centroids */
+    lastInputCollectionId = models
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__MULTI_MODEL_SCORING__RESULTID"></a>
+ * \brief Available identifiers of results of the multi-model scoring
+ */
+enum ResultId
+{
+    prediction,      /*!< Table of predictions. Columns of the models follow in the order of the models in the collection:
+                          one column for a decision forest (class label or response) and for K-Means centroids (cluster index),
+                          as many columns as responses for a linear model */
+    lastResultId = prediction
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTI_MODEL_SCORING__INPUT"></a>
+ * \brief %Input objects of the multi-model scoring
+ */
+class DAAL_EXPORT Input : public daal::algorithms::Input
+{
+public:
+    Input();
+    Input(const Input& other);
+    virtual ~Input() {}
+
+    /**
+     * Returns an input object of the multi-model scoring
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Returns the collection of models of the multi-model scoring
+     * \param[in] id    Identifier of the input collection
+     * \return          %Input collection that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(InputCollectionId id) const;
+
+    /**
+     * Returns a model from the collection of models of the multi-model scoring
+     * \param[in] id    Identifier of the input collection
+     * \param[in] idx   Index of the model in the collection
+     * \return          Model that corresponds to the given identifier and index
+     */
+    data_management::SerializationIfacePtr get(InputCollectionId id, size_t idx) const;
+
+    /**
+     * Sets an input object of the multi-model scoring
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(InputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Sets the collection of models of the multi-model scoring
+     * \param[in] id    Identifier of the input collection
+     * \param[in] ptr   Pointer to the collection
+     */
+    void set(InputCollectionId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Adds a model to the collection of models of the multi-model scoring
+     * \param[in] id    Identifier of the input collection
+     * \param[in] ptr   Pointer to the model or to the numeric table of K-Means centroids
+     */
+    void add(InputCollectionId id, const data_management::SerializationIfacePtr &ptr);
+
+    /**
+     * Returns the number of columns in the table of predictions
+     * \return Total number of result columns of all the models
+     */
+    size_t getNumberOfResultColumns() const;
+
+    /**
+     * Checks input objects of the multi-model scoring
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method of the algorithm
+     */
+    services::Status check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTI_MODEL_SCORING__RESULT"></a>
+ * \brief Results obtained with the compute() method of the multi-model scoring in the batch processing mode
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE();
+    Result();
+
+    virtual ~Result() {};
+
+    /**
+     * Allocates memory to store the results of the multi-model scoring
+     * \param[in] input     Pointer to the structure of the input objects
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const int method);
+
+    /**
+     * Returns the result of the multi-model scoring
+     * \param[in] id   Result identifier
+     * \return         Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of the multi-model scoring
+     * \param[in] id    Identifier of the result
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks the result of the multi-model scoring
+     * \param[in] input   %Input objects for the algorithm
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method
+     */
+    services::Status check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+};
+typedef services::SharedPtr<Result> ResultPtr;
+
+} // namespace interface1
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace daal::algorithms::multi_model_scoring
+/** @} */
+} // namespace daal::algorithms
+} // namespace daal
+#endif
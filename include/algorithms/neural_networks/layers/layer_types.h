@@ -73,6 +73,17 @@ enum LayerResultLayout
     collectionResult,
     lastLayerResultLayout = collectionResult
 };
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__NEURAL_NETWORKS__LAYERS__VALUESTORAGETYPE"></a>
+ * Available types of storage of the value computed by the forward layer
+ */
+enum ValueStorageType
+{
+    defaultValueStorage  = 0, /*!< Value is stored in the floating-point type of the layer */
+    bfloat16ValueStorage = 1  /*!< Value is stored in bfloat16 and converted to the floating-point type of the layer on access.
+                                   Supported by the fully-connected, convolution, 2D pooling, ReLU and batch normalization layers */
+};
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -101,6 +112,8 @@ public:
     bool weightsAndBiasesInitialized;
     /** Flag specifying whether the layer can use inplace computations */
     bool allowInplaceComputation;
+    /** Type of storage of the value computed by the forward layer. Weights and biases are kept in the floating-point type of the layer */
+    ValueStorageType valueStorageType;
 };
 
 /**
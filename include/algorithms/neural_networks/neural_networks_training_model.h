@@ -64,11 +64,18 @@ public:
     /**
      * Constructs the parameters of neural network algorithm
      * \param[in] optimizationSolver_         Optimization solver used in the neural network
+     * \param[in] checkpointInterval_         Number of consecutive layers between the activation checkpoints
      */
-    Parameter(const services::SharedPtr<optimization_solver::iterative_solver::Batch > &optimizationSolver_) :
-        optimizationSolver(optimizationSolver_) {}
+    Parameter(const services::SharedPtr<optimization_solver::iterative_solver::Batch > &optimizationSolver_,
+              size_t checkpointInterval_ = 0) :
+        optimizationSolver(optimizationSolver_), checkpointInterval(checkpointInterval_) {}
 
     services::SharedPtr<optimization_solver::iterative_solver::Batch>  optimizationSolver; /*!< Optimization solver used in the neural network*/
+    size_t checkpointInterval; /*!< Number of consecutive layers between the activation checkpoints.
+                                    Forward results of the layers inside the segments between the checkpoints are released
+                                    after the forward pass and recomputed during the backward pass.
+                                    The value close to the square root of the number of layers minimizes the memory
+                                    used for the forward results. Zero value keeps all forward results */
 };
 
 /**
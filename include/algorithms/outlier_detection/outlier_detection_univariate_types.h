@@ -48,7 +48,9 @@ namespace univariate_outlier_detection
  */
 enum Method
 {
-    defaultDense = 0       /*!< Default: performance-oriented method */
+    defaultDense = 0,      /*!< Default: performance-oriented method */
+    medianDense  = 1       /*!< Method that estimates the location and the scatter that are not provided
+                                with the medians and the scaled median absolute deviations of the features */
 };
 
 /**
@@ -58,9 +60,13 @@ enum Method
 enum InputId
 {
     data      , /*!< %Input data table */
-    location  , /*!< Vector of mean estimates of size 1 x p */
-    scatter   , /*!< Measure of spread, the array of standard deviations of size 1 x p */
-    threshold , /*!< Limit that defines the outlier region, the array of non-negative numbers of size 1 x p */
+    location  , /*!< Vector of mean estimates of size 1 x p. If not provided, 0 is used by the defaultDense method
+                     and the medians of the features are used by the medianDense method */
+    scatter   , /*!< Measure of spread, the array of standard deviations of size 1 x p. If not provided, 1 is used
+                     by the defaultDense method and the scaled median absolute deviations from the location are used
+                     by the medianDense method */
+    threshold , /*!< Limit that defines the outlier region, the array of non-negative numbers of size 1 x p.
+                     If not provided, 3 is used */
     lastInputId = threshold
 };
 
@@ -63,6 +63,8 @@
 #include "algorithms/kmeans/kmeans_init_types.h"
 #include "algorithms/kmeans/kmeans_init_batch.h"
 #include "algorithms/kmeans/kmeans_init_distributed.h"
+#include "algorithms/kmeans/kmeans_sweep_types.h"
+#include "algorithms/kmeans/kmeans_sweep_batch.h"
 #include "algorithms/naive_bayes/multinomial_naive_bayes_training_batch.h"
 #include "algorithms/naive_bayes/multinomial_naive_bayes_training_online.h"
 #include "algorithms/naive_bayes/multinomial_naive_bayes_training_distributed.h"
@@ -334,6 +336,8 @@
 #include "algorithms/regression/regression_predict.h"
 #include "algorithms/linear_model/linear_model_training_batch.h"
 #include "algorithms/linear_model/linear_model_predict.h"
+#include "algorithms/multi_model_scoring/multi_model_scoring_types.h"
+#include "algorithms/multi_model_scoring/multi_model_scoring_batch.h"
 #include "algorithms/distributions/distribution.h"
 #include "algorithms/distributions/distribution_types.h"
 #include "algorithms/distributions/uniform/uniform.h"
@@ -33,6 +33,48 @@ namespace daal
 {
 namespace data_management
 {
+/**
+ * <a name="DAAL-STRUCT-DATA_MANAGEMENT__BFLOAT16"></a>
+ * \brief 16-bit floating-point number that keeps the sign, the exponent and the 7 upper bits of the mantissa
+ *        of the single precision number. Used as a storage type, computations are performed in single or double precision
+ */
+struct bfloat16
+{
+    unsigned short bits; /*!< Upper 16 bits of the single precision number */
+
+    bfloat16() : bits(0) {}
+
+    /**
+     * Constructs the number from the single precision number rounded to the nearest even
+     * \param[in] value  Single precision number
+     */
+    bfloat16(float value)
+    {
+        union { float f; unsigned int u; } src;
+        src.f = value;
+        if ((src.u & 0x7fffffffu) > 0x7f800000u)
+        {
+            /* Keep NaN quiet, as truncation may turn it into infinity */
+            bits = (unsigned short)((src.u >> 16) | 0x40u);
+        }
+        else
+        {
+            bits = (unsigned short)((src.u + 0x7fffu + ((src.u >> 16) & 1u)) >> 16);
+        }
+    }
+
+    /**
+     * Returns the value of the number in single precision
+     * \return Single precision number
+     */
+    operator float() const
+    {
+        union { float f; unsigned int u; } dst;
+        dst.u = ((unsigned int)bits) << 16;
+        return dst.f;
+    }
+};
+
 /**
  * \brief Contains classes for Intel(R) Data Analytics Acceleration Library numeric types
  */
@@ -54,9 +96,10 @@ enum IndexNumType
     DAAL_INT8_U  = 7,
     DAAL_INT16_S = 8,
     DAAL_INT16_U = 9,
-    DAAL_OTHER_T = 10
+    DAAL_OTHER_T = 10,
+    DAAL_BFLOAT16 = 11  /* Follows DAAL_OTHER_T to keep the values stored in the serialized data dictionaries */
 };
-const int NumOfIndexNumTypes = (int)DAAL_OTHER_T;
+const int NumOfIndexNumTypes = (int)DAAL_BFLOAT16 + 1;
 
 enum InternalNumType  { DAAL_SINGLE = 0, DAAL_DOUBLE = 1, DAAL_INT32 = 2, DAAL_OTHER = 0xfffffff };
 enum PMMLNumType      { DAAL_GEN_FLOAT = 0, DAAL_GEN_DOUBLE = 1, DAAL_GEN_INTEGER = 2, DAAL_GEN_BOOLEAN = 3,
@@ -79,6 +122,7 @@ template<> inline IndexNumType getIndexNumType<char>()             { return DAAL
 template<> inline IndexNumType getIndexNumType<unsigned char>()    { return DAAL_INT8_U;  }
 template<> inline IndexNumType getIndexNumType<short>()            { return DAAL_INT16_S; }
 template<> inline IndexNumType getIndexNumType<unsigned short>()   { return DAAL_INT16_U; }
+template<> inline IndexNumType getIndexNumType<bfloat16>()         { return DAAL_BFLOAT16; }
 
 template<> inline IndexNumType getIndexNumType<long>()
 { return (IndexNumType)(DAAL_INT32_S + (sizeof(long) / 4 - 1) * 2); }
@@ -166,6 +210,47 @@ DAAL_EXPORT data_feature_utils::vectorConvertFuncType getVectorDownCast(int, int
 DAAL_EXPORT data_feature_utils::vectorStrideConvertFuncType getVectorStrideUpCast(int, int);
 DAAL_EXPORT data_feature_utils::vectorStrideConvertFuncType getVectorStrideDownCast(int, int);
 
+/**
+ * Storage formats of the packed matrices supported by unpackRows() and packRows()
+ */
+enum PackedMatrixType
+{
+    DAAL_UPPER_PACKED_SYMMETRIC  = 0, /*!< Upper triangle of the symmetric matrix stored by rows */
+    DAAL_LOWER_PACKED_SYMMETRIC  = 1, /*!< Lower triangle of the symmetric matrix stored by rows */
+    DAAL_UPPER_PACKED_TRIANGULAR = 2, /*!< Upper triangular matrix stored by rows */
+    DAAL_LOWER_PACKED_TRIANGULAR = 3  /*!< Lower triangular matrix stored by rows */
+};
+
+/**
+ * Copies the rows of the packed matrix into the row-major buffer
+ * \param[in]  type        Storage format of the packed matrix
+ * \param[in]  nDim        Matrix dimension
+ * \param[in]  rowOffset   Index of the first row to copy
+ * \param[in]  nRows       Number of rows to copy
+ * \param[in]  packed      Packed array
+ * \param[in]  packedType  Type of the elements of the packed array
+ * \param[out] rows        Buffer of size nRows x nDim
+ * \param[in]  rowsType    Type of the elements of the buffer
+ */
+DAAL_EXPORT void unpackRows(PackedMatrixType type, size_t nDim, size_t rowOffset, size_t nRows,
+                            const void *packed, IndexNumType packedType, void *rows, InternalNumType rowsType);
+
+/**
+ * Copies the rows of the row-major buffer into the packed matrix.
+ * For symmetric matrices an element is taken from the row that comes later in the buffer
+ * if both of its symmetric positions are in the buffer
+ * \param[in]  type        Storage format of the packed matrix
+ * \param[in]  nDim        Matrix dimension
+ * \param[in]  rowOffset   Index of the first row to copy
+ * \param[in]  nRows       Number of rows to copy
+ * \param[in]  rows        Buffer of size nRows x nDim
+ * \param[in]  rowsType    Type of the elements of the buffer
+ * \param[out] packed      Packed array
+ * \param[in]  packedType  Type of the elements of the packed array
+ */
+DAAL_EXPORT void packRows(PackedMatrixType type, size_t nDim, size_t rowOffset, size_t nRows,
+                          const void *rows, InternalNumType rowsType, void *packed, IndexNumType packedType);
+
 /** @} */
 
 } // namespace data_feature_utils
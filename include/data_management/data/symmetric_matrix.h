@@ -602,6 +602,11 @@ private:
     }
 
 protected:
+    static data_feature_utils::PackedMatrixType getPackedMatrixType()
+    {
+        return (packedLayout == upperPackedSymmetricMatrix ? data_feature_utils::DAAL_UPPER_PACKED_SYMMETRIC : data_feature_utils::DAAL_LOWER_PACKED_SYMMETRIC);
+    }
+
     baseDataType &getBaseValue( size_t dim, size_t rowIdx, size_t colIdx )
     {
         size_t rowStartOffset, colStartOffset;
@@ -670,6 +675,14 @@ protected:
         {
             T *buffer = block.getBlockPtr();
 
+            if( data_feature_utils::getIndexNumType<DataType>() != data_feature_utils::DAAL_OTHER_T )
+            {
+                data_feature_utils::unpackRows( getPackedMatrixType(), nDim, idx, nrows, _ptr.get(),
+                                                data_feature_utils::getIndexNumType<DataType>(), buffer,
+                                                data_feature_utils::getInternalNumType<T>() );
+                return services::Status();
+            }
+
             for(size_t iRow = 0; iRow < nrows; iRow++)
             {
                 for(size_t iCol = 0; iCol < nDim; iCol++)
@@ -692,6 +705,15 @@ protected:
             size_t idx = block.getRowsOffset();
             T     *buffer = block.getBlockPtr();
 
+            if( data_feature_utils::getIndexNumType<DataType>() != data_feature_utils::DAAL_OTHER_T )
+            {
+                data_feature_utils::packRows( getPackedMatrixType(), nDim, idx, nrows, buffer,
+                                              data_feature_utils::getInternalNumType<T>(), _ptr.get(),
+                                              data_feature_utils::getIndexNumType<DataType>() );
+                block.reset();
+                return s;
+            }
+
             for( size_t iRow = 0; iRow < nrows; iRow++ )
             {
                 for( size_t iCol = 0; iCol < nDim; iCol++ )
@@ -1345,6 +1367,11 @@ private:
     }
 
 protected:
+    static data_feature_utils::PackedMatrixType getPackedMatrixType()
+    {
+        return (packedLayout == upperPackedTriangularMatrix ? data_feature_utils::DAAL_UPPER_PACKED_TRIANGULAR : data_feature_utils::DAAL_LOWER_PACKED_TRIANGULAR);
+    }
+
     baseDataType &getBaseValue( size_t dim, size_t rowIdx, size_t colIdx, baseDataType &zero )
     {
         size_t rowStartOffset, colStartOffset;
@@ -1409,6 +1436,14 @@ protected:
         {
             T *buffer = block.getBlockPtr();
 
+            if( data_feature_utils::getIndexNumType<DataType>() != data_feature_utils::DAAL_OTHER_T )
+            {
+                data_feature_utils::unpackRows( getPackedMatrixType(), nDim, idx, nrows, _ptr.get(),
+                                                data_feature_utils::getIndexNumType<DataType>(), buffer,
+                                                data_feature_utils::getInternalNumType<T>() );
+                return services::Status();
+            }
+
             for(size_t iRow = 0; iRow < nrows; iRow++)
             {
                 for(size_t iCol = 0; iCol < nDim; iCol++)
@@ -1431,6 +1466,15 @@ protected:
             size_t idx = block.getRowsOffset();
             T     *buffer = block.getBlockPtr();
 
+            if( data_feature_utils::getIndexNumType<DataType>() != data_feature_utils::DAAL_OTHER_T )
+            {
+                data_feature_utils::packRows( getPackedMatrixType(), nDim, idx, nrows, buffer,
+                                              data_feature_utils::getInternalNumType<T>(), _ptr.get(),
+                                              data_feature_utils::getIndexNumType<DataType>() );
+                block.reset();
+                return s;
+            }
+
             for( size_t iRow = 0; iRow < nrows; iRow++ )
             {
                 for( size_t iCol = 0; iCol < nDim; iCol++ )
@@ -27,6 +27,10 @@
 #include "services/daal_defines.h"
 #include "services/daal_memory.h"
 
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
 namespace daal
 {
 namespace services
@@ -94,10 +98,64 @@ private:
 };
 
 
+/**
+ * <a name="DAAL-CLASS-SERVICES__INLINEATOMICINT"></a>
+ * \brief Atomic integer stored in the object itself with the operations inlined into the caller.
+ *        Unlike Atomic, it does not allocate memory and does not call the library
+ */
+class InlineAtomicInt
+{
+public:
+    /**
+     * Constructs an atomic integer from a value
+     * \param[in] value The value to be assigned to the atomic integer
+     */
+    InlineAtomicInt(int value = 0) : _value(value) {}
+
+    /**
+     * Returns an increment of the atomic integer
+     * \return An increment of the atomic integer
+     */
+    int inc()
+    {
+#if defined(_MSC_VER)
+        return (int)_InterlockedIncrement(&_value);
+#else
+        return (int)__sync_add_and_fetch(&_value, 1);
+#endif
+    }
+
+    /**
+     * Returns a decrement of the atomic integer
+     * \return A decrement of the atomic integer
+     */
+    int dec()
+    {
+#if defined(_MSC_VER)
+        return (int)_InterlockedDecrement(&_value);
+#else
+        return (int)__sync_sub_and_fetch(&_value, 1);
+#endif
+    }
+
+    /**
+     * Returns the value of the atomic integer
+     * \return The value of the atomic integer
+     */
+    int get() const { return (int)_value; }
+
+private:
+    volatile long _value;
+
+    InlineAtomicInt(const InlineAtomicInt &);
+    InlineAtomicInt &operator=(const InlineAtomicInt &);
+};
+
 /** @} */
 
 } // namespace interface1
 using interface1::Atomic;
+using interface1::InlineAtomicInt;
 
 typedef Atomic<int> AtomicInt;
 
@@ -44,6 +44,11 @@
   #define DAAL_C11_OVERRIDE
 #endif
 
+/* Rvalue references and variadic templates are available */
+#if (defined(__INTEL_CXX11_MODE__) || __cplusplus > 199711L || (defined(_MSC_VER) && _MSC_VER >= 1800))
+  #define DAAL_C11_FEATURES
+#endif
+
 /* Intel(R) DAAL 64-bit integer types */
 #if (!defined(__INTEL_COMPILER)) & defined(_MSC_VER)
   #define DAAL_INT64 __int64
@@ -218,10 +223,13 @@ const int SERIALIZATION_KMEANS_INIT_STEP4LOCAL_PP_PARTIAL_RESULT_ID
 const int SERIALIZATION_KMEANS_INIT_STEP5MASTER_PP_PARTIAL_RESULT_ID                           = 101240;
 
 const int SERIALIZATION_KMEANS_INIT_RESULT_ID                                                  = 101300;
+const int SERIALIZATION_KMEANS_SWEEP_RESULT_ID                                                 = 101310;
 
 const int SERIALIZATION_CLASSIFIER_TRAINING_PARTIAL_RESULT_ID                                  = 101400;
 const int SERIALIZATION_CLASSIFIER_BINARY_CONFUSION_MATRIX_RESULT_ID                           = 101410;
+const int SERIALIZATION_CLASSIFIER_BINARY_CONFUSION_MATRIX_PARTIAL_RESULT_ID                   = 101411;
 const int SERIALIZATION_CLASSIFIER_MULTICLASS_CONFUSION_MATRIX_RESULT_ID                       = 101420;
+const int SERIALIZATION_CLASSIFIER_MULTICLASS_CONFUSION_MATRIX_PARTIAL_RESULT_ID               = 101421;
 const int SERIALIZATION_CLASSIFIER_PREDICTION_RESULT_ID                                        = 101430;
 const int SERIALIZATION_CLASSIFIER_TRAINING_RESULT_ID                                          = 101440;
 
@@ -395,6 +403,8 @@ const int SERIALIZATION_REGRESSION_PREDICTION_RESULT_ID
 
 const int SERIALIZATION_LM_TRAINING_RESULT_ID                                                  = 109100;
 const int SERIALIZATION_LM_PREDICTION_RESULT_ID                                                = 109120;
+
+const int SERIALIZATION_MULTI_MODEL_SCORING_RESULT_ID                                         = 109200;
 };
 
 #define DAAL_NEW_DELETE()                                \
@@ -60,6 +60,25 @@ DAAL_EXPORT void  daal_free(void *ptr);
  * \param[in]  count              Number of bytes to copy.
  */
 DAAL_EXPORT void  daal_memcpy_s(void *dest, size_t numberOfElements, const void *src, size_t count);
+
+/**
+ * <a name="DAAL-ENUM-SERVICES__LARGEALLOCATIONFLAG"></a>
+ * Flags of the policy applied to large blocks of memory allocated by daal_malloc
+ */
+enum LargeAllocationFlag
+{
+    largeAllocationDefault   = 0,   /*!< Large blocks are allocated as any other blocks */
+    largeAllocationHugePages = 1,   /*!< Large blocks are aligned to 2 MB and backed by transparent huge pages where the OS supports them */
+    largeAllocationPrefault  = 2    /*!< Pages of large blocks are touched in parallel right after the allocation */
+};
+
+/**
+ * Sets the policy applied to the blocks of memory allocated by daal_malloc, including the memory
+ * of numeric tables and the buffers of the algorithms
+ * \param[in] flags    Combination of \ref LargeAllocationFlag values
+ * \param[in] minSize  Minimal size of the block of memory in bytes the policy is applied to
+ */
+DAAL_EXPORT void  daal_set_large_allocation_policy(int flags, size_t minSize = 64 * 1024 * 1024);
 /** @} */
 
 DAAL_EXPORT float daal_string_to_float(const char * nptr, char ** endptr);
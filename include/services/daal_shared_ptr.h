@@ -24,6 +24,7 @@
 #ifndef __DAAL_SHARED_PTR_H__
 #define __DAAL_SHARED_PTR_H__
 
+#include <new>
 #include "services/base.h"
 #include "services/daal_memory.h"
 #include "services/error_id.h"
@@ -112,13 +113,13 @@ public:
  * \brief Implementation of reference counter
  *
  */
-class DAAL_EXPORT RefCounter: public AtomicInt
+class DAAL_EXPORT RefCounter: public InlineAtomicInt
 {
 public:
     /**
      * Default constructor
      */
-    RefCounter() : AtomicInt(1){}
+    RefCounter() : InlineAtomicInt(1){}
     /** Destructor */
     virtual ~RefCounter() {}
     virtual void operator() (const void *ptr) = 0;
@@ -149,6 +150,43 @@ protected:
     Deleter _deleter;
 };
 
+/**
+ * <a name="DAAL-CLASS-SERVICES__REFCOUNTEROBJECT"></a>
+ * \brief Reference counter that stores the managed object in the same block of memory.
+ *        Used by makeShared to allocate the object and its reference counter at once
+ *
+ * \tparam T    Class of the managed object
+ */
+template<class T>
+class RefCounterObject: public RefCounter
+{
+public:
+    DAAL_NEW_DELETE();
+
+    /** Default constructor */
+    RefCounterObject() {}
+    /** Destructor. The managed object is destroyed by operator() before */
+    virtual ~RefCounterObject() {}
+
+    /**
+     * Returns a pointer to the memory reserved for the managed object
+     * \return Pointer to the memory aligned to DAAL_MALLOC_DEFAULT_ALIGNMENT
+     */
+    void *storage()
+    {
+        const size_t address = (size_t)_storage;
+        return (void *)((address + DAAL_MALLOC_DEFAULT_ALIGNMENT - 1) & ~(DAAL_MALLOC_DEFAULT_ALIGNMENT - 1));
+    }
+
+    void operator() (const void *ptr) DAAL_C11_OVERRIDE
+    {
+        ((const T *)ptr)->~T();
+    }
+
+private:
+    char _storage[sizeof(T) + DAAL_MALLOC_DEFAULT_ALIGNMENT];
+};
+
 /**
  * <a name="DAAL-CLASS-SERVICES__SHAREDPTR"></a>
  * \brief Shared pointer that retains shared ownership of an object through a pointer.
@@ -204,6 +242,53 @@ public:
 
     SharedPtr(const SharedPtr<T> &ptr, T* shiftedPtr);
 
+#if defined(DAAL_C11_FEATURES)
+    /**
+     * Constructs a shared pointer by taking the ownership from another shared pointer
+     * without changing the reference count. The input shared pointer becomes empty
+     * \param[in] other   Input shared pointer
+     */
+    SharedPtr(SharedPtr<T> &&other) : _ownedPtr(other._ownedPtr), _ptr(other._ptr), _refCount(other._refCount)
+    {
+        other._ownedPtr = NULL;
+        other._ptr = NULL;
+        other._refCount = NULL;
+    }
+
+    /**
+     * Constructs a shared pointer by taking the ownership from a shared pointer of another type
+     * without changing the reference count. The input shared pointer becomes empty
+     * \param[in] other   Input shared pointer
+     */
+    template<class U>
+    SharedPtr(SharedPtr<U> &&other) : _ownedPtr(other._ownedPtr), _ptr(other._ptr), _refCount(other._refCount)
+    {
+        other._ownedPtr = NULL;
+        other._ptr = NULL;
+        other._refCount = NULL;
+    }
+
+    /**
+     * Takes the ownership from an input shared pointer without changing its reference count.
+     * The input shared pointer becomes empty
+     * \param[in] other   Shared pointer to move
+     */
+    SharedPtr<T> &operator=(SharedPtr<T> &&other)
+    {
+        if (&other != this)
+        {
+            _remove();
+            _ownedPtr = other._ownedPtr;
+            _refCount = other._refCount;
+            _ptr = other._ptr;
+            other._ownedPtr = NULL;
+            other._ptr = NULL;
+            other._refCount = NULL;
+        }
+        return *this;
+    }
+#endif
+
     /**
     * Constructs a shared pointer from another shared pointer of the same type
     * \param[in] other   Input shared pointer
@@ -332,6 +417,9 @@ protected:
     void _remove();
 
     template<class U> friend class SharedPtr;
+#if defined(DAAL_C11_FEATURES)
+    template<class U, class... Args> friend SharedPtr<U> makeShared(Args&&... args);
+#endif
 }; // class SharedPtr
 
 template<class T>
@@ -416,6 +504,29 @@ void SharedPtr<T>::reset(U* ptr, const D& deleter)
     }
 }
 
+#if defined(DAAL_C11_FEATURES)
+/**
+ * Creates an object and the shared pointer that manages it. The object and its reference counter
+ * are placed in one block of memory allocated at once
+ * \tparam T       Class of the managed object
+ * \param[in] args  Arguments of the constructor of the object
+ * \return Shared pointer to the created object, empty if the memory allocation failed
+ */
+template<class T, class... Args>
+SharedPtr<T> makeShared(Args&&... args)
+{
+    SharedPtr<T> result;
+    RefCounterObject<T> *refCount = new RefCounterObject<T>();
+    if (!refCount)
+        return result;
+    T *ptr = new (refCount->storage()) T(static_cast<Args&&>(args)...);
+    result._ownedPtr = ptr;
+    result._ptr = ptr;
+    result._refCount = refCount;
+    return result;
+}
+#endif
+
 /**
  * Creates a new instance of SharedPtr whose managed object type is obtained from the type of the managed object of r
  * using a cast expression. Both shared pointers share ownership of the managed object.
@@ -468,6 +579,9 @@ using interface1::ObjectDeleter;
 using interface1::EmptyDeleter;
 using interface1::ServiceDeleter;
 using interface1::SharedPtr;
+#if defined(DAAL_C11_FEATURES)
+using interface1::makeShared;
+#endif
 using interface1::staticPointerCast;
 using interface1::dynamicPointerCast;
 using interface1::reinterpretPointerCast;
@@ -26,6 +26,7 @@
 
 #include "services/base.h"
 #include "services/daal_defines.h"
+#include "services/error_handling.h"
 
 namespace daal
 {
@@ -155,6 +156,60 @@ public:
      */
     int setMemoryLimit(MemType type, size_t limit);
 
+    /**
+     * <a name="DAAL-ENUM-SERVICES__TUNINGPARAMETERID"></a>
+     * Identifiers of the tuned parameters of the computational kernels
+     */
+    enum TuningParameterId
+    {
+        kmeansBlockSize          = 0,   /*!< Number of observations processed at once by the K-Means Lloyd step */
+        mseBlockSize             = 1,   /*!< Number of observations processed at once by the mean squared error objective function */
+        momentsBlockSize         = 2,   /*!< Number of observations processed at once by the dense low order moments */
+        dfPredictionBlockSize    = 3,   /*!< Number of observations processed at once by the decision forest prediction */
+        layersMinElementsInBlock = 4,   /*!< Minimal number of tensor elements in one parallel task of the neural network layers */
+        lastTuningParameterId = layersMinElementsInBlock
+    };
+
+    /**
+     *  Returns the value of the tuned parameter used by the kernels optimized for the given processor type.
+     *  On the first call the values are chosen from the detected cache sizes and then overridden
+     *  by the values from the file specified in the DAAL_TUNING_FILE environment variable, if it is set
+     *  \param[in] id   Identifier of the tuned parameter
+     *  \param[in] cpu  Processor type
+     *  \return Value of the tuned parameter, or 0 if the identifier or the processor type is out of range
+     */
+    size_t getTuningParameter(TuningParameterId id, CpuType cpu) const;
+
+    /**
+     *  Sets the value of the tuned parameter used by the kernels optimized for the given processor type
+     *  \param[in] id     Identifier of the tuned parameter
+     *  \param[in] cpu    Processor type
+     *  \param[in] value  Value of the tuned parameter, must be positive
+     *  \return Status of the operation
+     */
+    services::Status setTuningParameter(TuningParameterId id, CpuType cpu, size_t value);
+
+    /**
+     *  Chooses the values of all tuned parameters from the cache sizes of the processor the library runs on
+     */
+    void calibrateTuningParameters();
+
+    /**
+     *  Loads the values of tuned parameters from the text file written by saveTuningParameters().
+     *  Parameters that are not listed in the file keep their values
+     *  \param[in] fileName  Name of the file
+     *  \return Status of the operation
+     */
+    services::Status loadTuningParameters(const char *fileName);
+
+    /**
+     *  Saves the values of all tuned parameters to the text file.
+     *  Each line of the file contains the processor type, the parameter name and its value
+     *  \param[in] fileName  Name of the file
+     *  \return Status of the operation
+     */
+    services::Status saveTuningParameters(const char *fileName) const;
+
 private:
     Environment();
     Environment(const Environment &e);
@@ -25,6 +25,76 @@
 using namespace daal;
 using namespace daal::data_management;
 
+namespace
+{
+
+/**
+ *  Deleter that keeps a direct ByteBuffer reachable from Java while a native table uses its memory
+ */
+class DirectBufferDeleter : public services::DeleterIface
+{
+public:
+    DirectBufferDeleter(JavaVM *jvm, jobject byteBuffer) : _jvm(jvm), _byteBuffer(byteBuffer) {}
+
+    void operator() (const void *ptr) DAAL_C11_OVERRIDE
+    {
+        JNIEnv *env = NULL;
+        if(_jvm->GetEnv((void **)&env, JNI_VERSION_1_2) == JNI_OK ||
+           _jvm->AttachCurrentThreadAsDaemon((void **)&env, NULL) == JNI_OK)
+        {
+            env->DeleteGlobalRef(_byteBuffer);
+        }
+    }
+
+private:
+    JavaVM *_jvm;
+    jobject _byteBuffer;
+};
+
+/**
+ *  Creates homogeneous numeric table that uses memory of the direct ByteBuffer in place
+ */
+template<typename T>
+jlong initDirect(JNIEnv *env, jobject byteBuffer, jlong nColumns, jlong nRows, jint featuresEqual)
+{
+    T *data = (T *)(env->GetDirectBufferAddress(byteBuffer));
+    const jlong capacity = env->GetDirectBufferCapacity(byteBuffer);
+    if(data == NULL || capacity < 0 || (size_t)capacity < (size_t)nColumns * (size_t)nRows * sizeof(T))
+    {
+        env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "Direct ByteBuffer of sufficient capacity is expected");
+        return 0;
+    }
+
+    JavaVM *jvm = NULL;
+    env->GetJavaVM(&jvm);
+    jobject byteBufferRef = env->NewGlobalRef(byteBuffer);
+
+    services::SharedPtr<T> dataPtr(data, DirectBufferDeleter(jvm, byteBufferRef));
+    HomogenNumericTable<T> *tbl = new HomogenNumericTable<T>((DictionaryIface::FeaturesEqual)featuresEqual, dataPtr,
+                                                             (size_t)nColumns, (size_t)nRows);
+    SerializationIfacePtr *sPtr = new SerializationIfacePtr(tbl);
+    if(tbl->getErrors()->size() > 0)
+    {
+        env->ThrowNew(env->FindClass("java/lang/Exception"), tbl->getErrors()->getDescription());
+    }
+    return (jlong)sPtr;
+}
+
+/**
+ *  Copies the values between table block and the direct ByteBuffer.
+ *  The copy is skipped when the buffer already wraps the block memory
+ */
+template<typename T>
+void copyBuffer(T *dst, const T *src, size_t n)
+{
+    if(dst != src && n > 0)
+    {
+        services::daal_memcpy_s(dst, n * sizeof(T), src, n * sizeof(T));
+    }
+}
+
+} // namespace
+
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    getIndexType
@@ -107,6 +177,50 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumeric
     return (jlong)sPtr;
 }
 
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    dInitDirect
+ * Signature:(Ljava/nio/ByteBuffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_dInitDirect
+(JNIEnv *env, jobject thisobj, jobject byteBuffer, jlong nColumns, jlong nRows, jint featuresEqual)
+{
+    return initDirect<double>(env, byteBuffer, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    sInitDirect
+ * Signature:(Ljava/nio/ByteBuffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_sInitDirect
+(JNIEnv *env, jobject thisobj, jobject byteBuffer, jlong nColumns, jlong nRows, jint featuresEqual)
+{
+    return initDirect<float>(env, byteBuffer, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    lInitDirect
+ * Signature:(Ljava/nio/ByteBuffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_lInitDirect
+(JNIEnv *env, jobject thisobj, jobject byteBuffer, jlong nColumns, jlong nRows, jint featuresEqual)
+{
+    return initDirect<__int64>(env, byteBuffer, nColumns, nRows, featuresEqual);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    iInitDirect
+ * Signature:(Ljava/nio/ByteBuffer;JJI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_iInitDirect
+(JNIEnv *env, jobject thisobj, jobject byteBuffer, jlong nColumns, jlong nRows, jint featuresEqual)
+{
+    return initDirect<int>(env, byteBuffer, nColumns, nRows, featuresEqual);
+}
+
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    getDoubleBuffer
@@ -200,10 +314,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
     float* data = block.getBlockPtr();
     const float *src = (float *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum * nCols; i++)
-    {
-        data[i] = src[i];
-    }
+    copyBuffer(data, src, vectorNum * nCols);
 
     DAAL_CHECK_THROW(nt->releaseBlockOfRows(block));
 }
@@ -225,10 +336,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
     double *data = block.getBlockPtr();
     const double *src = (double *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum * nCols; i++)
-    {
-        data[i] = src[i];
-    }
+    copyBuffer(data, src, vectorNum * nCols);
 
     DAAL_CHECK_THROW(nt->releaseBlockOfRows(block));
 }
@@ -250,10 +358,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
     int* data = block.getBlockPtr();
     const int *src = (int *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum * nCols; i++)
-    {
-        data[i] = src[i];
-    }
+    copyBuffer(data, src, vectorNum * nCols);
 
     DAAL_CHECK_THROW(nt->releaseBlockOfRows(block));
 }
@@ -275,10 +380,7 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
     const double *data = block.getBlockPtr();
     double *dst = (double *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum * nCols; i++)
-    {
-        dst[i] = data[i];
-    }
+    copyBuffer(dst, data, vectorNum * nCols);
 
     DAAL_CHECK_THROW(nt->releaseBlockOfRows(block));
     return byteBuffer;
@@ -302,10 +404,7 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
 
     float *dst = (float *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum * nCols; i++)
-    {
-        dst[i] = data[i];
-    }
+    copyBuffer(dst, data, vectorNum * nCols);
 
     DAAL_CHECK_THROW(nt->releaseBlockOfRows(block));
     return byteBuffer;
@@ -329,10 +428,7 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
 
     int *dst = (int *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum * nCols; i++)
-    {
-        dst[i] = data[i];
-    }
+    copyBuffer(dst, data, vectorNum * nCols);
 
     DAAL_CHECK_THROW(nt->releaseBlockOfRows(block));
     return byteBuffer;
@@ -356,10 +452,7 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
 
     double *dst = (double *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum; i++)
-    {
-        dst[i] = data[i];
-    }
+    copyBuffer(dst, data, vectorNum);
 
     DAAL_CHECK_THROW(nt->releaseBlockOfColumnValues(block));
     return byteBuffer;
@@ -383,10 +476,7 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
 
     float *dst = (float *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum; i++)
-    {
-        dst[i] = data[i];
-    }
+    copyBuffer(dst, data, vectorNum);
 
     DAAL_CHECK_THROW(nt->releaseBlockOfColumnValues(block));
     return byteBuffer;
@@ -409,10 +499,7 @@ JNIEXPORT jobject JNICALL Java_com_intel_daal_data_1management_data_HomogenNumer
     const int *data = block.getBlockPtr();
     int *dst = (int *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum; i++)
-    {
-        dst[i] = data[i];
-    }
+    copyBuffer(dst, data, vectorNum);
 
     DAAL_CHECK_THROW(nt->releaseBlockOfColumnValues(block));
     return byteBuffer;
@@ -435,10 +522,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
     float* data = block.getBlockPtr();
     const float *src = (float *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum; i++)
-    {
-        data[i] = src[i];
-    }
+    copyBuffer(data, src, vectorNum);
 
     DAAL_CHECK_THROW(nt->releaseBlockOfColumnValues(block));
 }
@@ -460,10 +544,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
     double *data = block.getBlockPtr();
     const double *src = (double *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum; i++)
-    {
-        data[i] = src[i];
-    }
+    copyBuffer(data, src, vectorNum);
 
     DAAL_CHECK_THROW(nt->releaseBlockOfColumnValues(block));
 }
@@ -486,10 +567,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericT
 
     const int *src = (int *)(env->GetDirectBufferAddress(byteBuffer));
 
-    for(size_t i = 0; i < vectorNum; i++)
-    {
-        data[i] = src[i];
-    }
+    copyBuffer(data, src, vectorNum);
 
     DAAL_CHECK_THROW(nt->releaseBlockOfColumnValues(block));
 }
@@ -64,12 +64,35 @@ private:
 template<int Tag>
 class DAAL_EXPORT JavaNumericTable : public NumericTable, public JavaNumericTableBase
 {
+protected:
+    /**
+     *  Java methods called back by the table. Their IDs are resolved once per table
+     *  on first use and reused by all threads
+     */
+    enum JavaMethod
+    {
+        getDoubleBlockMethod = 0,
+        getFloatBlockMethod,
+        getIntBlockMethod,
+        releaseDoubleBlockMethod,
+        releaseFloatBlockMethod,
+        releaseIntBlockMethod,
+        getDoubleFeatureMethod,
+        getFloatFeatureMethod,
+        getIntFeatureMethod,
+        releaseDoubleFeatureMethod,
+        releaseFloatFeatureMethod,
+        releaseIntFeatureMethod,
+        nJavaMethods
+    };
+
 public:
     DECLARE_SERIALIZABLE_TAG();
 
     explicit JavaNumericTable(DictionaryIface::FeaturesEqual featuresEqual = DictionaryIface::notEqual):
         NumericTable(0, 0, featuresEqual), jvm(NULL), jJavaNumTable(NULL)
     {
+        initJavaMethods();
     }
 
     /**
@@ -87,6 +110,7 @@ public:
         _layout = layout;
         _memStatus = userAllocated;
         jJavaNumTable = NULL;
+        initJavaMethods();
 
         _tls local_tls = tls.local();
 
@@ -129,6 +153,10 @@ public:
                 local_tls.is_attached = true;
             }
 
+            if (jJavaClass != NULL)
+            {
+                (local_tls.jenv)->DeleteGlobalRef(jJavaClass);
+            }
             if (jJavaNumTable != NULL)
             {
                 (local_tls.jenv)->DeleteGlobalRef(jJavaNumTable);
@@ -144,83 +172,72 @@ public:
 
     services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
     {
-        return getTBlock<double>(vector_idx, vector_num, rwflag, block,
-        "getDoubleBlock", "(JJLjava/nio/ByteBuffer;)Ljava/nio/DoubleBuffer;");
+        return getTBlock<double>(vector_idx, vector_num, rwflag, block, getDoubleBlockMethod);
     }
     services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
     {
-        return getTBlock<float>(vector_idx, vector_num, rwflag, block,
-        "getFloatBlock", "(JJLjava/nio/ByteBuffer;)Ljava/nio/FloatBuffer;");
+        return getTBlock<float>(vector_idx, vector_num, rwflag, block, getFloatBlockMethod);
     }
     services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
     {
-        return getTBlock<int>(vector_idx, vector_num, rwflag, block,
-        "getIntBlock", "(JJLjava/nio/ByteBuffer;)Ljava/nio/IntBuffer;");
+        return getTBlock<int>(vector_idx, vector_num, rwflag, block, getIntBlockMethod);
     }
 
 
     services::Status releaseBlockOfRows(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
     {
-        return releaseTBlock<double>(block, "releaseDoubleBlock");
+        return releaseTBlock<double>(block, releaseDoubleBlockMethod);
     }
     services::Status releaseBlockOfRows(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
     {
-        return releaseTBlock<float>(block, "releaseFloatBlock");
+        return releaseTBlock<float>(block, releaseFloatBlockMethod);
     }
     services::Status releaseBlockOfRows(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
     {
-        return releaseTBlock<int>(block, "releaseIntBlock");
+        return releaseTBlock<int>(block, releaseIntBlockMethod);
     }
 
 
     services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
                                 ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
     {
-        return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block,
-        "getDoubleFeature", "(JJJLjava/nio/ByteBuffer;)Ljava/nio/DoubleBuffer;");
+        return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block, getDoubleFeatureMethod);
     }
     services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
                                 ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
     {
-        return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block,
-        "getFloatFeature", "(JJJLjava/nio/ByteBuffer;)Ljava/nio/FloatBuffer;");
+        return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block, getFloatFeatureMethod);
     }
     services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
                                 ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
     {
-        return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block,
-        "getIntFeature", "(JJJLjava/nio/ByteBuffer;)Ljava/nio/IntBuffer;");
+        return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block, getIntFeatureMethod);
     }
 
 
     services::Status releaseBlockOfColumnValues(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
     {
-        return releaseTFeature<double>(block, "releaseDoubleFeature");
+        return releaseTFeature<double>(block, releaseDoubleFeatureMethod);
     }
     services::Status releaseBlockOfColumnValues(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
     {
-        return releaseTFeature<float>(block, "releaseFloatFeature");
+        return releaseTFeature<float>(block, releaseFloatFeatureMethod);
     }
     services::Status releaseBlockOfColumnValues(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
     {
-        return releaseTFeature<int>(block, "releaseIntFeature");
+        return releaseTFeature<int>(block, releaseIntFeatureMethod);
     }
 
 
     template<typename T>
-    services::Status getTBlock(size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T> &block,
-                   const char *javaMethodName, const char *javaMethodSignature)
+    services::Status getTBlock(size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T> &block, JavaMethod method)
     {
-        jint status = JNI_OK;
-        _tls local_tls = tls.local();
-
         block.setDetails( 0, idx, rwFlag );
 
         /* Get JNI interface pointer for current thread */
-        status = jvm->AttachCurrentThread((void **)(&(local_tls.jenv)), NULL);
-        if(status != JNI_OK) return services::Status(services::ErrorCouldntAttachCurrentThreadToJavaVM);
-
-        local_tls.is_attached = true;
+        JNIEnv *jenv = NULL;
+        services::Status s = getJNIEnv(&jenv);
+        if(!s) return s;
 
         size_t ncols = _ddict->getNumberOfFeatures();
         size_t bufferSize = nrows * ncols * sizeof(T);
@@ -229,91 +246,52 @@ public:
 
         void *buf = block.getBlockPtr();
 
-        /* Get class associated with Java object */
-        local_tls.jcls = (local_tls.jenv)->GetObjectClass(jJavaNumTable);
-        if(local_tls.jcls == NULL)
-        {
-            return services::Status(services::ErrorCouldntFindClassForJavaObject);
-        }
-
         /* Get ID of the 'getBlockOfRows' method of the Java class */
-        jmethodID jmeth = (local_tls.jenv)->GetMethodID(local_tls.jcls, javaMethodName,
-                                                        javaMethodSignature);
-        if(jmeth == NULL)
-        {
-            return services::Status(services::Error::create(services::ErrorCouldntFindJavaMethod, services::Method, services::String(javaMethodName)));
-        }
+        jmethodID jmeth = NULL;
+        s = getJavaMethodID(jenv, method, &jmeth);
+        if(!s) return s;
 
         /* Call 'getBlockOfRows' Java method */
-        local_tls.jbuf = (local_tls.jenv)->NewDirectByteBuffer( buf, bufferSize);
-        local_tls.jbuf = (local_tls.jenv)->CallObjectMethod(jJavaNumTable, jmeth, (jlong)idx, (jlong)nrows, local_tls.jbuf);
+        jobject jbuf = jenv->NewDirectByteBuffer( buf, bufferSize);
+        jobject jres = jenv->CallObjectMethod(jJavaNumTable, jmeth, (jlong)idx, (jlong)nrows, jbuf);
 
-        buf = (local_tls.jenv)->GetDirectBufferAddress(local_tls.jbuf);
+        buf = jenv->GetDirectBufferAddress(jres);
 
-        tls.local() = local_tls;
+        /* Worker threads stay attached, so local references have to be released explicitly */
+        jenv->DeleteLocalRef(jres);
+        jenv->DeleteLocalRef(jbuf);
 
         block.setPtr( (T *)buf, ncols, nrows );
-
-        if(!local_tls.is_main_thread)
-        {
-            status = jvm->DetachCurrentThread();
-            if(status != JNI_OK)
-            {
-                return services::Status(services::ErrorCouldntAttachCurrentThreadToJavaVM);
-            }
-        }
         return services::Status();
     }
 
     template<typename T>
-    services::Status releaseTBlock(BlockDescriptor<T> &block, const char *javaMethodName)
+    services::Status releaseTBlock(BlockDescriptor<T> &block, JavaMethod method)
     {
-        jint status = JNI_OK;
-        _tls local_tls = tls.local();
         if(block.getRWFlag() == writeOnly)
         {
             /* Get JNI interface pointer for current thread */
-            status = jvm->AttachCurrentThread((void **)(&(local_tls.jenv)), NULL);
-            if(status != JNI_OK)
-            {
-                return services::Status(services::ErrorCouldntAttachCurrentThreadToJavaVM);
-            }
-
-            /* Get class associated with Java object */
-            local_tls.jcls = (local_tls.jenv)->GetObjectClass(jJavaNumTable);
-            if(local_tls.jcls == NULL)
-            {
-                return services::Status(services::ErrorCouldntFindClassForJavaObject);
-            }
+            JNIEnv *jenv = NULL;
+            services::Status s = getJNIEnv(&jenv);
+            if(!s) return s;
 
             /* Get ID of the 'releaseBlockOfRows' method of the Java class */
-            jmethodID jmeth = (local_tls.jenv)->GetMethodID(local_tls.jcls, javaMethodName, "(JJLjava/nio/ByteBuffer;)V");
-            if(jmeth == NULL)
-            {
-                return services::Status(services::Error::create(services::ErrorCouldntFindJavaMethod, services::Method, services::String(javaMethodName)));
-            }
+            jmethodID jmeth = NULL;
+            s = getJavaMethodID(jenv, method, &jmeth);
+            if(!s) return s;
 
             size_t idx   = block.getRowsOffset();
             size_t nrows = block.getNumberOfRows();
             size_t ncols = _ddict->getNumberOfFeatures();
             size_t bufferSize = nrows * ncols * sizeof(T);
-            local_tls.jbuf = (local_tls.jenv)->NewDirectByteBuffer( block.getBlockPtr(), bufferSize);
+            jobject jbuf = jenv->NewDirectByteBuffer( block.getBlockPtr(), bufferSize);
 
             /* Call 'releaseBlockOfRows' Java method */
-            (local_tls.jenv)->CallObjectMethod(
-                jJavaNumTable, jmeth, (jlong)idx, (jlong)nrows, local_tls.jbuf, block.getRWFlag());
+            jenv->CallVoidMethod(jJavaNumTable, jmeth, (jlong)idx, (jlong)nrows, jbuf);
 
-            if(!local_tls.is_main_thread)
-            {
-                status = jvm->DetachCurrentThread();
-                if(status != JNI_OK)
-                {
-                    return services::Status(services::ErrorCouldntAttachCurrentThreadToJavaVM);
-                }
-            }
+            jenv->DeleteLocalRef(jbuf);
         }
 
-        tls.local() = local_tls;
         block.reset();
         return services::Status();
     }
@@ -321,21 +299,14 @@ public:
 
     template<typename T>
     services::Status getTFeature(size_t feature_idx, size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T> &block,
-                     const char *javaMethodName, const char *javaMethodSignature)
+                                 JavaMethod method)
     {
-        jint status = JNI_OK;
-        _tls local_tls = tls.local();
-
         block.setDetails( feature_idx, idx, rwFlag );
 
         /* Get JNI interface pointer for current thread */
-        status = jvm->AttachCurrentThread((void **)(&(local_tls.jenv)), NULL);
-        if(status != JNI_OK)
-        {
-            return services::Status(services::ErrorCouldntAttachCurrentThreadToJavaVM);
-        }
-
-        local_tls.is_attached = true;
+        JNIEnv *jenv = NULL;
+        services::Status s = getJNIEnv(&jenv);
+        if(!s) return s;
 
         size_t bufferSize = nrows * sizeof(T);
 
@@ -343,76 +314,50 @@ public:
 
         void *buf = block.getBlockPtr();
 
-        /* Get class associated with Java object */
-        local_tls.jcls = (local_tls.jenv)->GetObjectClass(jJavaNumTable);
-        if(local_tls.jcls == NULL)
-        {
-            return services::Status(services::ErrorCouldntFindClassForJavaObject);
-        }
-
-        /* Get ID of the 'getBlockOfRows' method of the Java class */
-        jmethodID jmeth = (local_tls.jenv)->GetMethodID(local_tls.jcls, javaMethodName,
-                                                        javaMethodSignature);
-        if(jmeth == NULL)
-        {
-            return services::Status(services::Error::create(services::ErrorCouldntFindJavaMethod, services::Method, services::String(javaMethodName)));
-        }
+        /* Get ID of the 'getBlockOfColumnValues' method of the Java class */
+        jmethodID jmeth = NULL;
+        s = getJavaMethodID(jenv, method, &jmeth);
+        if(!s) return s;
 
-        /* Call 'getBlockOfRows' Java method */
-        local_tls.jbuf = (local_tls.jenv)->NewDirectByteBuffer(buf, bufferSize);
+        /* Call 'getBlockOfColumnValues' Java method */
+        jobject jbuf = jenv->NewDirectByteBuffer(buf, bufferSize);
+        jobject jres = jenv->CallObjectMethod(jJavaNumTable, jmeth, (jlong)feature_idx, (jlong)idx, (jlong)nrows, jbuf);
 
-        local_tls.jbuf = (local_tls.jenv)->CallObjectMethod(
-                             jJavaNumTable, jmeth, (jlong)feature_idx, (jlong)idx, (jlong)nrows, local_tls.jbuf);
+        buf = jenv->GetDirectBufferAddress(jres);
 
-        buf = (local_tls.jenv)->GetDirectBufferAddress(local_tls.jbuf);
-
-        tls.local() = local_tls;
+        jenv->DeleteLocalRef(jres);
+        jenv->DeleteLocalRef(jbuf);
 
         block.setPtr( (T *)buf, 1, nrows );
         return services::Status();
     }
 
     template<typename T>
-    services::Status releaseTFeature(BlockDescriptor<T> &block, const char *javaMethodName)
+    services::Status releaseTFeature(BlockDescriptor<T> &block, JavaMethod method)
     {
-        jint status = JNI_OK;
         if(block.getRWFlag() == writeOnly)
         {
-            _tls local_tls = tls.local();
             /* Get JNI interface pointer for current thread */
-            status = jvm->AttachCurrentThread((void **)(&(local_tls.jenv)), NULL);
-            if(status != JNI_OK)
-            {
-                return services::Status(services::ErrorCouldntAttachCurrentThreadToJavaVM);
-            }
+            JNIEnv *jenv = NULL;
+            services::Status s = getJNIEnv(&jenv);
+            if(!s) return s;
 
-            /* Get class associated with Java object */
-            local_tls.jcls = (local_tls.jenv)->GetObjectClass(jJavaNumTable);
-            if(local_tls.jcls == NULL)
-            {
-                return services::Status(services::ErrorCouldntFindClassForJavaObject);
-            }
-
-            /* Get ID of the 'releaseBlockOfRows' method of the Java class */
-            jmethodID jmeth = (local_tls.jenv)->GetMethodID(local_tls.jcls, javaMethodName,
-                                                            "(JJJLjava/nio/ByteBuffer;)V");
-            if(jmeth == NULL)
-            {
-                return services::Status(services::Error::create(services::ErrorCouldntFindJavaMethod, services::Method, services::String(javaMethodName)));
-            }
+            /* Get ID of the 'releaseBlockOfColumnValues' method of the Java class */
+            jmethodID jmeth = NULL;
+            s = getJavaMethodID(jenv, method, &jmeth);
+            if(!s) return s;
 
             size_t idx   = block.getRowsOffset();
             size_t nrows = block.getNumberOfRows();
             size_t feature_idx = block.getColumnsOffset();
 
             size_t bufferSize = nrows * sizeof(T);
-            local_tls.jbuf = (local_tls.jenv)->NewDirectByteBuffer( block.getBlockPtr(), bufferSize);
+            jobject jbuf = jenv->NewDirectByteBuffer( block.getBlockPtr(), bufferSize);
 
-            /* Call 'releaseBlockOfRows' Java method */
-            (local_tls.jenv)->CallObjectMethod( jJavaNumTable, jmeth, (jlong)feature_idx, (jlong)idx, (jlong)nrows,
-                                                local_tls.jbuf, block.getRWFlag());
+            /* Call 'releaseBlockOfColumnValues' Java method */
+            jenv->CallVoidMethod(jJavaNumTable, jmeth, (jlong)feature_idx, (jlong)idx, (jlong)nrows, jbuf);
 
-            tls.local() = local_tls;
+            jenv->DeleteLocalRef(jbuf);
         }
         block.reset();
         return services::Status();
@@ -444,7 +389,95 @@ protected:
     tbb::enumerable_thread_specific<_tls> tls;  /**< Thread local storage */
     jobject jJavaNumTable;                      /**< Java object associated with this C++ object */
     JavaVM *jvm;                                /**< Java VM interface function table */
+    tbb::atomic<jclass> jJavaClass;             /**< Global reference to the class of jJavaNumTable */
+    tbb::atomic<jmethodID> jMethods[nJavaMethods]; /**< Cached IDs of the Java methods */
+
+    void initJavaMethods()
+    {
+        jJavaClass = NULL;
+        for(size_t i = 0; i < nJavaMethods; i++)
+        {
+            jMethods[i] = NULL;
+        }
+    }
+
+    /**
+     *  Returns JNI interface pointer for the current thread. A thread that is not attached to Java VM yet
+     *  is attached as a daemon and stays attached, so repeated block requests from the same thread
+     *  do not pay for attaching and detaching it
+     */
+    services::Status getJNIEnv(JNIEnv **jenv)
+    {
+        if(jvm->GetEnv((void **)jenv, JNI_VERSION_1_2) == JNI_OK)
+        {
+            return services::Status();
+        }
+
+        jint status = jvm->AttachCurrentThreadAsDaemon((void **)jenv, NULL);
+        if(status != JNI_OK)
+        {
+            return services::Status(services::ErrorCouldntAttachCurrentThreadToJavaVM);
+        }
+        tls.local().is_attached = true;
+        return services::Status();
+    }
 
+    services::Status getJavaMethodID(JNIEnv *jenv, JavaMethod method, jmethodID *jmeth)
+    {
+        *jmeth = jMethods[method];
+        if(*jmeth != NULL)
+        {
+            return services::Status();
+        }
+
+        if(jJavaClass == NULL)
+        {
+            /* Get class associated with Java object */
+            jclass jcls = jenv->GetObjectClass(jJavaNumTable);
+            if(jcls == NULL)
+            {
+                return services::Status(services::ErrorCouldntFindClassForJavaObject);
+            }
+            jclass jglobalcls = (jclass)jenv->NewGlobalRef(jcls);
+            jenv->DeleteLocalRef(jcls);
+            if(jJavaClass.compare_and_swap(jglobalcls, NULL) != NULL)
+            {
+                /* Another thread has already cached the class */
+                jenv->DeleteGlobalRef(jglobalcls);
+            }
+        }
+
+        static const char *const names[nJavaMethods] =
+        {
+            "getDoubleBlock", "getFloatBlock", "getIntBlock",
+            "releaseDoubleBlock", "releaseFloatBlock", "releaseIntBlock",
+            "getDoubleFeature", "getFloatFeature", "getIntFeature",
+            "releaseDoubleFeature", "releaseFloatFeature", "releaseIntFeature"
+        };
+        static const char *const signatures[nJavaMethods] =
+        {
+            "(JJLjava/nio/ByteBuffer;)Ljava/nio/DoubleBuffer;",
+            "(JJLjava/nio/ByteBuffer;)Ljava/nio/FloatBuffer;",
+            "(JJLjava/nio/ByteBuffer;)Ljava/nio/IntBuffer;",
+            "(JJLjava/nio/ByteBuffer;)V",
+            "(JJLjava/nio/ByteBuffer;)V",
+            "(JJLjava/nio/ByteBuffer;)V",
+            "(JJJLjava/nio/ByteBuffer;)Ljava/nio/DoubleBuffer;",
+            "(JJJLjava/nio/ByteBuffer;)Ljava/nio/FloatBuffer;",
+            "(JJJLjava/nio/ByteBuffer;)Ljava/nio/IntBuffer;",
+            "(JJJLjava/nio/ByteBuffer;)V",
+            "(JJJLjava/nio/ByteBuffer;)V",
+            "(JJJLjava/nio/ByteBuffer;)V"
+        };
+
+        *jmeth = jenv->GetMethodID(jJavaClass, names[method], signatures[method]);
+        if(*jmeth == NULL)
+        {
+            return services::Status(services::Error::create(services::ErrorCouldntFindJavaMethod, services::Method, services::String(names[method])));
+        }
+        jMethods[method] = *jmeth;
+        return services::Status();
+    }
     template<typename Archive, bool onDeserialize>
     void serialImpl(Archive *arch)
     {
@@ -232,6 +232,44 @@ static int check_ssse3_features()
     return 1;
 }
 
+size_t __daal_serv_get_cache_size(int level)
+{
+    uint32_t abcd[4];
+
+    /* CPUID.(EAX=00H):EAX - the maximal supported standard leaf */
+    run_cpuid( 0, 0, abcd );
+    if ( abcd[0] < 4 )
+    {
+        return 0;
+    }
+
+    /* CPUID.(EAX=04H, ECX=i) - deterministic cache parameters of the i-th cache */
+    for ( uint32_t i = 0; i < 16; i++ )
+    {
+        run_cpuid( 4, i, abcd );
+
+        const uint32_t cacheType = abcd[0] & 0x1F;
+        if ( cacheType == 0 )
+        {
+            break;
+        }
+
+        /* Instruction caches (type 2) are skipped */
+        if ( cacheType == 2 || (int)((abcd[0] >> 5) & 0x7) != level )
+        {
+            continue;
+        }
+
+        const size_t ways       = ((abcd[1] >> 22) & 0x3FF) + 1;
+        const size_t partitions = ((abcd[1] >> 12) & 0x3FF) + 1;
+        const size_t lineSize   = ( abcd[1]        & 0xFFF) + 1;
+        const size_t sets       = (size_t)abcd[2] + 1;
+        return ways * partitions * lineSize * sets;
+    }
+
+    return 0;
+}
+
 int __daal_serv_cpu_detect(int enable)
 {
     if( (enable&daal::services::Environment::avx512_mic_e1) == daal::services::Environment::avx512_mic_e1 )
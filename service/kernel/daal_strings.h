@@ -281,7 +281,11 @@
     DECLARE_DAAL_STRING_CONST(logTheta                           ) \
     DECLARE_DAAL_STRING_CONST(tableToFill                        ) \
     DECLARE_DAAL_STRING_CONST(randomNumbers                      ) \
-    DECLARE_DAAL_STRING_CONST(logP                               )
+    DECLARE_DAAL_STRING_CONST(logP                               ) \
+    DECLARE_DAAL_STRING_CONST(updateType                         ) \
+    DECLARE_DAAL_STRING_CONST(inputCholeskyFactor                ) \
+    DECLARE_DAAL_STRING_CONST(removedData                        ) \
+    DECLARE_DAAL_STRING_CONST(removedDependentVariables          )
 
 
 /**
@@ -112,6 +112,9 @@ static void vectorStrideConvertFunc(size_t n, void *src, size_t srcByteStride, v
 #undef  DAAL_TABLE_DOWN_ENTRY
 #define DAAL_TABLE_DOWN_ENTRY(F,T) {F<float, T>, F<double, T>, F<int, T> }
 
+#undef  DAAL_TABLE_OTHER_ENTRY
+#define DAAL_TABLE_OTHER_ENTRY {NULL, NULL, NULL }
+
 #undef  DAAL_CONVERT_UP_TABLE
 #define DAAL_CONVERT_UP_TABLE(F) {              \
         DAAL_TABLE_UP_ENTRY(F,float),               \
@@ -124,6 +127,8 @@ static void vectorStrideConvertFunc(size_t n, void *src, size_t srcByteStride, v
         DAAL_TABLE_UP_ENTRY(F,unsigned char),       \
         DAAL_TABLE_UP_ENTRY(F,short),               \
         DAAL_TABLE_UP_ENTRY(F,unsigned short),      \
+        DAAL_TABLE_OTHER_ENTRY,                     \
+        DAAL_TABLE_UP_ENTRY(F,bfloat16),            \
     }
 
 #undef  DAAL_CONVERT_DOWN_TABLE
@@ -138,6 +143,8 @@ static void vectorStrideConvertFunc(size_t n, void *src, size_t srcByteStride, v
         DAAL_TABLE_DOWN_ENTRY(F,unsigned char),    \
         DAAL_TABLE_DOWN_ENTRY(F,short),            \
         DAAL_TABLE_DOWN_ENTRY(F,unsigned short),   \
+        DAAL_TABLE_OTHER_ENTRY,                    \
+        DAAL_TABLE_DOWN_ENTRY(F,bfloat16),         \
     }
 
 DAAL_EXPORT data_feature_utils::vectorConvertFuncType getVectorUpCast(int idx1, int idx2)
@@ -66,7 +66,8 @@ template void F<int   , T, DAAL_CPU> A;
         DAAL_FUNCS_UP_ENTRY(F,char,A)                 \
         DAAL_FUNCS_UP_ENTRY(F,unsigned char,A)        \
         DAAL_FUNCS_UP_ENTRY(F,short,A)                \
-        DAAL_FUNCS_UP_ENTRY(F,unsigned short,A)
+        DAAL_FUNCS_UP_ENTRY(F,unsigned short,A)       \
+        DAAL_FUNCS_UP_ENTRY(F,data_management::bfloat16,A)
 
 #undef  DAAL_CONVERT_DOWN_FUNCS
 #define DAAL_CONVERT_DOWN_FUNCS(F,A)                 \
@@ -76,7 +77,8 @@ template void F<int   , T, DAAL_CPU> A;
         DAAL_FUNCS_DOWN_ENTRY(F,char,A)              \
         DAAL_FUNCS_DOWN_ENTRY(F,unsigned char,A)     \
         DAAL_FUNCS_DOWN_ENTRY(F,short,A)             \
-        DAAL_FUNCS_DOWN_ENTRY(F,unsigned short,A)
+        DAAL_FUNCS_DOWN_ENTRY(F,unsigned short,A)    \
+        DAAL_FUNCS_DOWN_ENTRY(F,data_management::bfloat16,A)
 
 DAAL_CONVERT_UP_FUNCS(vectorConvertFuncCpu,(size_t n, void *src, void *dst))
 DAAL_CONVERT_DOWN_FUNCS(vectorConvertFuncCpu,(size_t n, void *src, void *dst))
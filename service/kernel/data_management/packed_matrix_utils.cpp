@@ -0,0 +1,231 @@
+/** file packed_matrix_utils.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the row access to the packed symmetric and triangular matrices
+//--
+*/
+
+#include "data_utils.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace data_feature_utils
+{
+
+namespace
+{
+
+/* Number of matrix elements starting from which the rows are copied in parallel */
+const size_t packedParallelSize = ((size_t)1 << 16);
+
+/* Number of rows processed by one thread */
+const size_t packedRowsBlockSize = 64;
+
+size_t indexNumTypeSize(IndexNumType type)
+{
+    static const size_t sizes[NumOfIndexNumTypes] =
+    {
+        sizeof(float), sizeof(double), sizeof(int), sizeof(unsigned int), sizeof(DAAL_INT64), sizeof(DAAL_UINT64),
+        sizeof(char), sizeof(unsigned char), sizeof(short), sizeof(unsigned short), 0 /* DAAL_OTHER_T */, sizeof(bfloat16)
+    };
+    return sizes[type];
+}
+
+size_t internalNumTypeSize(InternalNumType type)
+{
+    return (type == DAAL_DOUBLE ? sizeof(double) : (type == DAAL_SINGLE ? sizeof(float) : sizeof(int)));
+}
+
+bool isUpper(PackedMatrixType type)
+{
+    return (type == DAAL_UPPER_PACKED_SYMMETRIC || type == DAAL_UPPER_PACKED_TRIANGULAR);
+}
+
+bool isSymmetric(PackedMatrixType type)
+{
+    return (type == DAAL_UPPER_PACKED_SYMMETRIC || type == DAAL_LOWER_PACKED_SYMMETRIC);
+}
+
+/* Offset of the first stored element of the row in the packed array */
+size_t packedRowOffset(bool upper, size_t nDim, size_t iRow)
+{
+    return (upper ? iRow * nDim - (iRow * (iRow - 1)) / 2 : (iRow * (iRow + 1)) / 2);
+}
+
+/* Calls func(iBegin, iEnd) for the blocks of [begin, end), in parallel if the amount of work is large enough */
+template<typename Func>
+void processRows(size_t begin, size_t end, size_t nDim, const Func &func)
+{
+    if (begin >= end) { return; }
+    const size_t n = end - begin;
+    if (n * nDim < packedParallelSize || n <= packedRowsBlockSize)
+    {
+        func(begin, end);
+        return;
+    }
+    const size_t nBlocks = (n + packedRowsBlockSize - 1) / packedRowsBlockSize;
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+    {
+        const size_t iBegin = begin + iBlock * packedRowsBlockSize;
+        const size_t iEnd   = (iBegin + packedRowsBlockSize < end ? iBegin + packedRowsBlockSize : end);
+        func(iBegin, iEnd);
+    });
+}
+
+void fillZeros(size_t nBytes, byte *dst)
+{
+    for (size_t i = 0; i < nBytes; i++)
+    {
+        dst[i] = 0;
+    }
+}
+
+} // namespace
+
+DAAL_EXPORT void unpackRows(PackedMatrixType type, size_t nDim, size_t rowOffset, size_t nRows,
+                            const void *packed, IndexNumType packedType, void *rows, InternalNumType rowsType)
+{
+    const bool upper = isUpper(type);
+    const size_t r0 = rowOffset;
+    const size_t r1 = rowOffset + nRows;
+    const size_t srcSize = indexNumTypeSize(packedType);
+    const size_t dstSize = internalNumTypeSize(rowsType);
+    const size_t dstRowSize = nDim * dstSize;
+    byte *src = (byte *)packed;
+    byte *dst = (byte *)rows;
+
+    vectorConvertFuncType convert = getVectorUpCast(packedType, rowsType);
+    vectorStrideConvertFuncType strideConvert = getVectorStrideUpCast(packedType, rowsType);
+
+    /* Stored part of each row is contiguous in the packed array */
+    processRows(r0, r1, nDim, [&](size_t iBegin, size_t iEnd)
+    {
+        for (size_t i = iBegin; i < iEnd; i++)
+        {
+            byte *dstRow = dst + (i - r0) * dstRowSize;
+            byte *srcRow = src + packedRowOffset(upper, nDim, i) * srcSize;
+            if (upper)
+            {
+                convert(nDim - i, srcRow, dstRow + i * dstSize);
+                if (!isSymmetric(type)) { fillZeros(i * dstSize, dstRow); }
+            }
+            else
+            {
+                convert(i + 1, srcRow, dstRow);
+                if (!isSymmetric(type)) { fillZeros((nDim - i - 1) * dstSize, dstRow + (i + 1) * dstSize); }
+            }
+        }
+    });
+
+    if (!isSymmetric(type)) { return; }
+
+    /* Remaining part of the rows is a column segment of the buffer and a contiguous part of a packed row */
+    if (upper)
+    {
+        processRows(0, (r1 > 0 ? r1 - 1 : 0), nDim, [&](size_t kBegin, size_t kEnd)
+        {
+            for (size_t k = kBegin; k < kEnd; k++)
+            {
+                const size_t jBegin = (k + 1 > r0 ? k + 1 : r0);
+                strideConvert(r1 - jBegin, src + (packedRowOffset(true, nDim, k) + jBegin - k) * srcSize, srcSize,
+                              dst + ((jBegin - r0) * nDim + k) * dstSize, dstRowSize);
+            }
+        });
+    }
+    else
+    {
+        processRows(r0 + 1, nDim, nDim, [&](size_t kBegin, size_t kEnd)
+        {
+            for (size_t k = kBegin; k < kEnd; k++)
+            {
+                const size_t jEnd = (k < r1 ? k : r1);
+                strideConvert(jEnd - r0, src + (packedRowOffset(false, nDim, k) + r0) * srcSize, srcSize,
+                              dst + k * dstSize, dstRowSize);
+            }
+        });
+    }
+}
+
+DAAL_EXPORT void packRows(PackedMatrixType type, size_t nDim, size_t rowOffset, size_t nRows,
+                          const void *rows, InternalNumType rowsType, void *packed, IndexNumType packedType)
+{
+    const bool upper = isUpper(type);
+    const size_t r0 = rowOffset;
+    const size_t r1 = rowOffset + nRows;
+    const size_t srcSize = internalNumTypeSize(rowsType);
+    const size_t dstSize = indexNumTypeSize(packedType);
+    const size_t srcRowSize = nDim * srcSize;
+    byte *src = (byte *)rows;
+    byte *dst = (byte *)packed;
+
+    vectorConvertFuncType convert = getVectorDownCast(packedType, rowsType);
+    vectorStrideConvertFuncType strideConvert = getVectorStrideDownCast(packedType, rowsType);
+
+    /* Symmetric element stored in the packed row k is taken from the buffer row that comes later,
+       as element-wise copying of the rows in their order does */
+    if (isSymmetric(type) && !upper)
+    {
+        processRows(r0 + 1, nDim, nDim, [&](size_t kBegin, size_t kEnd)
+        {
+            for (size_t k = kBegin; k < kEnd; k++)
+            {
+                const size_t jEnd = (k < r1 ? k : r1);
+                strideConvert(jEnd - r0, src + k * srcSize, srcRowSize,
+                              dst + (packedRowOffset(false, nDim, k) + r0) * dstSize, dstSize);
+            }
+        });
+    }
+
+    processRows(r0, r1, nDim, [&](size_t iBegin, size_t iEnd)
+    {
+        for (size_t i = iBegin; i < iEnd; i++)
+        {
+            byte *srcRow = src + (i - r0) * srcRowSize;
+            byte *dstRow = dst + packedRowOffset(upper, nDim, i) * dstSize;
+            if (upper)
+            {
+                convert(nDim - i, srcRow + i * srcSize, dstRow);
+            }
+            else
+            {
+                convert(i + 1, srcRow, dstRow);
+            }
+        }
+    });
+
+    if (isSymmetric(type) && upper)
+    {
+        processRows(0, (r1 > 0 ? r1 - 1 : 0), nDim, [&](size_t kBegin, size_t kEnd)
+        {
+            for (size_t k = kBegin; k < kEnd; k++)
+            {
+                const size_t jBegin = (k + 1 > r0 ? k + 1 : r0);
+                strideConvert(r1 - jBegin, src + ((jBegin - r0) * nDim + k) * srcSize, srcRowSize,
+                              dst + (packedRowOffset(true, nDim, k) + jBegin - k) * dstSize, dstSize);
+            }
+        });
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,192 @@
+/* file: env_tuning.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Selection and persistence of the tuned parameters of the computational kernels.
+//--
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "env_detect.h"
+#include "service_defines.h"
+
+using namespace daal;
+using namespace daal::services;
+
+namespace
+{
+
+const size_t nCpuTypes = (size_t)daal::lastCpuType + 1;
+const size_t nTuningParameters = (size_t)Environment::lastTuningParameterId + 1;
+
+const char *cpuTypeNames[nCpuTypes] =
+{
+    "sse2", "ssse3", "sse42", "avx", "avx2", "avx512_mic", "avx512", "avx512_mic_e1"
+};
+
+const char *tuningParameterNames[nTuningParameters] =
+{
+    "kmeansBlockSize", "mseBlockSize", "momentsBlockSize", "dfPredictionBlockSize", "layersMinElementsInBlock"
+};
+
+/* Values the kernels were tuned with on the processors with 32 KB L1 and 256 KB L2 data caches */
+const size_t referenceL1Size = 32 * 1024;
+const size_t referenceL2Size = 256 * 1024;
+const size_t referenceValues[nTuningParameters] = { 512, 512, 256, 500, 997 };
+
+/* Scales the reference value proportionally to the cache size, not more than 4 times in either direction */
+size_t scaleToCache(size_t value, size_t cacheSize, size_t referenceCacheSize)
+{
+    if (!cacheSize) { return value; }
+    size_t scaled = (size_t)((double)value * (double)cacheSize / (double)referenceCacheSize);
+    if (scaled < value / 4) { scaled = value / 4; }
+    if (scaled > value * 4) { scaled = value * 4; }
+    return (scaled ? scaled : 1);
+}
+
+int findName(const char *name, const char **names, size_t nNames)
+{
+    for (size_t i = 0; i < nNames; i++)
+    {
+        if (!strcmp(name, names[i])) { return (int)i; }
+    }
+    return -1;
+}
+
+FILE *openFile(const char *fileName, const char *mode)
+{
+    FILE *file = NULL;
+#if (defined(_MSC_VER)&&(_MSC_VER >= 1400))
+    if (fopen_s(&file, fileName, mode)) { file = NULL; }
+#else
+    file = fopen(fileName, mode);
+#endif
+    return file;
+}
+
+class TuningTable
+{
+public:
+    TuningTable()
+    {
+        calibrate();
+        const char *fileName = getenv("DAAL_TUNING_FILE");
+        if (fileName && fileName[0]) { load(fileName); }
+    }
+
+    void calibrate()
+    {
+        const size_t l1Size = __daal_serv_get_cache_size(1);
+        const size_t l2Size = __daal_serv_get_cache_size(2);
+
+        for (size_t cpu = 0; cpu < nCpuTypes; cpu++)
+        {
+            size_t *v = values[cpu];
+            v[Environment::kmeansBlockSize]          = scaleToCache(cpu == (size_t)daal::avx512_mic ? 448 : referenceValues[Environment::kmeansBlockSize],
+                                                                    l2Size, referenceL2Size);
+            v[Environment::mseBlockSize]             = scaleToCache(referenceValues[Environment::mseBlockSize], l2Size, referenceL2Size);
+            v[Environment::momentsBlockSize]         = scaleToCache(referenceValues[Environment::momentsBlockSize], l2Size, referenceL2Size);
+            v[Environment::dfPredictionBlockSize]    = scaleToCache(referenceValues[Environment::dfPredictionBlockSize], l2Size, referenceL2Size);
+            v[Environment::layersMinElementsInBlock] = scaleToCache(referenceValues[Environment::layersMinElementsInBlock], l1Size, referenceL1Size);
+        }
+    }
+
+    Status load(const char *fileName)
+    {
+        FILE *file = openFile(fileName, "r");
+        DAAL_CHECK(file, ErrorOnFileOpen);
+
+        Status s;
+        char cpuName[32], parameterName[64];
+        unsigned long long value = 0;
+        int nRead = 0;
+        while ((nRead = fscanf(file, "%31s %63s %llu", cpuName, parameterName, &value)) == 3)
+        {
+            /* Unknown names are skipped to keep the files usable across the library versions */
+            const int cpu = findName(cpuName, cpuTypeNames, nCpuTypes);
+            const int id  = findName(parameterName, tuningParameterNames, nTuningParameters);
+            if (cpu >= 0 && id >= 0 && value > 0)
+            {
+                values[cpu][id] = (size_t)value;
+            }
+        }
+        if (nRead != EOF) { s.add(ErrorOnFileRead); }
+        fclose(file);
+        return s;
+    }
+
+    Status save(const char *fileName) const
+    {
+        FILE *file = openFile(fileName, "w");
+        DAAL_CHECK(file, ErrorOnFileOpen);
+
+        for (size_t cpu = 0; cpu < nCpuTypes; cpu++)
+        {
+            for (size_t id = 0; id < nTuningParameters; id++)
+            {
+                fprintf(file, "%s %s %llu\n", cpuTypeNames[cpu], tuningParameterNames[id], (unsigned long long)values[cpu][id]);
+            }
+        }
+        fclose(file);
+        return Status();
+    }
+
+    size_t values[nCpuTypes][nTuningParameters];
+};
+
+TuningTable &tuningTable()
+{
+    static TuningTable table;
+    return table;
+}
+
+} // namespace
+
+DAAL_EXPORT size_t daal::services::Environment::getTuningParameter(TuningParameterId id, CpuType cpu) const
+{
+    DAAL_ASSERT((size_t)id < nTuningParameters && (size_t)cpu < nCpuTypes);
+    if ((size_t)id >= nTuningParameters || (size_t)cpu >= nCpuTypes) { return 0; }
+    return tuningTable().values[cpu][id];
+}
+
+DAAL_EXPORT Status daal::services::Environment::setTuningParameter(TuningParameterId id, CpuType cpu, size_t value)
+{
+    DAAL_CHECK((size_t)id < nTuningParameters && (size_t)cpu < nCpuTypes && value > 0, ErrorIncorrectParameter);
+    tuningTable().values[cpu][id] = value;
+    return Status();
+}
+
+DAAL_EXPORT void daal::services::Environment::calibrateTuningParameters()
+{
+    tuningTable().calibrate();
+}
+
+DAAL_EXPORT Status daal::services::Environment::loadTuningParameters(const char *fileName)
+{
+    DAAL_CHECK(fileName, ErrorNullParameterNotSupported);
+    return tuningTable().load(fileName);
+}
+
+DAAL_EXPORT Status daal::services::Environment::saveTuningParameters(const char *fileName) const
+{
+    DAAL_CHECK(fileName, ErrorNullParameterNotSupported);
+    return tuningTable().save(fileName);
+}
@@ -28,6 +28,7 @@
 #include "services/env_detect.h"
 
 int __daal_serv_cpu_detect(int );
+size_t __daal_serv_get_cache_size(int level);
 
 #if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
     #define PRAGMA_IVDEP
@@ -38,7 +39,7 @@ int __daal_serv_cpu_detect(int );
     #define PRAGMA_SIMD_ASSERT
     #define PRAGMA_ICC_OMP(ARGS)
     #define PRAGMA_ICC_NO16(ARGS)
-#else
+#elif defined(__INTEL_COMPILER)
     #define PRAGMA_IVDEP _Pragma("ivdep")
     #define PRAGMA_NOVECTOR _Pragma("novector")
     #define PRAGMA_VECTOR_ALIGNED _Pragma("vector aligned")
@@ -48,6 +49,51 @@ int __daal_serv_cpu_detect(int );
     #define PRAGMA_ICC_TO_STR(ARGS) _Pragma(#ARGS)
     #define PRAGMA_ICC_OMP(ARGS) PRAGMA_ICC_TO_STR(omp ARGS)
     #define PRAGMA_ICC_NO16(ARGS) PRAGMA_ICC_TO_STR(ARGS)
+#else
+    /* GCC and Clang: only the hints that have a loop pragma of the same meaning are mapped,
+       the alignment and cost model hints of the Intel compiler are dropped.
+       The OpenMP SIMD directives are honored when the sources are built with -fopenmp-simd.
+       Clang has no pragma that ignores only the assumed dependencies as ivdep does,
+       so ivdep only requests vectorization there and the compiler keeps its dependency checks */
+    #if defined(__clang__)
+        #define PRAGMA_IVDEP _Pragma("clang loop vectorize(enable)")
+        #define PRAGMA_NOVECTOR _Pragma("clang loop vectorize(disable)")
+    #else
+        #define PRAGMA_IVDEP _Pragma("GCC ivdep")
+        #define PRAGMA_NOVECTOR
+    #endif
+    #define PRAGMA_VECTOR_ALIGNED
+    #define PRAGMA_VECTOR_UNALIGNED
+    #define PRAGMA_VECTOR_ALWAYS
+    #define PRAGMA_SIMD_ASSERT
+    #define PRAGMA_ICC_TO_STR(ARGS) _Pragma(#ARGS)
+    #define PRAGMA_ICC_OMP(ARGS) PRAGMA_ICC_TO_STR(omp ARGS)
+    #define PRAGMA_ICC_NO16(ARGS) PRAGMA_ICC_TO_STR(ARGS)
+#endif
+
+/* Intrinsic fast paths of the kernels. The Intel compiler accepts intrinsics of any instruction set,
+   GCC and Clang accept them only if the instruction set is enabled for the translation unit,
+   that is, when the CPU-specific sources are compiled with the matching -march option */
+#if defined(__x86_64__) || defined(_M_AMD64) || defined(__i386__) || defined(_M_IX86)
+    #if defined(__INTEL_COMPILER)
+        #define __DAAL_INTRINSICS_SSE2__
+        #define __DAAL_INTRINSICS_SSE41__
+        #define __DAAL_INTRINSICS_AVX__
+        #define __DAAL_INTRINSICS_AVX512__
+    #elif defined(__GNUC__) && !defined(_MSC_VER)
+        #if defined(__SSE2__)
+            #define __DAAL_INTRINSICS_SSE2__
+        #endif
+        #if defined(__SSE4_1__)
+            #define __DAAL_INTRINSICS_SSE41__
+        #endif
+        #if defined(__AVX__)
+            #define __DAAL_INTRINSICS_AVX__
+        #endif
+        #if defined(__AVX512F__) && defined(__AVX512CD__) && defined(__BMI__)
+            #define __DAAL_INTRINSICS_AVX512__
+        #endif
+    #endif
 #endif
 
 #if defined __APPLE__ && defined __INTEL_COMPILER && (__INTEL_COMPILER==1600)
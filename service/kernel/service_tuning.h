@@ -0,0 +1,46 @@
+/* file: service_tuning.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Access to the tuned parameters of the computational kernels
+//--
+*/
+#ifndef __SERVICE_TUNING_H__
+#define __SERVICE_TUNING_H__
+
+#include "env_detect.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+
+/* Returns the value of the tuned parameter for the kernels compiled for the given cpu */
+template<CpuType cpu>
+inline size_t getTuningParameter(Environment::TuningParameterId id)
+{
+    return Environment::getInstance()->getTuningParameter(id, cpu);
+}
+
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+#endif